@@ -0,0 +1,274 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Comparing the double instantiations for equality is intended
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/checked_numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include <cstdint>
+#include <limits>
+
+//
+// Assembly equivalence check
+//
+// Every operation provided by numeric_typedef_base and every binop:: mixin is
+// instantiated twice: once on the builtin type, and once on an opaque
+// typedef of that type.  Each pair of functions is named
+//   asm_builtin_<operation>_<type>
+//   asm_opaque_<operation>_<type>
+// and asmcheck.sh compares the number of instructions emitted for each.
+//
+// The opaque typedef is expected to have zero overhead, so the opaque
+// function must never be longer than its builtin counterpart.
+//
+// Checked arithmetic is compared against the builtin operation checked by
+// hand with __builtin_add_overflow and its relatives, under each policy.
+//
+
+using namespace opaque;
+
+namespace {
+
+template <typename T> struct num : numeric_typedef<T, num<T>> {
+  using base = numeric_typedef<T, num<T>>;
+  using base::base;
+};
+
+template <typename T> struct distance : numeric_typedef<T, distance<T>> {
+  using base = numeric_typedef<T, distance<T>>;
+  using base::base;
+};
+
+template <typename T> struct position
+  : experimental::position_typedef<distance<T>, position<T>> {
+  using base = experimental::position_typedef<distance<T>, position<T>>;
+  using base::base;
+};
+
+template <typename T> struct offset : numeric_typedef<T, offset<T>> {
+  using base = numeric_typedef<T, offset<T>>;
+  using base::base;
+};
+
+// Mixed-type operations with conversion to the underlying type
+template <typename T> struct address : numeric_typedef_base<T, address<T>>
+  , binop::addable     <address<T>, true , address<T>,  offset<T>>
+  , binop::subtractable<offset<T> , false, address<T>, address<T>, T, T>
+{
+  using base = numeric_typedef_base<T, address<T>>;
+  using base::base;
+  address& operator+=(const address&) = delete;
+  address& operator-=(const address&) = delete;
+  constexpr14 address& operator+=(const offset<T>& o) noexcept {
+    this->value += o.value;
+    return *this;
+  }
+};
+
+template <typename T, typename P>
+struct checked : checked_numeric_typedef<T, checked<T,P>, P> {
+  using base = checked_numeric_typedef<T, checked<T,P>, P>;
+  using base::base;
+};
+
+}
+
+typedef int           i32;
+typedef unsigned      u32;
+typedef std::int64_t  i64;
+typedef double        f64;
+
+#define ASMCHECK_FUNC(R, kind, name, type, params) \
+  extern "C" R asm_##kind##_##name##_##type params; \
+  extern "C" R asm_##kind##_##name##_##type params
+
+// T = T @ T
+#define ASMCHECK_BINARY(name, op, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a, type b)) { \
+    return a op b; } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a, type b)) { \
+    return (num<type>(a) op num<type>(b)).value; }
+
+// T @= T
+#define ASMCHECK_COMPOUND(name, op, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a, type b)) { \
+    a op b; return a; } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a, type b)) { \
+    num<type> x(a); x op num<type>(b); return x.value; }
+
+// T = T @ S
+#define ASMCHECK_SHIFT(name, op, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a, unsigned b)) { \
+    return a op b; } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a, unsigned b)) { \
+    return (num<type>(a) op b).value; }
+
+// T @= S
+#define ASMCHECK_SHIFT_COMPOUND(name, op, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a, unsigned b)) { \
+    a op b; return a; } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a, unsigned b)) { \
+    num<type> x(a); x op b; return x.value; }
+
+// @T
+#define ASMCHECK_UNARY(name, op, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a)) { \
+    return static_cast<type>(op a); } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a)) { \
+    return (op num<type>(a)).value; }
+
+// @T and T@ (increment and decrement)
+#define ASMCHECK_STEP(name, pre, post, type) \
+  ASMCHECK_FUNC(type, builtin, name, type, (type a)) { \
+    return pre a post; } \
+  ASMCHECK_FUNC(type, opaque , name, type, (type a)) { \
+    num<type> x(a); return (pre x post).value; }
+
+// bool = T @ T
+#define ASMCHECK_COMPARE(name, op, type) \
+  ASMCHECK_FUNC(bool, builtin, name, type, (type a, type b)) { \
+    return a op b; } \
+  ASMCHECK_FUNC(bool, opaque , name, type, (type a, type b)) { \
+    return num<type>(a) op num<type>(b); }
+
+// bool = @T, bool(T)
+#define ASMCHECK_LOGICAL(type) \
+  ASMCHECK_FUNC(bool, builtin, not, type, (type a)) { \
+    return !a; } \
+  ASMCHECK_FUNC(bool, opaque , not, type, (type a)) { \
+    return !num<type>(a); } \
+  ASMCHECK_FUNC(bool, builtin, bool, type, (type a)) { \
+    return static_cast<bool>(a); } \
+  ASMCHECK_FUNC(bool, opaque , bool, type, (type a)) { \
+    return static_cast<bool>(num<type>(a)); }
+
+// Mixed-type operations from user-specified binop:: mixins
+#define ASMCHECK_MIXED(type) \
+  ASMCHECK_FUNC(type, builtin, pos_add_dist, type, (type a, type b)) { \
+    return a + b; } \
+  ASMCHECK_FUNC(type, opaque , pos_add_dist, type, (type a, type b)) { \
+    return (position<type>(a) + distance<type>(b)).value; } \
+  ASMCHECK_FUNC(type, builtin, dist_add_pos, type, (type a, type b)) { \
+    return a + b; } \
+  ASMCHECK_FUNC(type, opaque , dist_add_pos, type, (type a, type b)) { \
+    return (distance<type>(a) + position<type>(b)).value; } \
+  ASMCHECK_FUNC(type, builtin, pos_sub_dist, type, (type a, type b)) { \
+    return a - b; } \
+  ASMCHECK_FUNC(type, opaque , pos_sub_dist, type, (type a, type b)) { \
+    return (position<type>(a) - distance<type>(b)).value; } \
+  ASMCHECK_FUNC(type, builtin, pos_sub_pos, type, (type a, type b)) { \
+    return a - b; } \
+  ASMCHECK_FUNC(type, opaque , pos_sub_pos, type, (type a, type b)) { \
+    return (position<type>(a) - position<type>(b)).value; } \
+  ASMCHECK_FUNC(type, builtin, addr_add_off, type, (type a, type b)) { \
+    return a + b; } \
+  ASMCHECK_FUNC(type, opaque , addr_add_off, type, (type a, type b)) { \
+    return (address<type>(a) + offset<type>(b)).value; } \
+  ASMCHECK_FUNC(type, builtin, addr_sub_addr, type, (type a, type b)) { \
+    return a - b; } \
+  ASMCHECK_FUNC(type, opaque , addr_sub_addr, type, (type a, type b)) { \
+    return (address<type>(a) - address<type>(b)).value; }
+
+// Checked T = T @ T under a policy, against the builtin checked by hand
+#define ASMCHECK_CHECKED(name, op, check, positive, policy, handle, type) \
+  ASMCHECK_FUNC(type, builtin, name##_##policy, type, (type a, type b)) { \
+    type r; \
+    if (check(a, b, &r)) { handle(positive); } \
+    return r; } \
+  ASMCHECK_FUNC(type, opaque , name##_##policy, type, (type a, type b)) { \
+    using c = checked<type, policy##_on_overflow>; \
+    return (c(a) op c(b)).value; }
+
+#define ASMCHECK_HANDLE_THROW(positive) detail::throw_overflow();
+#define ASMCHECK_HANDLE_TRAP(positive) __builtin_trap();
+#define ASMCHECK_HANDLE_WRAP(positive)
+#define ASMCHECK_HANDLE_SATURATE(positive) \
+  r = (positive) ? std::numeric_limits<decltype(r)>::max() \
+                 : std::numeric_limits<decltype(r)>::min();
+
+#define ASMCHECK_CHECKED_POLICY(policy, handle, type) \
+  ASMCHECK_CHECKED(chk_add, +, __builtin_add_overflow, \
+                   !detail::is_negative(b), policy, handle, type) \
+  ASMCHECK_CHECKED(chk_sub, -, __builtin_sub_overflow, \
+                   detail::is_negative(b), policy, handle, type) \
+  ASMCHECK_CHECKED(chk_mul, *, __builtin_mul_overflow, \
+                   detail::is_negative(a) == detail::is_negative(b), \
+                   policy, handle, type)
+
+#define ASMCHECK_CHECKED_ALL(type) \
+  ASMCHECK_CHECKED_POLICY(throw   , ASMCHECK_HANDLE_THROW   , type) \
+  ASMCHECK_CHECKED_POLICY(saturate, ASMCHECK_HANDLE_SATURATE, type) \
+  ASMCHECK_CHECKED_POLICY(wrap    , ASMCHECK_HANDLE_WRAP    , type) \
+  ASMCHECK_CHECKED_POLICY(trap    , ASMCHECK_HANDLE_TRAP    , type)
+
+#define ASMCHECK_ARITHMETIC(type) \
+  ASMCHECK_BINARY  (mul    , * , type) \
+  ASMCHECK_BINARY  (div    , / , type) \
+  ASMCHECK_BINARY  (add    , + , type) \
+  ASMCHECK_BINARY  (sub    , - , type) \
+  ASMCHECK_COMPOUND(mul_eq , *=, type) \
+  ASMCHECK_COMPOUND(div_eq , /=, type) \
+  ASMCHECK_COMPOUND(add_eq , +=, type) \
+  ASMCHECK_COMPOUND(sub_eq , -=, type) \
+  ASMCHECK_UNARY   (pos    , + , type) \
+  ASMCHECK_UNARY   (neg    , - , type) \
+  ASMCHECK_STEP    (preinc , ++,   , type) \
+  ASMCHECK_STEP    (predec , --,   , type) \
+  ASMCHECK_STEP    (postinc,   , ++, type) \
+  ASMCHECK_STEP    (postdec,   , --, type) \
+  ASMCHECK_COMPARE (eq     , ==, type) \
+  ASMCHECK_COMPARE (ne     , !=, type) \
+  ASMCHECK_COMPARE (lt     , < , type) \
+  ASMCHECK_COMPARE (gt     , > , type) \
+  ASMCHECK_COMPARE (le     , <=, type) \
+  ASMCHECK_COMPARE (ge     , >=, type) \
+  ASMCHECK_LOGICAL (type) \
+  ASMCHECK_MIXED   (type)
+
+#define ASMCHECK_INTEGRAL(type) \
+  ASMCHECK_ARITHMETIC(type) \
+  ASMCHECK_CHECKED_ALL(type) \
+  ASMCHECK_BINARY        (mod    , % , type) \
+  ASMCHECK_BINARY        (and    , & , type) \
+  ASMCHECK_BINARY        (xor    , ^ , type) \
+  ASMCHECK_BINARY        (or     , | , type) \
+  ASMCHECK_COMPOUND      (mod_eq , %=, type) \
+  ASMCHECK_COMPOUND      (and_eq , &=, type) \
+  ASMCHECK_COMPOUND      (xor_eq , ^=, type) \
+  ASMCHECK_COMPOUND      (or_eq  , |=, type) \
+  ASMCHECK_SHIFT         (shl    , <<, type) \
+  ASMCHECK_SHIFT         (shr    , >>, type) \
+  ASMCHECK_SHIFT_COMPOUND(shl_eq , <<=, type) \
+  ASMCHECK_SHIFT_COMPOUND(shr_eq , >>=, type) \
+  ASMCHECK_UNARY         (compl  , ~ , type)
+
+ASMCHECK_INTEGRAL  (i32)
+ASMCHECK_INTEGRAL  (u32)
+ASMCHECK_INTEGRAL  (i64)
+ASMCHECK_ARITHMETIC(f64)
@@ -0,0 +1,92 @@
+#
+# Copyright (c) 2026
+# Kyle Markley.  All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#
+# 1. Redistributions of source code must retain the above copyright notice,
+#    this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright notice,
+#    this list of conditions and the following disclaimer in the documentation
+#    and/or other materials provided with the distribution.
+# 3. Neither the name of the author nor the names of any contributors may be
+#    used to endorse or promote products derived from this software without
+#    specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+# AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+# LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+# CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+# SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+# INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+# CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+# ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+# POSSIBILITY OF SUCH DAMAGE.
+#
+
+#
+# Assembly equivalence check
+#
+# Usage: asmcheck.sh output.s compiler [flags...] source.cpp
+#
+# Compile the source to assembly, count the instructions emitted for every
+# function named asm_builtin_<op> and asm_opaque_<op>, and print one line per
+# pair.  The table is also written to output.s.txt.  Fail if any opaque
+# function has more instructions than its builtin counterpart.
+#
+# Identical code folding is disabled so that each function is emitted with
+# its own body rather than as an alias of an identical function.
+#
+
+if [ $# -lt 3 ]; then
+  echo "usage: $0 output.s compiler [flags...] source.cpp" >&2
+  exit 2
+fi
+
+output=$1
+shift
+
+"$@" -S -fno-ipa-icf -fno-asynchronous-unwind-tables -o "${output}" || exit 2
+
+awk '
+  /^asm_(builtin|opaque)_[A-Za-z0-9_]*:$/ {
+    name = substr($0, 1, length($0) - 1)
+    count[name] = 0
+    next
+  }
+  name != "" && /^[ \t]*\.size[ \t]/ { name = ""; next }
+  name != "" && /^[ \t]+[a-z]/ && !/^[ \t]+\./ { ++count[name] }
+  END {
+    status = 0
+    checked = 0
+    for (builtin in count) {
+      if (builtin !~ /^asm_builtin_/) continue
+      op = substr(builtin, length("asm_builtin_") + 1)
+      opaque = "asm_opaque_" op
+      if (!(opaque in count)) {
+        printf "%-24s missing opaque function\n", op
+        status = 1
+        continue
+      }
+      verdict = "ok"
+      if (count[opaque] > count[builtin]) {
+        verdict = "FAIL"
+        status = 1
+      }
+      printf "%-24s builtin %3d  opaque %3d  %s\n", \
+        op, count[builtin], count[opaque], verdict
+      ++checked
+    }
+    if (checked == 0) {
+      print "no functions found" > "/dev/stderr"
+      status = 2
+    }
+    exit status
+  }
+' "${output}" > "${output}.txt"
+status=$?
+sort "${output}.txt"
+exit ${status}
@@ -0,0 +1,112 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/atomic_typedef.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "benchmark.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+//
+// Throughput of atomic_typedef under contention, against std::atomic of
+// the underlying type
+//
+
+struct sequence : opaque::numeric_typedef<std::uint64_t, sequence> {
+  using base = opaque::numeric_typedef<std::uint64_t, sequence>;
+  using base::base;
+};
+
+// The same type, updated with compare-and-exchange instead
+struct cas_sequence : opaque::numeric_typedef<std::uint64_t, cas_sequence> {
+  using base = opaque::numeric_typedef<std::uint64_t, cas_sequence>;
+  using base::base;
+};
+
+namespace opaque {
+template <> struct is_native_arithmetic<cas_sequence> : std::false_type { };
+}
+
+namespace {
+
+constexpr unsigned increments = 1 << 16;
+
+unsigned threads() {
+  const unsigned n = std::thread::hardware_concurrency();
+  return n < 2 ? 2 : n > 8 ? 8 : n;
+}
+
+template <typename F>
+void contend(F f) {
+  std::vector<std::thread> pool;
+  for (unsigned t = 0, n = threads(); t < n; ++t) {
+    pool.emplace_back([&]{
+      for (unsigned i = 0; i < increments; ++i) f();
+    });
+  }
+  for (std::thread& t : pool) t.join();
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::atomic<std::uint64_t> raw(0);
+  opaque::atomic_typedef<sequence> opaque_counter(sequence(0u));
+  opaque::atomic_typedef<cas_sequence> cas_counter(cas_sequence(0u));
+
+  s.compare("fetch_add", [&]{
+    contend([&]{ raw.fetch_add(1, std::memory_order_relaxed); });
+  }, [&]{
+    contend([&]{
+      opaque_counter.fetch_add(sequence(1u), std::memory_order_relaxed);
+    });
+  });
+  s.compare("load", [&]{
+    contend([&]{ benchmark::escape(raw.load(std::memory_order_acquire)); });
+  }, [&]{
+    contend([&]{
+      benchmark::escape(opaque_counter.load(std::memory_order_acquire));
+    });
+  });
+  s.report("fetch_add, native vs compare-exchange", [&]{
+    contend([&]{
+      opaque_counter.fetch_add(sequence(1u), std::memory_order_relaxed);
+    });
+  }, [&]{
+    contend([&]{
+      cas_counter.fetch_add(cas_sequence(1u), std::memory_order_relaxed);
+    });
+  });
+
+  return s.result();
+}
@@ -0,0 +1,149 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <vector>
+
+//
+// Throughput of mixed-type operations provided by binop::binary_operator
+//
+
+namespace {
+
+template <typename T> struct distance : opaque::numeric_typedef<T, distance<T>> {
+  using base = opaque::numeric_typedef<T, distance<T>>;
+  using base::base;
+};
+
+template <typename T> struct position
+  : opaque::experimental::position_typedef<distance<T>, position<T>> {
+  using base = opaque::experimental::position_typedef<distance<T>, position<T>>;
+  using base::base;
+};
+
+template <typename T> struct offset : opaque::numeric_typedef<T, offset<T>> {
+  using base = opaque::numeric_typedef<T, offset<T>>;
+  using base::base;
+};
+
+// Subtraction converts to the underlying type before operating
+template <typename T> struct address : opaque::numeric_typedef_base<T, address<T>>
+  , opaque::binop::addable     <address<T>, true , address<T>,  offset<T>>
+  , opaque::binop::addable     <address<T>, true ,  offset<T>, address<T>>
+  , opaque::binop::subtractable<offset<T> , false, address<T>, address<T>, T, T>
+{
+  using base = opaque::numeric_typedef_base<T, address<T>>;
+  using base::base;
+  address& operator+=(const address&) = delete;
+  address& operator-=(const address&) = delete;
+  address& operator+=(const offset<T>& o) noexcept {
+    this->value += o.value;
+    return *this;
+  }
+};
+
+constexpr std::size_t size = 1 << 16;
+constexpr unsigned passes = 16;
+
+template <typename T, typename = void>
+struct underlying { using type = T; };
+
+template <typename T>
+struct underlying<T, opaque::void_t<typename T::underlying_type>> {
+  using type = typename T::underlying_type;
+};
+
+template <typename T>
+std::vector<T> make_data(unsigned seed) {
+  using U = typename underlying<T>::type;
+  std::vector<T> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    v.emplace_back(static_cast<U>((i * 7 + seed) % 97 + 1));
+  }
+  return v;
+}
+
+// r = a + b
+template <typename R, typename A, typename B>
+void add(const std::vector<A>& a, const std::vector<B>& b, std::vector<R>& r) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) r[i] = a[i] + b[i];
+    benchmark::clobber();
+  }
+}
+
+// r = a - b
+template <typename R, typename A, typename B>
+void sub(const std::vector<A>& a, const std::vector<B>& b, std::vector<R>& r) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) r[i] = a[i] - b[i];
+    benchmark::clobber();
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  using T = std::int64_t;
+  using P = position<T>;
+  using D = distance<T>;
+  using A = address<T>;
+  using O = offset<T>;
+  benchmark::suite s(argc, argv);
+
+  auto r1 = make_data<T>(1);
+  auto r2 = make_data<T>(2);
+  auto r3 = make_data<T>(3);
+  auto p1 = make_data<P>(1);
+  auto p2 = make_data<P>(2);
+  auto d1 = make_data<D>(3);
+  auto a1 = make_data<A>(1);
+  auto a2 = make_data<A>(2);
+  auto o1 = make_data<O>(3);
+
+  s.compare("position = position + distance",
+      [&]{ add(r1, r3, r2); }, [&]{ add(p1, d1, p2); });
+  s.compare("position = distance + position",
+      [&]{ add(r3, r1, r2); }, [&]{ add(d1, p1, p2); });
+  s.compare("position = position - distance",
+      [&]{ sub(r1, r3, r2); }, [&]{ sub(p1, d1, p2); });
+  s.compare("distance = position - position",
+      [&]{ sub(r1, r2, r3); }, [&]{ sub(p1, p2, d1); });
+  s.compare("address = address + offset",
+      [&]{ add(r1, r3, r2); }, [&]{ add(a1, o1, a2); });
+  s.compare("address = offset + address",
+      [&]{ add(r3, r1, r2); }, [&]{ add(o1, a1, a2); });
+  s.compare("offset = address - address",
+      [&]{ sub(r1, r2, r3); }, [&]{ sub(a1, a2, o1); });
+
+  return s.result();
+}
@@ -0,0 +1,185 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/checked_numeric_typedef.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//
+// Throughput of checked_numeric_typedef arithmetic loops
+//
+// Each policy is compared against the builtin type checked by hand with
+// __builtin_mul_overflow and its relatives, and the cost of checking is
+// reported against the unchecked numeric_typedef.
+//
+
+namespace {
+
+template <typename T> struct num : opaque::numeric_typedef<T, num<T>> {
+  using base = opaque::numeric_typedef<T, num<T>>;
+  using base::base;
+};
+
+template <typename T, typename P>
+struct checked : opaque::checked_numeric_typedef<T, checked<T,P>, P> {
+  using base = opaque::checked_numeric_typedef<T, checked<T,P>, P>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 10;
+constexpr unsigned passes = 1024;
+
+template <typename T>
+std::vector<T> make_data(unsigned seed) {
+  std::vector<T> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    v.emplace_back(static_cast<T>((i * 7 + seed) % 97 + 1));
+  }
+  return v;
+}
+
+template <typename O, typename T>
+std::vector<O> wrap(const std::vector<T>& raw) {
+  std::vector<O> v;
+  v.reserve(raw.size());
+  for (const auto& x : raw) v.emplace_back(x);
+  return v;
+}
+
+template <typename P, typename T>
+T checked_mul(T a, T b) {
+  T r;
+  if (__builtin_mul_overflow(a, b, &r)) {
+    r = P::overflow(r, opaque::detail::is_negative(a) ==
+                       opaque::detail::is_negative(b));
+  }
+  return r;
+}
+
+template <typename P, typename T>
+T checked_add(T a, T b) {
+  T r;
+  if (__builtin_add_overflow(a, b, &r)) {
+    r = P::overflow(r, not opaque::detail::is_negative(b));
+  }
+  return r;
+}
+
+template <typename P, typename T>
+T checked_sub(T a, T b) {
+  T r;
+  if (__builtin_sub_overflow(a, b, &r)) {
+    r = P::overflow(r, opaque::detail::is_negative(b));
+  }
+  return r;
+}
+
+// c = a * b - c, which stays in range
+template <typename T>
+void multiply_sub(const std::vector<T>& a, const std::vector<T>& b,
+                  std::vector<T>& c) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) c[i] = a[i] * b[i] - c[i];
+    benchmark::clobber();
+  }
+}
+
+template <typename P, typename T>
+void multiply_sub_builtin(const std::vector<T>& a, const std::vector<T>& b,
+                          std::vector<T>& c) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) {
+      c[i] = checked_sub<P>(checked_mul<P>(a[i], b[i]), c[i]);
+    }
+    benchmark::clobber();
+  }
+}
+
+// s = sum(a)
+template <typename T>
+void sum(const std::vector<T>& a, T zero) {
+  for (unsigned p = 0; p < passes; ++p) {
+    T local = zero;
+    for (std::size_t i = 0; i < size; ++i) local += a[i];
+    benchmark::escape(local);
+  }
+}
+
+template <typename P, typename T>
+void sum_builtin(const std::vector<T>& a) {
+  for (unsigned p = 0; p < passes; ++p) {
+    T local = 0;
+    for (std::size_t i = 0; i < size; ++i) local = checked_add<P>(local, a[i]);
+    benchmark::escape(local);
+  }
+}
+
+template <typename T, typename P>
+void policy(benchmark::suite& s, const char * type, const char * name) {
+  using O = checked<T,P>;
+  auto a = make_data<T>(1);
+  auto b = make_data<T>(2);
+  auto c = make_data<T>(3);
+  auto oa = wrap<O>(a);
+  auto ob = wrap<O>(b);
+  auto oc = wrap<O>(c);
+  auto na = wrap<num<T>>(a);
+  auto nb = wrap<num<T>>(b);
+  auto nc = wrap<num<T>>(c);
+  std::string prefix = std::string(type) + " " + name;
+  s.compare((prefix + " multiply_sub").c_str(),
+      [&]{ multiply_sub_builtin<P>(a, b, c); },
+      [&]{ multiply_sub(oa, ob, oc); });
+  s.compare((prefix + " sum").c_str(),
+      [&]{ sum_builtin<P>(a); }, [&]{ sum(oa, O(0)); });
+  s.report((prefix + " multiply_sub vs unchecked").c_str(),
+      [&]{ multiply_sub(na, nb, nc); }, [&]{ multiply_sub(oa, ob, oc); });
+  s.report((prefix + " sum vs unchecked").c_str(),
+      [&]{ sum(na, num<T>(0)); }, [&]{ sum(oa, O(0)); });
+}
+
+template <typename T>
+void policies(benchmark::suite& s, const char * type) {
+  policy<T, opaque::throw_on_overflow   >(s, type, "throw");
+  policy<T, opaque::saturate_on_overflow>(s, type, "saturate");
+  policy<T, opaque::wrap_on_overflow    >(s, type, "wrap");
+  policy<T, opaque::trap_on_overflow    >(s, type, "trap");
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+  policies<std::int32_t>(s, "int32");
+  policies<std::int64_t>(s, "int64");
+  return s.result();
+}
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/convert.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+
+//
+// Throughput of the convert and convert_mutable paths
+//
+
+namespace {
+
+struct safe_int : opaque::numeric_typedef<int, safe_int> {
+  using base = opaque::numeric_typedef<int, safe_int>;
+  using base::base;
+};
+
+struct a_string
+  : opaque::experimental::safer_string_typedef<std::string, a_string> {
+  using base = opaque::experimental::safer_string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 16;
+constexpr unsigned passes = 16;
+constexpr std::size_t string_size = 1 << 12;
+constexpr unsigned string_passes = 64;
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::vector<int> raw_int;
+  std::vector<safe_int> opaque_int;
+  for (std::size_t i = 0; i < size; ++i) {
+    raw_int.emplace_back(static_cast<int>(i % 101));
+    opaque_int.emplace_back(static_cast<int>(i % 101));
+  }
+
+  s.compare("convert<U>(const O&)", [&]{
+    int sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : raw_int) sum += x;
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    int sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : opaque_int) sum += opaque::convert<int>(x);
+      benchmark::escape(sum);
+    }
+  });
+
+  s.compare("convert_mutable<U>(const O&)", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (auto& x : raw_int) {
+        int m = x;
+        m += 1;
+        x = m;
+      }
+      benchmark::clobber();
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (auto& x : opaque_int) {
+        const safe_int& c = x;
+        int m = opaque::convert_mutable<int>(c);
+        m += 1;
+        x.value = m;
+      }
+      benchmark::clobber();
+    }
+  });
+
+  std::vector<std::string> raw_string;
+  std::vector<a_string> opaque_string;
+  for (std::size_t i = 0; i < string_size; ++i) {
+    std::string str(32 + i % 16, static_cast<char>('a' + i % 26));
+    raw_string.emplace_back(str);
+    opaque_string.emplace_back(str);
+  }
+
+  s.compare("convert_mutable<S>(const O&) copy", [&]{
+    for (unsigned p = 0; p < string_passes; ++p) {
+      for (const auto& x : raw_string) {
+        std::string m = x;
+        benchmark::escape(m);
+      }
+    }
+  }, [&]{
+    for (unsigned p = 0; p < string_passes; ++p) {
+      for (const auto& x : opaque_string) {
+        std::string m = opaque::convert_mutable<std::string>(x);
+        benchmark::escape(m);
+      }
+    }
+  });
+
+  s.compare("convert_mutable<S>(O&&) move", [&]{
+    for (unsigned p = 0; p < string_passes; ++p) {
+      for (auto& x : raw_string) {
+        std::string m = std::move(x);
+        benchmark::escape(m);
+        x = std::move(m);
+      }
+    }
+  }, [&]{
+    for (unsigned p = 0; p < string_passes; ++p) {
+      for (auto& x : opaque_string) {
+        std::string m = opaque::convert_mutable<std::string>(std::move(x));
+        benchmark::escape(m);
+        x.value = std::move(m);
+      }
+    }
+  });
+
+  return s.result();
+}
@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/fixed_point_typedef.hpp"
+#include "opaque/format.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+//
+// Throughput of fixed_point_typedef against integers scaled by hand, whose
+// scale is a run-time divisor, and of its formatting against printf
+//
+
+struct price : opaque::fixed_point_typedef<std::int64_t, 16, price> {
+  using base = opaque::fixed_point_typedef<std::int64_t, 16, price>;
+  using base::base;
+};
+
+struct notional : opaque::fixed_point_typedef<std::int64_t, 24, notional> {
+  using base = opaque::fixed_point_typedef<std::int64_t, 24, notional>;
+  using base::base;
+};
+
+struct quantity : opaque::fixed_point_typedef<std::int32_t, 0, quantity>
+  , opaque::binop::multipliable<notional, true, price, quantity,
+                                notional, notional> {
+  using base = opaque::fixed_point_typedef<std::int32_t, 0, quantity>;
+  using base::base;
+};
+
+namespace {
+
+constexpr std::size_t size = 1 << 12;
+constexpr unsigned passes = 64;
+
+// Prices in ten-thousandths, and the scale of notionals relative to them
+std::int64_t price_scale = 10000;
+std::int64_t notional_scale = 100;
+
+std::vector<std::int64_t> make_prices() {
+  std::vector<std::int64_t> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    v.push_back(static_cast<std::int64_t>((i * 7919) % 2000000) - 1000000);
+  }
+  return v;
+}
+
+std::vector<std::int32_t> make_quantities() {
+  std::vector<std::int32_t> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    v.push_back(static_cast<std::int32_t>((i * 104729) % 5000));
+  }
+  return v;
+}
+
+std::vector<price> to_price(const std::vector<std::int64_t>& raw) {
+  std::vector<price> v;
+  v.reserve(raw.size());
+  for (auto x : raw) {
+    v.push_back(price::from_floating(static_cast<double>(x) /
+                                     static_cast<double>(price_scale)));
+  }
+  return v;
+}
+
+std::vector<quantity> to_quantity(const std::vector<std::int32_t>& raw) {
+  std::vector<quantity> v;
+  v.reserve(raw.size());
+  for (auto x : raw) v.emplace_back(x);
+  return v;
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+  benchmark::escape(price_scale);
+  benchmark::escape(notional_scale);
+  const auto raw_prices = make_prices();
+  const auto raw_quantities = make_quantities();
+  const auto prices = to_price(raw_prices);
+  const auto quantities = to_quantity(raw_quantities);
+
+  std::vector<std::int64_t> raw_out(size);
+  std::vector<notional> notionals(size);
+  s.compare("price * quantity -> notional",
+    [&]{
+      for (unsigned p = 0; p < passes; ++p) {
+        for (std::size_t i = 0; i < size; ++i) {
+          raw_out[i] = raw_prices[i] * raw_quantities[i] * notional_scale /
+                       price_scale;
+        }
+        benchmark::clobber();
+      }
+    },
+    [&]{
+      for (unsigned p = 0; p < passes; ++p) {
+        for (std::size_t i = 0; i < size; ++i) {
+          notionals[i] = prices[i] * quantities[i];
+        }
+        benchmark::clobber();
+      }
+    });
+
+  std::vector<price> products(size);
+  s.compare("price * price",
+    [&]{
+      for (unsigned p = 0; p < passes; ++p) {
+        for (std::size_t i = 0; i < size; ++i) {
+          raw_out[i] = raw_prices[i] * raw_prices[size - 1 - i] /
+                       price_scale;
+        }
+        benchmark::clobber();
+      }
+    },
+    [&]{
+      for (unsigned p = 0; p < passes; ++p) {
+        for (std::size_t i = 0; i < size; ++i) {
+          products[i] = prices[i] * prices[size - 1 - i];
+        }
+        benchmark::clobber();
+      }
+    });
+
+  std::vector<char> buffer(size * 32);
+  s.compare("format to four places",
+    [&]{
+      char * out = buffer.data();
+      for (auto x : raw_prices) {
+        out += std::snprintf(out, 32, "%.4f\n", static_cast<double>(x) /
+                             static_cast<double>(price_scale));
+      }
+      benchmark::escape(buffer);
+    },
+    [&]{
+      struct four : opaque::default_format_traits {
+        static constexpr const char * suffix() noexcept { return "\n"; }
+        static constexpr int precision() noexcept { return 4; }
+      };
+      char * out = buffer.data();
+      char * const last = out + buffer.size();
+      for (const auto& x : prices) {
+        out = opaque::format_to<price, four>(out, last, x).ptr;
+      }
+      benchmark::escape(buffer);
+    });
+  s.report("format shortest",
+    [&]{
+      char * out = buffer.data();
+      for (auto x : raw_prices) {
+        out += std::snprintf(out, 32, "%.4f\n", static_cast<double>(x) /
+                             static_cast<double>(price_scale));
+      }
+      benchmark::escape(buffer);
+    },
+    [&]{
+      char * out = buffer.data();
+      char * const last = out + buffer.size();
+      for (const auto& x : prices) {
+        out = opaque::to_chars(out, last, x).ptr;
+        *out++ = '\n';
+      }
+      benchmark::escape(buffer);
+    });
+  return s.result();
+}
@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flat_map.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+//
+// flat_map against std::unordered_map, both keyed by an opaque identifier
+// with the same hash.  The baseline column is std::unordered_map.
+//
+
+struct order_id : opaque::numeric_typedef<std::uint64_t, order_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, order_id>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(order_id)
+
+namespace {
+
+constexpr std::size_t size = 1 << 18;
+constexpr unsigned passes = 4;
+
+template <typename M>
+void lookup(const M& map, const std::vector<order_id>& keys) {
+  std::size_t found = 0;
+  for (unsigned p = 0; p < passes; ++p) {
+    for (const auto& key : keys) found += map.count(key);
+    benchmark::escape(found);
+  }
+}
+
+template <typename M>
+void build(const std::vector<order_id>& keys) {
+  M map;
+  for (const auto& key : keys) map[key] = 1;
+  benchmark::escape(map);
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::vector<order_id> keys, probes;
+  for (std::size_t i = 0; i < size; ++i) {
+    keys.emplace_back(i * 2);
+    probes.emplace_back(i * 3);
+  }
+  std::mt19937 rng(1);
+  std::shuffle(keys.begin(), keys.end(), rng);
+  std::shuffle(probes.begin(), probes.end(), rng);
+
+  std::unordered_map<order_id, unsigned> node_map;
+  opaque::flat_map<order_id, unsigned> flat_map;
+  for (const auto& key : keys) {
+    node_map[key] = 1;
+    flat_map[key] = 1;
+  }
+
+  s.compare("flat_map<id> lookup",
+      [&]{ lookup(node_map, probes); },
+      [&]{ lookup(flat_map, probes); });
+  s.compare("flat_map<id> insert",
+      [&]{ build<std::unordered_map<order_id, unsigned>>(keys); },
+      [&]{ build<opaque::flat_map<order_id, unsigned>>(keys); });
+
+  return s.result();
+}
@@ -0,0 +1,109 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/format.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/ostream.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <sstream>
+#include <vector>
+
+//
+// Throughput of format_to against operator<< for writing log lines
+//
+
+struct quantity : opaque::numeric_typedef<std::int64_t, quantity> {
+  using base = opaque::numeric_typedef<std::int64_t, quantity>;
+  using base::base;
+};
+
+struct meters : opaque::numeric_typedef<double, meters> {
+  using base = opaque::numeric_typedef<double, meters>;
+  using base::base;
+};
+
+namespace opaque {
+template <> struct format_traits<meters> : default_format_traits {
+  static constexpr const char * suffix() noexcept { return " m"; }
+};
+}
+
+namespace {
+
+constexpr std::size_t size = 1 << 14;
+constexpr unsigned passes = 4;
+
+// Write each value on its own line through an ostream
+template <typename T>
+void stream(const std::vector<T>& values, const char * suffix) {
+  std::ostringstream out;
+  for (unsigned p = 0; p < passes; ++p) {
+    out.str(std::string());
+    for (const auto& v : values) out << v << suffix << '\n';
+    benchmark::escape(out);
+  }
+}
+
+// Write each value on its own line into a buffer
+template <typename T>
+void format(const std::vector<T>& values, std::vector<char>& buffer) {
+  for (unsigned p = 0; p < passes; ++p) {
+    char * out = buffer.data();
+    char * const last = out + buffer.size();
+    for (const auto& v : values) {
+      out = opaque::format_to(out, last, v).ptr;
+      if (out != last) *out++ = '\n';
+    }
+    benchmark::escape(out);
+    benchmark::clobber();
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::vector<quantity> quantities;
+  std::vector<meters> distances;
+  std::uint64_t x = 88172645463325252u;
+  for (std::size_t i = 0; i < size; ++i) {
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+    quantities.emplace_back(static_cast<std::int64_t>(x >> (x % 48)));
+    distances.emplace_back(static_cast<double>(x % 1000000) / 64.0);
+  }
+  std::vector<char> buffer(size * 40);
+
+  s.compare("integer", [&]{ stream(quantities, ""); },
+                       [&]{ format(quantities, buffer); });
+  s.compare("floating point", [&]{ stream(distances, " m"); },
+                              [&]{ format(distances, buffer); });
+
+  return s.result();
+}
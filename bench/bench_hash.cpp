@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// Throughput of unordered_map lookups keyed by OPAQUE_HASHABLE types
+//
+
+struct safe_id : opaque::numeric_typedef<std::uint64_t, safe_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, safe_id>;
+  using base::base;
+};
+
+struct a_string : opaque::experimental::string_typedef<std::string, a_string> {
+  using base = opaque::experimental::string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(safe_id)
+OPAQUE_HASHABLE(a_string)
+
+namespace {
+
+constexpr std::size_t size = 1 << 16;
+constexpr unsigned passes = 4;
+
+template <typename M, typename K>
+void lookup(const M& map, const std::vector<K>& keys) {
+  std::size_t found = 0;
+  for (unsigned p = 0; p < passes; ++p) {
+    for (const auto& key : keys) found += map.count(key);
+    benchmark::escape(found);
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::unordered_map<std::uint64_t, unsigned> raw_id_map;
+  std::unordered_map<safe_id, unsigned> opaque_id_map;
+  std::vector<std::uint64_t> raw_ids;
+  std::vector<safe_id> opaque_ids;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::uint64_t id = i * 2;
+    raw_id_map.emplace(id, 0u);
+    opaque_id_map.emplace(safe_id(id), 0u);
+    raw_ids.emplace_back(i * 3);
+    opaque_ids.emplace_back(i * 3);
+  }
+  s.compare("unordered_map<uint64_t> lookup",
+      [&]{ lookup(raw_id_map, raw_ids); },
+      [&]{ lookup(opaque_id_map, opaque_ids); });
+
+  std::unordered_map<std::string, unsigned> raw_string_map;
+  std::unordered_map<a_string, unsigned> opaque_string_map;
+  std::vector<std::string> raw_strings;
+  std::vector<a_string> opaque_strings;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::string key = "instrument." + std::to_string(i * 2);
+    raw_string_map.emplace(key, 0u);
+    opaque_string_map.emplace(a_string(key), 0u);
+    std::string probe = "instrument." + std::to_string(i * 3);
+    raw_strings.emplace_back(probe);
+    opaque_strings.emplace_back(probe);
+  }
+  s.compare("unordered_map<string> lookup",
+      [&]{ lookup(raw_string_map, raw_strings); },
+      [&]{ lookup(opaque_string_map, opaque_strings); });
+
+  return s.result();
+}
@@ -0,0 +1,187 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// Lookup throughput with the opaque::hashing policies.  The baseline
+// column is the default policy for the key (std::hash, or the identity),
+// and the second column is the alternative policy.  Each policy suits
+// some keys better than others, so the ratios are reported and not
+// checked against the threshold.
+//
+
+struct safe_id : opaque::numeric_typedef<std::uint64_t, safe_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, safe_id>;
+  using base::base;
+};
+
+struct a_string : opaque::experimental::string_typedef<std::string, a_string> {
+  using base = opaque::experimental::string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+namespace {
+
+constexpr unsigned passes = 4;
+
+// Open addressing with linear probing, keeping the low bits of the hash
+template <typename K, typename H>
+class flat_set {
+public:
+  explicit flat_set(std::size_t n) : mask(1), keys(), used() {
+    while (mask < 2 * n) mask <<= 1;
+    keys.resize(mask);
+    used.resize(mask);
+    --mask;
+  }
+  void insert(const K& key) {
+    for (std::size_t i = H{}(key) & mask; ; i = (i + 1) & mask) {
+      if (not used[i]) {
+        used[i] = 1;
+        keys[i] = key;
+        return;
+      }
+      if (keys[i] == key) return;
+    }
+  }
+  std::size_t count(const K& key) const {
+    for (std::size_t i = H{}(key) & mask; used[i]; i = (i + 1) & mask) {
+      if (keys[i] == key) return 1;
+    }
+    return 0;
+  }
+private:
+  std::size_t mask;
+  std::vector<K> keys;
+  std::vector<unsigned char> used;
+};
+
+template <typename M, typename K>
+void lookup(const M& map, const std::vector<K>& keys) {
+  std::size_t found = 0;
+  for (unsigned p = 0; p < passes; ++p) {
+    for (const auto& key : keys) found += map.count(key);
+    benchmark::escape(found);
+  }
+}
+
+// Half of the probes are present, in no particular order
+template <typename K, typename F>
+std::vector<K> probes(std::size_t n, F key) {
+  std::vector<K> v;
+  for (std::size_t i = 0; i < n; ++i) v.push_back(key(i * 3));
+  std::shuffle(v.begin(), v.end(), std::mt19937(1));
+  return v;
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+  using namespace opaque::hashing;
+
+  {
+    // Dense identifiers are best left alone in node-based maps, which
+    // reduce modulo a prime, because neighbouring keys stay together.
+    // Sparse identifiers have no such locality to lose.
+    constexpr std::size_t size = 1 << 16;
+    auto dense = [](std::size_t i) { return safe_id(i * 2); };
+    auto sparse = [](std::size_t i) {
+      return safe_id(opaque::hashing::mix_bits(i * 2)); };
+    std::unordered_map<safe_id, unsigned, standard> dense_standard;
+    std::unordered_map<safe_id, unsigned, mix> dense_mix;
+    std::unordered_map<safe_id, unsigned, standard> sparse_standard;
+    std::unordered_map<safe_id, unsigned, mix> sparse_mix;
+    for (std::size_t i = 0; i < size; ++i) {
+      dense_standard.emplace(dense(i), 0u);
+      dense_mix.emplace(dense(i), 0u);
+      sparse_standard.emplace(sparse(i), 0u);
+      sparse_mix.emplace(sparse(i), 0u);
+    }
+    auto dense_keys = probes<safe_id>(size, dense);
+    auto sparse_keys = probes<safe_id>(size, sparse);
+    s.report("unordered_map<dense id> standard/mix",
+        [&]{ lookup(dense_standard, dense_keys); },
+        [&]{ lookup(dense_mix, dense_keys); });
+    s.report("unordered_map<sparse id> standard/mix",
+        [&]{ lookup(sparse_standard, sparse_keys); },
+        [&]{ lookup(sparse_mix, sparse_keys); });
+  }
+
+  {
+    // Identifiers sharing their low bits, as for aligned addresses or
+    // identifiers with a type tag in the low bits
+    constexpr std::size_t size = 1 << 12;
+    auto key = [](std::size_t i) { return safe_id(i << 4); };
+    flat_set<safe_id, identity> identity_set(size);
+    flat_set<safe_id, mix> mix_set(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      identity_set.insert(key(i * 2));
+      mix_set.insert(key(i * 2));
+    }
+    auto keys = probes<safe_id>(size, key);
+    s.report("flat_set<strided id> identity/mix",
+        [&]{ lookup(identity_set, keys); },
+        [&]{ lookup(mix_set, keys); });
+  }
+
+  {
+    constexpr std::size_t size = 1 << 14;
+    auto key = [](std::size_t i) {
+      return a_string("instrument.venue." + std::to_string(i)); };
+    std::unordered_map<a_string, unsigned, standard> standard_map;
+    std::unordered_map<a_string, unsigned, bytes> bytes_map;
+    flat_set<a_string, standard> standard_set(size);
+    flat_set<a_string, bytes> bytes_set(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      standard_map.emplace(key(i * 2), 0u);
+      bytes_map.emplace(key(i * 2), 0u);
+      standard_set.insert(key(i * 2));
+      bytes_set.insert(key(i * 2));
+    }
+    auto keys = probes<a_string>(size, key);
+    s.report("unordered_map<string> standard/bytes",
+        [&]{ lookup(standard_map, keys); },
+        [&]{ lookup(bytes_map, keys); });
+    s.report("flat_set<string> standard/bytes",
+        [&]{ lookup(standard_set, keys); },
+        [&]{ lookup(bytes_set, keys); });
+  }
+
+  return s.result();
+}
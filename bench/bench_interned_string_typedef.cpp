@@ -0,0 +1,127 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/interned_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "benchmark.hpp"
+#include <functional>
+#include <string>
+#include <vector>
+
+//
+// Throughput of interned_string_typedef equality, hashing and copying,
+// against std::string
+//
+
+namespace {
+
+struct symbol
+  : opaque::experimental::interned_string_typedef<symbol> {
+  using base = opaque::experimental::interned_string_typedef<symbol>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 12;
+constexpr unsigned passes = 16;
+
+}
+
+OPAQUE_HASHABLE(symbol)
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::vector<std::string> raw;
+  std::vector<symbol> interned;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::string str = "instrument_code_" + std::to_string(i % 512);
+    raw.emplace_back(str);
+    interned.emplace_back(str);
+  }
+
+  s.compare("operator==", [&]{
+    std::size_t equal = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 512; i < size; ++i) equal += raw[i - 512] == raw[i];
+      benchmark::escape(equal);
+    }
+  }, [&]{
+    std::size_t equal = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 512; i < size; ++i) {
+        equal += interned[i - 512] == interned[i];
+      }
+      benchmark::escape(equal);
+    }
+  });
+
+  s.compare("hash", [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : raw) sum += std::hash<std::string>{}(x);
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : interned) sum += std::hash<symbol>{}(x);
+      benchmark::escape(sum);
+    }
+  });
+
+  s.compare("copy", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      std::vector<std::string> out(raw);
+      benchmark::escape(out);
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      std::vector<symbol> out(interned);
+      benchmark::escape(out);
+    }
+  });
+
+  // Interning a present string costs a hash and a lock-free probe
+  s.report("intern", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : raw) {
+        std::string copy(x);
+        benchmark::escape(copy);
+      }
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& x : raw) {
+        symbol copy(x);
+        benchmark::escape(copy);
+      }
+    }
+  });
+
+  return s.result();
+}
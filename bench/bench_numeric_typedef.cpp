@@ -0,0 +1,160 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/numeric_typedef.hpp"
+#include "benchmark.hpp"
+#include <cstdint>
+#include <vector>
+
+//
+// Throughput of numeric_typedef arithmetic loops
+//
+
+namespace {
+
+template <typename T> struct num : opaque::numeric_typedef<T, num<T>> {
+  using base = opaque::numeric_typedef<T, num<T>>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 10;
+constexpr unsigned passes = 1024;
+
+template <typename T>
+std::vector<T> make_data(unsigned seed) {
+  std::vector<T> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    v.emplace_back(static_cast<T>((i * 7 + seed) % 97 + 1));
+  }
+  return v;
+}
+
+template <typename T>
+std::vector<num<T>> wrap(const std::vector<T>& raw) {
+  std::vector<num<T>> v;
+  v.reserve(raw.size());
+  for (const auto& x : raw) v.emplace_back(x);
+  return v;
+}
+
+// c = a * b + c
+template <typename T>
+void multiply_add(const std::vector<T>& a, const std::vector<T>& b,
+                  std::vector<T>& c) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) c[i] = a[i] * b[i] + c[i];
+    benchmark::clobber();
+  }
+}
+
+// c -= a; c += b
+template <typename T>
+void compound(const std::vector<T>& a, const std::vector<T>& b,
+              std::vector<T>& c) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) { c[i] -= a[i]; c[i] += b[i]; }
+    benchmark::clobber();
+  }
+}
+
+// s = sum(a)
+template <typename T>
+void sum(const std::vector<T>& a, T& s) {
+  for (unsigned p = 0; p < passes; ++p) {
+    T local = s;
+    for (std::size_t i = 0; i < size; ++i) local += a[i];
+    s = local;
+    benchmark::escape(s);
+  }
+}
+
+// c = (a & b) ^ (c | a)
+template <typename T>
+void bitwise(const std::vector<T>& a, const std::vector<T>& b,
+             std::vector<T>& c) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) c[i] = (a[i] & b[i]) ^ (c[i] | a[i]);
+    benchmark::clobber();
+  }
+}
+
+// a = (a << 1) | (a >> 3)
+template <typename T>
+void shift(std::vector<T>& a) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) a[i] = (a[i] << 1u) | (a[i] >> 3u);
+    benchmark::clobber();
+  }
+}
+
+template <typename T>
+void arithmetic(benchmark::suite& s, const char * type) {
+  auto a = make_data<T>(1);
+  auto b = make_data<T>(2);
+  auto c = make_data<T>(3);
+  auto oa = wrap(a);
+  auto ob = wrap(b);
+  auto oc = wrap(c);
+  std::string prefix = type;
+  s.compare((prefix + " multiply_add").c_str(),
+      [&]{ multiply_add(a, b, c); }, [&]{ multiply_add(oa, ob, oc); });
+  s.compare((prefix + " compound").c_str(),
+      [&]{ compound(a, b, c); }, [&]{ compound(oa, ob, oc); });
+  T rs(0);
+  num<T> os(0);
+  s.compare((prefix + " sum").c_str(),
+      [&]{ sum(a, rs); }, [&]{ sum(oa, os); });
+}
+
+template <typename T>
+void integral(benchmark::suite& s, const char * type) {
+  arithmetic<T>(s, type);
+  auto a = make_data<T>(1);
+  auto b = make_data<T>(2);
+  auto c = make_data<T>(3);
+  auto oa = wrap(a);
+  auto ob = wrap(b);
+  auto oc = wrap(c);
+  std::string prefix = type;
+  s.compare((prefix + " bitwise").c_str(),
+      [&]{ bitwise(a, b, c); }, [&]{ bitwise(oa, ob, oc); });
+  s.compare((prefix + " shift").c_str(),
+      [&]{ shift(a); }, [&]{ shift(oa); });
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+  integral<int>(s, "int");
+  integral<unsigned>(s, "unsigned");
+  integral<std::int64_t>(s, "int64_t");
+  arithmetic<double>(s, "double");
+  return s.result();
+}
@@ -0,0 +1,116 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/parse.hpp"
+#include "benchmark.hpp"
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+//
+// Throughput of parse_column against parsing the underlying type with
+// strtoll and strtod, then constructing
+//
+
+struct quantity : opaque::numeric_typedef<std::int64_t, quantity> {
+  using base = opaque::numeric_typedef<std::int64_t, quantity>;
+  using base::base;
+};
+
+struct meters : opaque::numeric_typedef<double, meters> {
+  using base = opaque::numeric_typedef<double, meters>;
+  using base::base;
+};
+
+namespace {
+
+constexpr std::size_t size = 1 << 14;
+constexpr unsigned passes = 4;
+
+// The usual call site: parse, check, construct
+template <typename O, typename F>
+void strto(const std::string& text, std::vector<O>& out, F parse) {
+  for (unsigned p = 0; p < passes; ++p) {
+    const char * s = text.c_str();
+    std::size_t n = 0;
+    while (*s and n != out.size()) {
+      char * end;
+      errno = 0;
+      const auto v = parse(s, &end);
+      if (end == s or errno == ERANGE) break;
+      out[n++] = O(v);
+      s = *end ? end + 1 : end;
+    }
+    benchmark::escape(n);
+    benchmark::clobber();
+  }
+}
+
+template <typename O>
+void column(const std::string& text, std::vector<O>& out) {
+  for (unsigned p = 0; p < passes; ++p) {
+    const opaque::parse_column_result r = opaque::parse_column(
+        text.data(), text.data() + text.size(), '\n', opaque::span<O>(out));
+    benchmark::escape(r.count);
+    benchmark::clobber();
+  }
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::string integers, decimals;
+  std::uint64_t x = 88172645463325252u;
+  for (std::size_t i = 0; i < size; ++i) {
+    x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+    integers += std::to_string(static_cast<std::int64_t>(x >> (x % 48)));
+    integers += '\n';
+    decimals += std::to_string(x % 1000000) + '.' + std::to_string(x % 100);
+    decimals += '\n';
+  }
+  std::vector<quantity> quantities(size);
+  std::vector<meters> distances(size);
+
+  s.compare("integer", [&]{
+    strto(integers, quantities, [](const char * p, char ** end) {
+      return std::strtoll(p, end, 10);
+    });
+  }, [&]{ column(integers, quantities); });
+  s.compare("floating point", [&]{
+    strto(decimals, distances, [](const char * p, char ** end) {
+      return std::strtod(p, end);
+    });
+  }, [&]{ column(decimals, distances); });
+
+  return s.result();
+}
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/concat.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "benchmark.hpp"
+#include <string>
+#include <vector>
+
+//
+// Throughput of safer_string_typedef append, concatenation, search and
+// compare
+//
+
+namespace {
+
+struct a_string
+  : opaque::experimental::safer_string_typedef<std::string, a_string> {
+  using base = opaque::experimental::safer_string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 12;
+constexpr unsigned passes = 16;
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::vector<std::string> raw;
+  std::vector<a_string> opaque;
+  for (std::size_t i = 0; i < size; ++i) {
+    std::string str = "field_" + std::to_string(i % 512);
+    raw.emplace_back(str);
+    opaque.emplace_back(str);
+  }
+
+  s.compare("append", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      std::string out;
+      for (const auto& x : raw) { out.append(x); out += ','; }
+      benchmark::escape(out);
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      a_string out;
+      for (const auto& x : opaque) { out.append(x); out += ','; }
+      benchmark::escape(out);
+    }
+  });
+
+  s.compare("operator+", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) {
+        std::string out = raw[i - 1] + raw[i];
+        benchmark::escape(out);
+      }
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) {
+        a_string out = opaque[i - 1] + opaque[i];
+        benchmark::escape(out);
+      }
+    }
+  });
+
+  // A chain of operator+ against a single allocation
+  const std::string raw_root("/var/log/service/"), raw_ext(".log");
+  const a_string root(raw_root), ext(raw_ext);
+  s.compare("concat", [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) {
+        std::string out = raw_root + raw[i - 1] + '/' + raw[i] + raw_ext;
+        benchmark::escape(out);
+      }
+    }
+  }, [&]{
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) {
+        a_string out = opaque::experimental::concat(
+            root, opaque[i - 1], '/', opaque[i], ext);
+        benchmark::escape(out);
+      }
+    }
+  });
+
+  s.compare("compare", [&]{
+    int sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) sum += raw[i - 1].compare(raw[i]);
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    int sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 1; i < size; ++i) sum += opaque[i - 1].compare(opaque[i]);
+      benchmark::escape(sum);
+    }
+  });
+
+  s.compare("operator==", [&]{
+    std::size_t equal = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 512; i < size; ++i) equal += raw[i - 512] == raw[i];
+      benchmark::escape(equal);
+    }
+  }, [&]{
+    std::size_t equal = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (std::size_t i = 512; i < size; ++i) equal += opaque[i - 512] == opaque[i];
+      benchmark::escape(equal);
+    }
+  });
+
+  // Searches through multi-kilobyte messages
+  std::vector<std::string> raw_messages;
+  std::vector<a_string> messages;
+  for (std::size_t i = 0; i < 64; ++i) {
+    std::string m;
+    while (m.size() < 4096 + i) m += "kind=info;";
+    m += "key=value\n";
+    raw_messages.emplace_back(m);
+    messages.emplace_back(m);
+  }
+
+  s.compare("find", [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : raw_messages) sum += m.find("key=");
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : messages) sum += m.find("key=");
+      benchmark::escape(sum);
+    }
+  });
+
+  s.compare("find_first_of", [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : raw_messages) sum += m.find_first_of("\t\r\n");
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : messages) sum += m.find_first_of("\t\r\n");
+      benchmark::escape(sum);
+    }
+  });
+
+  const char alnum[] = "abcdefghijklmnopqrstuvwxyz0123456789=;";
+  s.compare("find_first_not_of", [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : raw_messages) sum += m.find_first_not_of(alnum);
+      benchmark::escape(sum);
+    }
+  }, [&]{
+    std::size_t sum = 0;
+    for (unsigned p = 0; p < passes; ++p) {
+      for (const auto& m : messages) sum += m.find_first_not_of(alnum);
+      benchmark::escape(sum);
+    }
+  });
+
+  return s.result();
+}
@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/saturating_typedef.hpp"
+#include "opaque/binop/binop_batch.hpp"
+#include "benchmark.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+//
+// Throughput of saturating_typedef, scalar and in batches, against the
+// underlying type clamped by hand
+//
+
+namespace {
+
+template <typename T> struct sat : opaque::saturating_typedef<T, sat<T>> {
+  using base = opaque::saturating_typedef<T, sat<T>>;
+  using base::base;
+};
+
+constexpr std::size_t size = 1 << 12;
+constexpr unsigned passes = 256;
+
+template <typename T>
+std::vector<T> make_data(unsigned seed) {
+  using L = std::numeric_limits<T>;
+  const long long span = static_cast<long long>(L::max()) - L::min() + 1;
+  std::vector<T> v;
+  v.reserve(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    const long long x = static_cast<long long>((i * 7919 + seed) % 65521);
+    v.emplace_back(static_cast<T>(L::min() + x % span));
+  }
+  return v;
+}
+
+template <typename O, typename T>
+std::vector<O> wrap(const std::vector<T>& raw) {
+  std::vector<O> v;
+  v.reserve(raw.size());
+  for (const auto& x : raw) v.emplace_back(x);
+  return v;
+}
+
+// The result of a wide operation, clamped to T
+template <typename T, typename W>
+T clamp(W v) {
+  using L = std::numeric_limits<T>;
+  return static_cast<T>(std::min<W>(std::max<W>(v, L::min()), L::max()));
+}
+
+struct plus {
+  template <typename W> static W wide(W a, W b) { return a + b; }
+  template <typename O> static O apply(const O& a, const O& b) {
+    return a + b; }
+  template <typename O> using mixin = opaque::binop::addable<O>;
+};
+struct times {
+  template <typename W> static W wide(W a, W b) { return a * b; }
+  template <typename O> static O apply(const O& a, const O& b) {
+    return a * b; }
+  template <typename O> using mixin = opaque::binop::multipliable<O>;
+};
+
+// o = clamp(a @ b) on the underlying type
+template <typename Op, typename W, typename T>
+void by_hand(const std::vector<T>& a, const std::vector<T>& b,
+             std::vector<T>& o) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) {
+      o[i] = clamp<T>(Op::wide(static_cast<W>(a[i]), static_cast<W>(b[i])));
+    }
+    benchmark::clobber();
+  }
+}
+
+// o = a @ b with the operator of the opaque type
+template <typename Op, typename O>
+void scalar(const std::vector<O>& a, const std::vector<O>& b,
+            std::vector<O>& o) {
+  for (unsigned p = 0; p < passes; ++p) {
+    for (std::size_t i = 0; i < size; ++i) o[i] = Op::apply(a[i], b[i]);
+    benchmark::clobber();
+  }
+}
+
+// o = a @ b as a batch operation
+template <typename Op, typename O>
+void batch(const std::vector<O>& a, const std::vector<O>& b,
+           std::vector<O>& o) {
+  for (unsigned p = 0; p < passes; ++p) {
+    opaque::binop::apply<typename Op::template mixin<O>>(o, a, b);
+    benchmark::clobber();
+  }
+}
+
+template <typename Op, typename T, typename W>
+void operation(benchmark::suite& s, const char * name) {
+  using O = sat<T>;
+  auto a = make_data<T>(1);
+  auto b = make_data<T>(2);
+  std::vector<T> o(size);
+  auto oa = wrap<O>(a);
+  auto ob = wrap<O>(b);
+  std::vector<O> oo(size);
+  std::string prefix = name;
+  s.compare((prefix + " batch").c_str(),
+      [&]{ by_hand<Op,W>(a, b, o); }, [&]{ batch<Op>(oa, ob, oo); });
+  s.report((prefix + " scalar").c_str(),
+      [&]{ by_hand<Op,W>(a, b, o); }, [&]{ scalar<Op>(oa, ob, oo); });
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+  operation<plus , std::int8_t  , int      >(s, "int8 add");
+  operation<plus , std::uint8_t , int      >(s, "uint8 add");
+  operation<plus , std::int16_t , int      >(s, "int16 add");
+  operation<plus , std::uint16_t, int      >(s, "uint16 add");
+  operation<times, std::int16_t , int      >(s, "int16 mul");
+  operation<plus , std::int32_t , long long>(s, "int32 add");
+  operation<times, std::int32_t , long long>(s, "int32 mul");
+  return s.result();
+}
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/sharded_counter.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "benchmark.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//
+// Scaling of sharded_counter from one thread to the hardware concurrency,
+// against a single std::atomic and a mutex-protected counter
+//
+
+struct requests : opaque::numeric_typedef<std::uint64_t, requests> {
+  using base = opaque::numeric_typedef<std::uint64_t, requests>;
+  using base::base;
+};
+
+namespace {
+
+constexpr unsigned increments = 1 << 16;
+
+template <typename F>
+void contend(unsigned threads, F f) {
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&]{
+      for (unsigned i = 0; i < increments; ++i) f();
+    });
+  }
+  for (std::thread& t : pool) t.join();
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  std::atomic<std::uint64_t> raw(0);
+  std::mutex lock;
+  std::uint64_t locked = 0;
+  opaque::sharded_counter<requests> sharded;
+
+  const unsigned hardware = std::thread::hardware_concurrency();
+  const unsigned most = hardware < 2 ? 2 : hardware;
+  for (unsigned threads = 1; threads <= most; threads *= 2) {
+    char name[64];
+    auto add = [&]{
+      contend(threads, [&]{ sharded.add(requests(1u)); });
+    };
+    std::snprintf(name, sizeof name, "add vs atomic, %u threads", threads);
+    s.compare(name, [&]{
+      contend(threads, [&]{ raw.fetch_add(1, std::memory_order_relaxed); });
+    }, add);
+    std::snprintf(name, sizeof name, "add vs mutex, %u threads", threads);
+    s.compare(name, [&]{
+      contend(threads, [&]{
+        std::lock_guard<std::mutex> guard(lock);
+        ++locked;
+      });
+    }, add);
+  }
+  s.report("load vs atomic", [&]{
+    for (unsigned i = 0; i < increments; ++i) {
+      benchmark::escape(raw.load(std::memory_order_relaxed));
+    }
+  }, [&]{
+    for (unsigned i = 0; i < increments; ++i) {
+      benchmark::escape(sharded.load());
+    }
+  });
+  benchmark::escape(locked);
+
+  return s.result();
+}
@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "benchmark.hpp"
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <scoped_allocator>
+#include <string>
+#include <vector>
+
+//
+// Building and dropping many short opaque strings, with their storage and
+// the container's in a monotonic arena versus the default allocator
+//
+
+namespace {
+
+constexpr std::size_t count = 1 << 20;
+
+// Bump allocator over a single buffer, released all at once
+class monotonic_arena {
+public:
+  explicit monotonic_arena(std::size_t bytes)
+    : buffer(new char[bytes]), capacity(bytes), used(0) { }
+  void * allocate(std::size_t n, std::size_t align) {
+    used = (used + align - 1) & ~(align - 1);
+    if (n > capacity - used) throw std::bad_alloc();
+    void * p = buffer.get() + used;
+    used += n;
+    return p;
+  }
+  void release() noexcept { used = 0; }
+private:
+  std::unique_ptr<char[]> buffer;
+  std::size_t capacity;
+  std::size_t used;
+};
+
+template <typename T>
+struct arena_allocator {
+  typedef T value_type;
+  monotonic_arena * arena;
+  explicit arena_allocator(monotonic_arena& a) noexcept : arena(&a) { }
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& a) noexcept : arena(a.arena) { }
+  T * allocate(std::size_t n) {
+    return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T)));
+  }
+  void deallocate(T *, std::size_t) noexcept { }
+};
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+  return l.arena == r.arena;
+}
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+  return l.arena != r.arena;
+}
+
+typedef std::basic_string<char, std::char_traits<char>,
+                          arena_allocator<char>> arena_basic_string;
+
+struct a_string
+  : opaque::experimental::safer_string_typedef<std::string, a_string> {
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+struct arena_string
+  : opaque::experimental::safer_string_typedef<arena_basic_string,
+                                                arena_string> {
+  using base =
+    opaque::experimental::safer_string_typedef<arena_basic_string,
+                                                arena_string>;
+  using base::base;
+};
+
+// Build count strings of 24 characters, too long for the small string
+// buffer, into a container using allocator a, then drop them all
+template <typename S, typename A>
+void build_and_drop(const A& a) {
+  std::vector<S, std::scoped_allocator_adaptor<A>> v{
+    std::scoped_allocator_adaptor<A>(a)};
+  v.reserve(count);
+  char text[] = "instrument_code_00000000";
+  for (std::size_t i = 0; i < count; ++i) {
+    std::size_t k = i;
+    for (char * p = text + sizeof(text) - 2; k; k /= 10) {
+      *p-- = static_cast<char>('0' + k % 10);
+    }
+    v.emplace_back(text, sizeof(text) - 1);
+  }
+  benchmark::escape(v);
+}
+
+}
+
+int main(int argc, char * argv[]) {
+  benchmark::suite s(argc, argv);
+
+  monotonic_arena arena(count * 96);
+
+  s.compare("arena build and drop", [&]{
+    build_and_drop<arena_basic_string>(
+        arena_allocator<arena_basic_string>(arena));
+    arena.release();
+  }, [&]{
+    build_and_drop<arena_string>(arena_allocator<arena_string>(arena));
+    arena.release();
+  });
+
+  s.report("default allocator vs arena", [&]{
+    build_and_drop<a_string>(std::allocator<a_string>());
+  }, [&]{
+    build_and_drop<arena_string>(arena_allocator<arena_string>(arena));
+    arena.release();
+  });
+
+  return s.result();
+}
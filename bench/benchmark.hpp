@@ -0,0 +1,170 @@
+#ifndef BENCH_BENCHMARK_HPP
+#define BENCH_BENCHMARK_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+///
+/// Minimal benchmark harness comparing opaque typedefs to underlying types
+///
+/// Each comparison times a baseline function operating on the underlying type
+/// and an equivalent function operating on the opaque type.  Both are run
+/// several times, interleaved, and the fastest run of each is kept.  The
+/// ratio opaque/baseline is reported, and the program fails if any ratio
+/// exceeds the threshold given as the first command line argument.
+///
+namespace benchmark {
+
+/// Prevent the optimizer from discarding a value
+template <typename T>
+inline void escape(const T& value) noexcept {
+  asm volatile("" : : "g"(&value) : "memory");
+}
+
+/// Prevent the optimizer from assuming anything about memory
+inline void clobber() noexcept {
+  asm volatile("" : : : "memory");
+}
+
+struct suite {
+
+  using clock = std::chrono::steady_clock;
+
+  static constexpr double default_threshold = 1.25;
+  static constexpr unsigned default_repeats = 31;
+
+  suite(int argc, char * argv[]) noexcept
+    : threshold(default_threshold), repeats(default_repeats), failures(0) {
+    if (argc > 1) threshold = std::strtod(argv[1], nullptr);
+    if (argc > 2) repeats = static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10));
+    if (not (threshold > 0.0)) threshold = default_threshold;
+    if (repeats == 0) repeats = 1;
+    std::printf("%-40s %12s %12s %8s\n",
+        "benchmark", "baseline ns", "opaque ns", "ratio");
+  }
+
+  ///
+  /// Time a baseline function and an opaque function, and report the ratio
+  ///
+  /// Both functions are called with no arguments and must perform the same
+  /// amount of work.
+  ///
+  template <typename B, typename O>
+  void compare(const char * name, B&& baseline, O&& opaque) {
+    double best_baseline = 0.0;
+    double best_opaque   = 0.0;
+    double ratio = measure(baseline, opaque, best_baseline, best_opaque);
+    // A single excessive ratio is often a disturbance from elsewhere in the
+    // system, so it is only reported if it persists on a second measurement.
+    if (ratio > threshold) {
+      ratio = measure(baseline, opaque, best_baseline, best_opaque);
+    }
+    bool failed = ratio > threshold;
+    if (failed) ++failures;
+    std::printf("%-40s %12.0f %12.0f %8.3f%s\n", name,
+        best_baseline, best_opaque, ratio, failed ? "  FAIL" : "");
+  }
+
+  ///
+  /// Time two alternatives and report the ratio, without a threshold
+  ///
+  /// This is for alternatives that trade performance in one situation for
+  /// another, where either may legitimately be faster.
+  ///
+  template <typename B, typename O>
+  void report(const char * name, B&& baseline, O&& other) {
+    double best_baseline = 0.0;
+    double best_other    = 0.0;
+    double ratio = measure(baseline, other, best_baseline, best_other);
+    std::printf("%-40s %12.0f %12.0f %8.3f\n", name,
+        best_baseline, best_other, ratio);
+  }
+
+  /// Exit status for main()
+  int result() const noexcept {
+    if (failures) {
+      std::printf("%u of the ratios exceed the threshold %.3f\n",
+          failures, threshold);
+    }
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
+  double threshold; ///< Maximum acceptable ratio opaque/baseline
+  unsigned repeats; ///< Number of timed runs of each function
+  unsigned failures; ///< Number of ratios exceeding the threshold
+
+private:
+
+  // Best time of each function over the repeats, and their ratio.  Which
+  // function goes first alternates, so neither benefits from the order.
+  template <typename B, typename O>
+  double measure(B& baseline, O& opaque,
+                 double& best_baseline, double& best_opaque) const {
+    best_baseline = time(baseline);
+    best_opaque   = time(opaque);
+    for (unsigned i = 1; i < repeats; ++i) {
+      if (i % 2) {
+        best_opaque   = std::min(best_opaque  , time(opaque  ));
+        best_baseline = std::min(best_baseline, time(baseline));
+      } else {
+        best_baseline = std::min(best_baseline, time(baseline));
+        best_opaque   = std::min(best_opaque  , time(opaque  ));
+      }
+    }
+    return best_opaque / std::max(best_baseline, 1.0);
+  }
+
+  // Not inlined, so that each function is compiled in isolation, and
+  // aligned, so that identical code for the baseline and the opaque function
+  // is also identically placed relative to instruction fetch boundaries.
+  // The function is run once untimed so that its data is in the cache.
+  template <typename F>
+  __attribute__((noinline, aligned(64))) static double time(F& f) {
+    f();
+    auto start = clock::now();
+    f();
+    auto stop  = clock::now();
+    return static_cast<double>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+          stop - start).count());
+  }
+
+};
+
+constexpr double suite::default_threshold;
+constexpr unsigned suite::default_repeats;
+
+}
+
+#endif
@@ -92,30 +92,104 @@
 #              (The root of the tree will be appended)
 #
 
+normal/bench/bench_atomic_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_atomic_typedef.cpp
+normal/bench/bench_binop.so: normal/bench/${DIR_SENTINEL} bench/bench_binop.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_binop.cpp
+normal/bench/bench_checked_numeric_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_checked_numeric_typedef.cpp
+normal/bench/bench_convert.so: normal/bench/${DIR_SENTINEL} bench/bench_convert.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_convert.cpp
+normal/bench/bench_fixed_point_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_fixed_point_typedef.cpp
+normal/bench/bench_flat_map.so: normal/bench/${DIR_SENTINEL} bench/bench_flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_flat_map.cpp
+normal/bench/bench_format.so: normal/bench/${DIR_SENTINEL} bench/bench_format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_format.cpp
+normal/bench/bench_hash.so: normal/bench/${DIR_SENTINEL} bench/bench_hash.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash.cpp
+normal/bench/bench_hash_policy.so: normal/bench/${DIR_SENTINEL} bench/bench_hash_policy.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash_policy.cpp
+normal/bench/bench_interned_string_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_interned_string_typedef.cpp
+normal/bench/bench_numeric_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_numeric_typedef.cpp
+normal/bench/bench_parse.so: normal/bench/${DIR_SENTINEL} bench/bench_parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_parse.cpp
+normal/bench/bench_safer_string_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_safer_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_safer_string_typedef.cpp
+normal/bench/bench_saturating_typedef.so: normal/bench/${DIR_SENTINEL} bench/bench_saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_saturating_typedef.cpp
+normal/bench/bench_sharded_counter.so: normal/bench/${DIR_SENTINEL} bench/bench_sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_sharded_counter.cpp
+normal/bench/bench_string_arena.so: normal/bench/${DIR_SENTINEL} bench/bench_string_arena.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_string_arena.cpp
 normal/example/demo_numeric_typedef.so: normal/example/${DIR_SENTINEL} example/demo_numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/demo_numeric_typedef.cpp
 normal/example/tutorial.so: normal/example/${DIR_SENTINEL} example/tutorial.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/tutorial.cpp
+normal/test/algorithm.so: normal/test/${DIR_SENTINEL} test/algorithm.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/algorithm.cpp
+normal/test/atomic_typedef.so: normal/test/${DIR_SENTINEL} test/atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/atomic_typedef.cpp
+normal/test/binop_audit.so: normal/test/${DIR_SENTINEL} test/binop_audit.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_audit.cpp
+normal/test/binop_batch.so: normal/test/${DIR_SENTINEL} test/binop_batch.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_batch.cpp
 normal/test/binop_function.so: normal/test/${DIR_SENTINEL} test/binop_function.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_function.cpp
 normal/test/binop_inherit.so: normal/test/${DIR_SENTINEL} test/binop_inherit.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_inherit.cpp
 normal/test/binop_overload.so: normal/test/${DIR_SENTINEL} test/binop_overload.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_overload.cpp
+normal/test/checked_numeric_typedef.so: normal/test/${DIR_SENTINEL} test/checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/checked_numeric_typedef.cpp
+normal/test/concat.so: normal/test/${DIR_SENTINEL} test/concat.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/concat.cpp
 normal/test/convert.so: normal/test/${DIR_SENTINEL} test/convert.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/convert.cpp
+normal/test/expr_numeric_typedef.so: normal/test/${DIR_SENTINEL} test/expr_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/expr_numeric_typedef.cpp
+normal/test/fixed_point_typedef.so: normal/test/${DIR_SENTINEL} test/fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_point_typedef.cpp
+normal/test/fixed_string_typedef.so: normal/test/${DIR_SENTINEL} test/fixed_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_string_typedef.cpp
+normal/test/flat_map.so: normal/test/${DIR_SENTINEL} test/flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/flat_map.cpp
+normal/test/format.so: normal/test/${DIR_SENTINEL} test/format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/format.cpp
 normal/test/hash.so: normal/test/${DIR_SENTINEL} test/hash.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/hash.cpp
+normal/test/id_vector.so: normal/test/${DIR_SENTINEL} test/id_vector.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/id_vector.cpp
 normal/test/inconvertibool.so: normal/test/${DIR_SENTINEL} test/inconvertibool.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/inconvertibool.cpp
+normal/test/interned_string_typedef.so: normal/test/${DIR_SENTINEL} test/interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/interned_string_typedef.cpp
 normal/test/numeric_typedef.so: normal/test/${DIR_SENTINEL} test/numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/numeric_typedef.cpp
 normal/test/ostream.so: normal/test/${DIR_SENTINEL} test/ostream.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/ostream.cpp
+normal/test/parse.so: normal/test/${DIR_SENTINEL} test/parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/parse.cpp
 normal/test/safer_string_typedef.so: normal/test/${DIR_SENTINEL} test/safer_string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/safer_string_typedef.cpp
+normal/test/saturating_typedef.so: normal/test/${DIR_SENTINEL} test/saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/saturating_typedef.cpp
+normal/test/search.so: normal/test/${DIR_SENTINEL} test/search.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/search.cpp
+normal/test/sharded_counter.so: normal/test/${DIR_SENTINEL} test/sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/sharded_counter.cpp
+normal/test/simd_typedef.so: normal/test/${DIR_SENTINEL} test/simd_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/simd_typedef.cpp
+normal/test/slot_map.so: normal/test/${DIR_SENTINEL} test/slot_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/slot_map.cpp
+normal/test/span.so: normal/test/${DIR_SENTINEL} test/span.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/span.cpp
 normal/test/string_typedef.so: normal/test/${DIR_SENTINEL} test/string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_typedef.cpp
+normal/test/string_view_typedef.so: normal/test/${DIR_SENTINEL} test/string_view_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_view_typedef.cpp
 normal/test/type_traits.so: normal/test/${DIR_SENTINEL} test/type_traits.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/type_traits.cpp
 normal/test_arrtest/test_evaluator.so: normal/test_arrtest/${DIR_SENTINEL} test_arrtest/test_evaluator.cpp
@@ -130,30 +204,104 @@ normal/test_arrtest/test_test_context.so: normal/test_arrtest/${DIR_SENTINEL} te
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_test_context.cpp
 normal/test_arrtest/test_type_name.so: normal/test_arrtest/${DIR_SENTINEL} test_arrtest/test_type_name.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${NORMAL_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_type_name.cpp
+normal/bench_atomic_typedef: normal/${DIR_SENTINEL} normal/bench/bench_atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_atomic_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_binop: normal/${DIR_SENTINEL} normal/bench/bench_binop.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_binop.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_checked_numeric_typedef: normal/${DIR_SENTINEL} normal/bench/bench_checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_checked_numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_convert: normal/${DIR_SENTINEL} normal/bench/bench_convert.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_convert.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_fixed_point_typedef: normal/${DIR_SENTINEL} normal/bench/bench_fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_fixed_point_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_flat_map: normal/${DIR_SENTINEL} normal/bench/bench_flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_flat_map.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_format: normal/${DIR_SENTINEL} normal/bench/bench_format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_format.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_hash: normal/${DIR_SENTINEL} normal/bench/bench_hash.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_hash.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_hash_policy: normal/${DIR_SENTINEL} normal/bench/bench_hash_policy.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_hash_policy.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_interned_string_typedef: normal/${DIR_SENTINEL} normal/bench/bench_interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_interned_string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_numeric_typedef: normal/${DIR_SENTINEL} normal/bench/bench_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_parse: normal/${DIR_SENTINEL} normal/bench/bench_parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_parse.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_safer_string_typedef: normal/${DIR_SENTINEL} normal/bench/bench_safer_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_safer_string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_saturating_typedef: normal/${DIR_SENTINEL} normal/bench/bench_saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_saturating_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_sharded_counter: normal/${DIR_SENTINEL} normal/bench/bench_sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_sharded_counter.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/bench_string_arena: normal/${DIR_SENTINEL} normal/bench/bench_string_arena.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/bench/bench_string_arena.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/demo_numeric_typedef: normal/${DIR_SENTINEL} normal/example/demo_numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/example/demo_numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/tutorial: normal/${DIR_SENTINEL} normal/example/tutorial.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/example/tutorial.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/algorithm: normal/${DIR_SENTINEL} normal/test/algorithm.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/algorithm.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/atomic_typedef: normal/${DIR_SENTINEL} normal/test/atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/atomic_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/binop_audit: normal/${DIR_SENTINEL} normal/test/binop_audit.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/binop_audit.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/binop_batch: normal/${DIR_SENTINEL} normal/test/binop_batch.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/binop_batch.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/binop_function: normal/${DIR_SENTINEL} normal/test/binop_function.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/binop_function.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/binop_inherit: normal/${DIR_SENTINEL} normal/test/binop_inherit.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/binop_inherit.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/binop_overload: normal/${DIR_SENTINEL} normal/test/binop_overload.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/binop_overload.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/checked_numeric_typedef: normal/${DIR_SENTINEL} normal/test/checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/checked_numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/concat: normal/${DIR_SENTINEL} normal/test/concat.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/concat.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/convert: normal/${DIR_SENTINEL} normal/test/convert.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/convert.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/expr_numeric_typedef: normal/${DIR_SENTINEL} normal/test/expr_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/expr_numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/fixed_point_typedef: normal/${DIR_SENTINEL} normal/test/fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/fixed_point_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/fixed_string_typedef: normal/${DIR_SENTINEL} normal/test/fixed_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/fixed_string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/flat_map: normal/${DIR_SENTINEL} normal/test/flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/flat_map.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/format: normal/${DIR_SENTINEL} normal/test/format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/format.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/hash: normal/${DIR_SENTINEL} normal/test/hash.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/hash.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/id_vector: normal/${DIR_SENTINEL} normal/test/id_vector.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/id_vector.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/inconvertibool: normal/${DIR_SENTINEL} normal/test/inconvertibool.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/inconvertibool.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/interned_string_typedef: normal/${DIR_SENTINEL} normal/test/interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/interned_string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/numeric_typedef: normal/${DIR_SENTINEL} normal/test/numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/numeric_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/ostream: normal/${DIR_SENTINEL} normal/test/ostream.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/ostream.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/parse: normal/${DIR_SENTINEL} normal/test/parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/parse.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/safer_string_typedef: normal/${DIR_SENTINEL} normal/test/safer_string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/safer_string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/saturating_typedef: normal/${DIR_SENTINEL} normal/test/saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/saturating_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/search: normal/${DIR_SENTINEL} normal/test/search.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/search.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/sharded_counter: normal/${DIR_SENTINEL} normal/test/sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/sharded_counter.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/simd_typedef: normal/${DIR_SENTINEL} normal/test/simd_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/simd_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/slot_map: normal/${DIR_SENTINEL} normal/test/slot_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/slot_map.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/span: normal/${DIR_SENTINEL} normal/test/span.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/span.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/string_typedef: normal/${DIR_SENTINEL} normal/test/string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/string_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+normal/string_view_typedef: normal/${DIR_SENTINEL} normal/test/string_view_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/string_view_typedef.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/type_traits: normal/${DIR_SENTINEL} normal/test/type_traits.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test/type_traits.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/test_evaluator: normal/${DIR_SENTINEL} normal/test_arrtest/test_evaluator.so
@@ -168,10 +316,10 @@ normal/test_test_context: normal/${DIR_SENTINEL} normal/test_arrtest/test_test_c
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test_arrtest/test_test_context.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 normal/test_type_name: normal/${DIR_SENTINEL} normal/test_arrtest/test_type_name.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} normal/test_arrtest/test_type_name.so  ${COMMON_LINK} ${NORMAL_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
-normal_dep = normal/example/demo_numeric_typedef.d normal/example/tutorial.d normal/test/binop_function.d normal/test/binop_inherit.d normal/test/binop_overload.d normal/test/convert.d normal/test/hash.d normal/test/inconvertibool.d normal/test/numeric_typedef.d normal/test/ostream.d normal/test/safer_string_typedef.d normal/test/string_typedef.d normal/test/type_traits.d normal/test_arrtest/test_evaluator.d normal/test_arrtest/test_ostreamable.d normal/test_arrtest/test_result_counter.d normal/test_arrtest/test_result_reporter.d normal/test_arrtest/test_test_context.d normal/test_arrtest/test_type_name.d
-normal_obj = normal/example/demo_numeric_typedef.so normal/example/tutorial.so normal/test/binop_function.so normal/test/binop_inherit.so normal/test/binop_overload.so normal/test/convert.so normal/test/hash.so normal/test/inconvertibool.so normal/test/numeric_typedef.so normal/test/ostream.so normal/test/safer_string_typedef.so normal/test/string_typedef.so normal/test/type_traits.so normal/test_arrtest/test_evaluator.so normal/test_arrtest/test_ostreamable.so normal/test_arrtest/test_result_counter.so normal/test_arrtest/test_result_reporter.so normal/test_arrtest/test_test_context.so normal/test_arrtest/test_type_name.so
+normal_dep = normal/bench/bench_atomic_typedef.d normal/bench/bench_binop.d normal/bench/bench_checked_numeric_typedef.d normal/bench/bench_convert.d normal/bench/bench_fixed_point_typedef.d normal/bench/bench_flat_map.d normal/bench/bench_format.d normal/bench/bench_hash.d normal/bench/bench_hash_policy.d normal/bench/bench_interned_string_typedef.d normal/bench/bench_numeric_typedef.d normal/bench/bench_parse.d normal/bench/bench_safer_string_typedef.d normal/bench/bench_saturating_typedef.d normal/bench/bench_sharded_counter.d normal/bench/bench_string_arena.d normal/example/demo_numeric_typedef.d normal/example/tutorial.d normal/test/algorithm.d normal/test/atomic_typedef.d normal/test/binop_audit.d normal/test/binop_batch.d normal/test/binop_function.d normal/test/binop_inherit.d normal/test/binop_overload.d normal/test/checked_numeric_typedef.d normal/test/concat.d normal/test/convert.d normal/test/expr_numeric_typedef.d normal/test/fixed_point_typedef.d normal/test/fixed_string_typedef.d normal/test/flat_map.d normal/test/format.d normal/test/hash.d normal/test/id_vector.d normal/test/inconvertibool.d normal/test/interned_string_typedef.d normal/test/numeric_typedef.d normal/test/ostream.d normal/test/parse.d normal/test/safer_string_typedef.d normal/test/saturating_typedef.d normal/test/search.d normal/test/sharded_counter.d normal/test/simd_typedef.d normal/test/slot_map.d normal/test/span.d normal/test/string_typedef.d normal/test/string_view_typedef.d normal/test/type_traits.d normal/test_arrtest/test_evaluator.d normal/test_arrtest/test_ostreamable.d normal/test_arrtest/test_result_counter.d normal/test_arrtest/test_result_reporter.d normal/test_arrtest/test_test_context.d normal/test_arrtest/test_type_name.d
+normal_obj = normal/bench/bench_atomic_typedef.so normal/bench/bench_binop.so normal/bench/bench_checked_numeric_typedef.so normal/bench/bench_convert.so normal/bench/bench_fixed_point_typedef.so normal/bench/bench_flat_map.so normal/bench/bench_format.so normal/bench/bench_hash.so normal/bench/bench_hash_policy.so normal/bench/bench_interned_string_typedef.so normal/bench/bench_numeric_typedef.so normal/bench/bench_parse.so normal/bench/bench_safer_string_typedef.so normal/bench/bench_saturating_typedef.so normal/bench/bench_sharded_counter.so normal/bench/bench_string_arena.so normal/example/demo_numeric_typedef.so normal/example/tutorial.so normal/test/algorithm.so normal/test/atomic_typedef.so normal/test/binop_audit.so normal/test/binop_batch.so normal/test/binop_function.so normal/test/binop_inherit.so normal/test/binop_overload.so normal/test/checked_numeric_typedef.so normal/test/concat.so normal/test/convert.so normal/test/expr_numeric_typedef.so normal/test/fixed_point_typedef.so normal/test/fixed_string_typedef.so normal/test/flat_map.so normal/test/format.so normal/test/hash.so normal/test/id_vector.so normal/test/inconvertibool.so normal/test/interned_string_typedef.so normal/test/numeric_typedef.so normal/test/ostream.so normal/test/parse.so normal/test/safer_string_typedef.so normal/test/saturating_typedef.so normal/test/search.so normal/test/sharded_counter.so normal/test/simd_typedef.so normal/test/slot_map.so normal/test/span.so normal/test/string_typedef.so normal/test/string_view_typedef.so normal/test/type_traits.so normal/test_arrtest/test_evaluator.so normal/test_arrtest/test_ostreamable.so normal/test_arrtest/test_result_counter.so normal/test_arrtest/test_result_reporter.so normal/test_arrtest/test_test_context.so normal/test_arrtest/test_type_name.so
 normal_lib = 
-normal_bin = normal/demo_numeric_typedef normal/tutorial normal/binop_function normal/binop_inherit normal/binop_overload normal/convert normal/hash normal/inconvertibool normal/numeric_typedef normal/ostream normal/safer_string_typedef normal/string_typedef normal/type_traits normal/test_evaluator normal/test_ostreamable normal/test_result_counter normal/test_result_reporter normal/test_test_context normal/test_type_name
+normal_bin = normal/bench_atomic_typedef normal/bench_binop normal/bench_checked_numeric_typedef normal/bench_convert normal/bench_fixed_point_typedef normal/bench_flat_map normal/bench_format normal/bench_hash normal/bench_hash_policy normal/bench_interned_string_typedef normal/bench_numeric_typedef normal/bench_parse normal/bench_safer_string_typedef normal/bench_saturating_typedef normal/bench_sharded_counter normal/bench_string_arena normal/demo_numeric_typedef normal/tutorial normal/algorithm normal/atomic_typedef normal/binop_audit normal/binop_batch normal/binop_function normal/binop_inherit normal/binop_overload normal/checked_numeric_typedef normal/concat normal/convert normal/expr_numeric_typedef normal/fixed_point_typedef normal/fixed_string_typedef normal/flat_map normal/format normal/hash normal/id_vector normal/inconvertibool normal/interned_string_typedef normal/numeric_typedef normal/ostream normal/parse normal/safer_string_typedef normal/saturating_typedef normal/search normal/sharded_counter normal/simd_typedef normal/slot_map normal/span normal/string_typedef normal/string_view_typedef normal/type_traits normal/test_evaluator normal/test_ostreamable normal/test_result_counter normal/test_result_reporter normal/test_test_context normal/test_type_name
 normal/obj: ${normal_obj}
 normal/lib:
 normal/bin: ${normal_bin}
@@ -179,30 +327,104 @@ normal/clean:
 	${DIR_REMOVE} normal/
 normal/check: normal/bin
 .PHONY: normal/obj normal/lib normal/bin normal/check normal/clean
+debug/bench/bench_atomic_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_atomic_typedef.cpp
+debug/bench/bench_binop.so: debug/bench/${DIR_SENTINEL} bench/bench_binop.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_binop.cpp
+debug/bench/bench_checked_numeric_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_checked_numeric_typedef.cpp
+debug/bench/bench_convert.so: debug/bench/${DIR_SENTINEL} bench/bench_convert.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_convert.cpp
+debug/bench/bench_fixed_point_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_fixed_point_typedef.cpp
+debug/bench/bench_flat_map.so: debug/bench/${DIR_SENTINEL} bench/bench_flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_flat_map.cpp
+debug/bench/bench_format.so: debug/bench/${DIR_SENTINEL} bench/bench_format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_format.cpp
+debug/bench/bench_hash.so: debug/bench/${DIR_SENTINEL} bench/bench_hash.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash.cpp
+debug/bench/bench_hash_policy.so: debug/bench/${DIR_SENTINEL} bench/bench_hash_policy.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash_policy.cpp
+debug/bench/bench_interned_string_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_interned_string_typedef.cpp
+debug/bench/bench_numeric_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_numeric_typedef.cpp
+debug/bench/bench_parse.so: debug/bench/${DIR_SENTINEL} bench/bench_parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_parse.cpp
+debug/bench/bench_safer_string_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_safer_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_safer_string_typedef.cpp
+debug/bench/bench_saturating_typedef.so: debug/bench/${DIR_SENTINEL} bench/bench_saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_saturating_typedef.cpp
+debug/bench/bench_sharded_counter.so: debug/bench/${DIR_SENTINEL} bench/bench_sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_sharded_counter.cpp
+debug/bench/bench_string_arena.so: debug/bench/${DIR_SENTINEL} bench/bench_string_arena.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_string_arena.cpp
 debug/example/demo_numeric_typedef.so: debug/example/${DIR_SENTINEL} example/demo_numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/demo_numeric_typedef.cpp
 debug/example/tutorial.so: debug/example/${DIR_SENTINEL} example/tutorial.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/tutorial.cpp
+debug/test/algorithm.so: debug/test/${DIR_SENTINEL} test/algorithm.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/algorithm.cpp
+debug/test/atomic_typedef.so: debug/test/${DIR_SENTINEL} test/atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/atomic_typedef.cpp
+debug/test/binop_audit.so: debug/test/${DIR_SENTINEL} test/binop_audit.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_audit.cpp
+debug/test/binop_batch.so: debug/test/${DIR_SENTINEL} test/binop_batch.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_batch.cpp
 debug/test/binop_function.so: debug/test/${DIR_SENTINEL} test/binop_function.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_function.cpp
 debug/test/binop_inherit.so: debug/test/${DIR_SENTINEL} test/binop_inherit.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_inherit.cpp
 debug/test/binop_overload.so: debug/test/${DIR_SENTINEL} test/binop_overload.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_overload.cpp
+debug/test/checked_numeric_typedef.so: debug/test/${DIR_SENTINEL} test/checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/checked_numeric_typedef.cpp
+debug/test/concat.so: debug/test/${DIR_SENTINEL} test/concat.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/concat.cpp
 debug/test/convert.so: debug/test/${DIR_SENTINEL} test/convert.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/convert.cpp
+debug/test/expr_numeric_typedef.so: debug/test/${DIR_SENTINEL} test/expr_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/expr_numeric_typedef.cpp
+debug/test/fixed_point_typedef.so: debug/test/${DIR_SENTINEL} test/fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_point_typedef.cpp
+debug/test/fixed_string_typedef.so: debug/test/${DIR_SENTINEL} test/fixed_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_string_typedef.cpp
+debug/test/flat_map.so: debug/test/${DIR_SENTINEL} test/flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/flat_map.cpp
+debug/test/format.so: debug/test/${DIR_SENTINEL} test/format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/format.cpp
 debug/test/hash.so: debug/test/${DIR_SENTINEL} test/hash.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/hash.cpp
+debug/test/id_vector.so: debug/test/${DIR_SENTINEL} test/id_vector.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/id_vector.cpp
 debug/test/inconvertibool.so: debug/test/${DIR_SENTINEL} test/inconvertibool.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/inconvertibool.cpp
+debug/test/interned_string_typedef.so: debug/test/${DIR_SENTINEL} test/interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/interned_string_typedef.cpp
 debug/test/numeric_typedef.so: debug/test/${DIR_SENTINEL} test/numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/numeric_typedef.cpp
 debug/test/ostream.so: debug/test/${DIR_SENTINEL} test/ostream.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/ostream.cpp
+debug/test/parse.so: debug/test/${DIR_SENTINEL} test/parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/parse.cpp
 debug/test/safer_string_typedef.so: debug/test/${DIR_SENTINEL} test/safer_string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/safer_string_typedef.cpp
+debug/test/saturating_typedef.so: debug/test/${DIR_SENTINEL} test/saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/saturating_typedef.cpp
+debug/test/search.so: debug/test/${DIR_SENTINEL} test/search.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/search.cpp
+debug/test/sharded_counter.so: debug/test/${DIR_SENTINEL} test/sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/sharded_counter.cpp
+debug/test/simd_typedef.so: debug/test/${DIR_SENTINEL} test/simd_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/simd_typedef.cpp
+debug/test/slot_map.so: debug/test/${DIR_SENTINEL} test/slot_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/slot_map.cpp
+debug/test/span.so: debug/test/${DIR_SENTINEL} test/span.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/span.cpp
 debug/test/string_typedef.so: debug/test/${DIR_SENTINEL} test/string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_typedef.cpp
+debug/test/string_view_typedef.so: debug/test/${DIR_SENTINEL} test/string_view_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_view_typedef.cpp
 debug/test/type_traits.so: debug/test/${DIR_SENTINEL} test/type_traits.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/type_traits.cpp
 debug/test_arrtest/test_evaluator.so: debug/test_arrtest/${DIR_SENTINEL} test_arrtest/test_evaluator.cpp
@@ -217,30 +439,104 @@ debug/test_arrtest/test_test_context.so: debug/test_arrtest/${DIR_SENTINEL} test
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_test_context.cpp
 debug/test_arrtest/test_type_name.so: debug/test_arrtest/${DIR_SENTINEL} test_arrtest/test_type_name.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${DEBUG_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_type_name.cpp
+debug/bench_atomic_typedef: debug/${DIR_SENTINEL} debug/bench/bench_atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_atomic_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_binop: debug/${DIR_SENTINEL} debug/bench/bench_binop.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_binop.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_checked_numeric_typedef: debug/${DIR_SENTINEL} debug/bench/bench_checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_checked_numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_convert: debug/${DIR_SENTINEL} debug/bench/bench_convert.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_convert.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_fixed_point_typedef: debug/${DIR_SENTINEL} debug/bench/bench_fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_fixed_point_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_flat_map: debug/${DIR_SENTINEL} debug/bench/bench_flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_flat_map.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_format: debug/${DIR_SENTINEL} debug/bench/bench_format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_format.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_hash: debug/${DIR_SENTINEL} debug/bench/bench_hash.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_hash.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_hash_policy: debug/${DIR_SENTINEL} debug/bench/bench_hash_policy.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_hash_policy.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_interned_string_typedef: debug/${DIR_SENTINEL} debug/bench/bench_interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_interned_string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_numeric_typedef: debug/${DIR_SENTINEL} debug/bench/bench_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_parse: debug/${DIR_SENTINEL} debug/bench/bench_parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_parse.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_safer_string_typedef: debug/${DIR_SENTINEL} debug/bench/bench_safer_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_safer_string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_saturating_typedef: debug/${DIR_SENTINEL} debug/bench/bench_saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_saturating_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_sharded_counter: debug/${DIR_SENTINEL} debug/bench/bench_sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_sharded_counter.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/bench_string_arena: debug/${DIR_SENTINEL} debug/bench/bench_string_arena.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/bench/bench_string_arena.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/demo_numeric_typedef: debug/${DIR_SENTINEL} debug/example/demo_numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/example/demo_numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/tutorial: debug/${DIR_SENTINEL} debug/example/tutorial.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/example/tutorial.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/algorithm: debug/${DIR_SENTINEL} debug/test/algorithm.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/algorithm.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/atomic_typedef: debug/${DIR_SENTINEL} debug/test/atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/atomic_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/binop_audit: debug/${DIR_SENTINEL} debug/test/binop_audit.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/binop_audit.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/binop_batch: debug/${DIR_SENTINEL} debug/test/binop_batch.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/binop_batch.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/binop_function: debug/${DIR_SENTINEL} debug/test/binop_function.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/binop_function.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/binop_inherit: debug/${DIR_SENTINEL} debug/test/binop_inherit.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/binop_inherit.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/binop_overload: debug/${DIR_SENTINEL} debug/test/binop_overload.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/binop_overload.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/checked_numeric_typedef: debug/${DIR_SENTINEL} debug/test/checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/checked_numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/concat: debug/${DIR_SENTINEL} debug/test/concat.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/concat.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/convert: debug/${DIR_SENTINEL} debug/test/convert.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/convert.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/expr_numeric_typedef: debug/${DIR_SENTINEL} debug/test/expr_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/expr_numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/fixed_point_typedef: debug/${DIR_SENTINEL} debug/test/fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/fixed_point_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/fixed_string_typedef: debug/${DIR_SENTINEL} debug/test/fixed_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/fixed_string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/flat_map: debug/${DIR_SENTINEL} debug/test/flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/flat_map.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/format: debug/${DIR_SENTINEL} debug/test/format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/format.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/hash: debug/${DIR_SENTINEL} debug/test/hash.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/hash.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/id_vector: debug/${DIR_SENTINEL} debug/test/id_vector.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/id_vector.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/inconvertibool: debug/${DIR_SENTINEL} debug/test/inconvertibool.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/inconvertibool.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/interned_string_typedef: debug/${DIR_SENTINEL} debug/test/interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/interned_string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/numeric_typedef: debug/${DIR_SENTINEL} debug/test/numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/numeric_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/ostream: debug/${DIR_SENTINEL} debug/test/ostream.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/ostream.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/parse: debug/${DIR_SENTINEL} debug/test/parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/parse.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/safer_string_typedef: debug/${DIR_SENTINEL} debug/test/safer_string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/safer_string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/saturating_typedef: debug/${DIR_SENTINEL} debug/test/saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/saturating_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/search: debug/${DIR_SENTINEL} debug/test/search.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/search.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/sharded_counter: debug/${DIR_SENTINEL} debug/test/sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/sharded_counter.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/simd_typedef: debug/${DIR_SENTINEL} debug/test/simd_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/simd_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/slot_map: debug/${DIR_SENTINEL} debug/test/slot_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/slot_map.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/span: debug/${DIR_SENTINEL} debug/test/span.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/span.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/string_typedef: debug/${DIR_SENTINEL} debug/test/string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/string_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+debug/string_view_typedef: debug/${DIR_SENTINEL} debug/test/string_view_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/string_view_typedef.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/type_traits: debug/${DIR_SENTINEL} debug/test/type_traits.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test/type_traits.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/test_evaluator: debug/${DIR_SENTINEL} debug/test_arrtest/test_evaluator.so
@@ -255,10 +551,10 @@ debug/test_test_context: debug/${DIR_SENTINEL} debug/test_arrtest/test_test_cont
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test_arrtest/test_test_context.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 debug/test_type_name: debug/${DIR_SENTINEL} debug/test_arrtest/test_type_name.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} debug/test_arrtest/test_type_name.so  ${COMMON_LINK} ${DEBUG_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
-debug_dep = debug/example/demo_numeric_typedef.d debug/example/tutorial.d debug/test/binop_function.d debug/test/binop_inherit.d debug/test/binop_overload.d debug/test/convert.d debug/test/hash.d debug/test/inconvertibool.d debug/test/numeric_typedef.d debug/test/ostream.d debug/test/safer_string_typedef.d debug/test/string_typedef.d debug/test/type_traits.d debug/test_arrtest/test_evaluator.d debug/test_arrtest/test_ostreamable.d debug/test_arrtest/test_result_counter.d debug/test_arrtest/test_result_reporter.d debug/test_arrtest/test_test_context.d debug/test_arrtest/test_type_name.d
-debug_obj = debug/example/demo_numeric_typedef.so debug/example/tutorial.so debug/test/binop_function.so debug/test/binop_inherit.so debug/test/binop_overload.so debug/test/convert.so debug/test/hash.so debug/test/inconvertibool.so debug/test/numeric_typedef.so debug/test/ostream.so debug/test/safer_string_typedef.so debug/test/string_typedef.so debug/test/type_traits.so debug/test_arrtest/test_evaluator.so debug/test_arrtest/test_ostreamable.so debug/test_arrtest/test_result_counter.so debug/test_arrtest/test_result_reporter.so debug/test_arrtest/test_test_context.so debug/test_arrtest/test_type_name.so
+debug_dep = debug/bench/bench_atomic_typedef.d debug/bench/bench_binop.d debug/bench/bench_checked_numeric_typedef.d debug/bench/bench_convert.d debug/bench/bench_fixed_point_typedef.d debug/bench/bench_flat_map.d debug/bench/bench_format.d debug/bench/bench_hash.d debug/bench/bench_hash_policy.d debug/bench/bench_interned_string_typedef.d debug/bench/bench_numeric_typedef.d debug/bench/bench_parse.d debug/bench/bench_safer_string_typedef.d debug/bench/bench_saturating_typedef.d debug/bench/bench_sharded_counter.d debug/bench/bench_string_arena.d debug/example/demo_numeric_typedef.d debug/example/tutorial.d debug/test/algorithm.d debug/test/atomic_typedef.d debug/test/binop_audit.d debug/test/binop_batch.d debug/test/binop_function.d debug/test/binop_inherit.d debug/test/binop_overload.d debug/test/checked_numeric_typedef.d debug/test/concat.d debug/test/convert.d debug/test/expr_numeric_typedef.d debug/test/fixed_point_typedef.d debug/test/fixed_string_typedef.d debug/test/flat_map.d debug/test/format.d debug/test/hash.d debug/test/id_vector.d debug/test/inconvertibool.d debug/test/interned_string_typedef.d debug/test/numeric_typedef.d debug/test/ostream.d debug/test/parse.d debug/test/safer_string_typedef.d debug/test/saturating_typedef.d debug/test/search.d debug/test/sharded_counter.d debug/test/simd_typedef.d debug/test/slot_map.d debug/test/span.d debug/test/string_typedef.d debug/test/string_view_typedef.d debug/test/type_traits.d debug/test_arrtest/test_evaluator.d debug/test_arrtest/test_ostreamable.d debug/test_arrtest/test_result_counter.d debug/test_arrtest/test_result_reporter.d debug/test_arrtest/test_test_context.d debug/test_arrtest/test_type_name.d
+debug_obj = debug/bench/bench_atomic_typedef.so debug/bench/bench_binop.so debug/bench/bench_checked_numeric_typedef.so debug/bench/bench_convert.so debug/bench/bench_fixed_point_typedef.so debug/bench/bench_flat_map.so debug/bench/bench_format.so debug/bench/bench_hash.so debug/bench/bench_hash_policy.so debug/bench/bench_interned_string_typedef.so debug/bench/bench_numeric_typedef.so debug/bench/bench_parse.so debug/bench/bench_safer_string_typedef.so debug/bench/bench_saturating_typedef.so debug/bench/bench_sharded_counter.so debug/bench/bench_string_arena.so debug/example/demo_numeric_typedef.so debug/example/tutorial.so debug/test/algorithm.so debug/test/atomic_typedef.so debug/test/binop_audit.so debug/test/binop_batch.so debug/test/binop_function.so debug/test/binop_inherit.so debug/test/binop_overload.so debug/test/checked_numeric_typedef.so debug/test/concat.so debug/test/convert.so debug/test/expr_numeric_typedef.so debug/test/fixed_point_typedef.so debug/test/fixed_string_typedef.so debug/test/flat_map.so debug/test/format.so debug/test/hash.so debug/test/id_vector.so debug/test/inconvertibool.so debug/test/interned_string_typedef.so debug/test/numeric_typedef.so debug/test/ostream.so debug/test/parse.so debug/test/safer_string_typedef.so debug/test/saturating_typedef.so debug/test/search.so debug/test/sharded_counter.so debug/test/simd_typedef.so debug/test/slot_map.so debug/test/span.so debug/test/string_typedef.so debug/test/string_view_typedef.so debug/test/type_traits.so debug/test_arrtest/test_evaluator.so debug/test_arrtest/test_ostreamable.so debug/test_arrtest/test_result_counter.so debug/test_arrtest/test_result_reporter.so debug/test_arrtest/test_test_context.so debug/test_arrtest/test_type_name.so
 debug_lib = 
-debug_bin = debug/demo_numeric_typedef debug/tutorial debug/binop_function debug/binop_inherit debug/binop_overload debug/convert debug/hash debug/inconvertibool debug/numeric_typedef debug/ostream debug/safer_string_typedef debug/string_typedef debug/type_traits debug/test_evaluator debug/test_ostreamable debug/test_result_counter debug/test_result_reporter debug/test_test_context debug/test_type_name
+debug_bin = debug/bench_atomic_typedef debug/bench_binop debug/bench_checked_numeric_typedef debug/bench_convert debug/bench_fixed_point_typedef debug/bench_flat_map debug/bench_format debug/bench_hash debug/bench_hash_policy debug/bench_interned_string_typedef debug/bench_numeric_typedef debug/bench_parse debug/bench_safer_string_typedef debug/bench_saturating_typedef debug/bench_sharded_counter debug/bench_string_arena debug/demo_numeric_typedef debug/tutorial debug/algorithm debug/atomic_typedef debug/binop_audit debug/binop_batch debug/binop_function debug/binop_inherit debug/binop_overload debug/checked_numeric_typedef debug/concat debug/convert debug/expr_numeric_typedef debug/fixed_point_typedef debug/fixed_string_typedef debug/flat_map debug/format debug/hash debug/id_vector debug/inconvertibool debug/interned_string_typedef debug/numeric_typedef debug/ostream debug/parse debug/safer_string_typedef debug/saturating_typedef debug/search debug/sharded_counter debug/simd_typedef debug/slot_map debug/span debug/string_typedef debug/string_view_typedef debug/type_traits debug/test_evaluator debug/test_ostreamable debug/test_result_counter debug/test_result_reporter debug/test_test_context debug/test_type_name
 debug/obj: ${debug_obj}
 debug/lib:
 debug/bin: ${debug_bin}
@@ -266,30 +562,104 @@ debug/clean:
 	${DIR_REMOVE} debug/
 debug/check: debug/bin
 .PHONY: debug/obj debug/lib debug/bin debug/check debug/clean
+profile/bench/bench_atomic_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_atomic_typedef.cpp
+profile/bench/bench_binop.so: profile/bench/${DIR_SENTINEL} bench/bench_binop.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_binop.cpp
+profile/bench/bench_checked_numeric_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_checked_numeric_typedef.cpp
+profile/bench/bench_convert.so: profile/bench/${DIR_SENTINEL} bench/bench_convert.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_convert.cpp
+profile/bench/bench_fixed_point_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_fixed_point_typedef.cpp
+profile/bench/bench_flat_map.so: profile/bench/${DIR_SENTINEL} bench/bench_flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_flat_map.cpp
+profile/bench/bench_format.so: profile/bench/${DIR_SENTINEL} bench/bench_format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_format.cpp
+profile/bench/bench_hash.so: profile/bench/${DIR_SENTINEL} bench/bench_hash.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash.cpp
+profile/bench/bench_hash_policy.so: profile/bench/${DIR_SENTINEL} bench/bench_hash_policy.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_hash_policy.cpp
+profile/bench/bench_interned_string_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_interned_string_typedef.cpp
+profile/bench/bench_numeric_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_numeric_typedef.cpp
+profile/bench/bench_parse.so: profile/bench/${DIR_SENTINEL} bench/bench_parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_parse.cpp
+profile/bench/bench_safer_string_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_safer_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_safer_string_typedef.cpp
+profile/bench/bench_saturating_typedef.so: profile/bench/${DIR_SENTINEL} bench/bench_saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_saturating_typedef.cpp
+profile/bench/bench_sharded_counter.so: profile/bench/${DIR_SENTINEL} bench/bench_sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_sharded_counter.cpp
+profile/bench/bench_string_arena.so: profile/bench/${DIR_SENTINEL} bench/bench_string_arena.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} bench/bench_string_arena.cpp
 profile/example/demo_numeric_typedef.so: profile/example/${DIR_SENTINEL} example/demo_numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/demo_numeric_typedef.cpp
 profile/example/tutorial.so: profile/example/${DIR_SENTINEL} example/tutorial.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} example/tutorial.cpp
+profile/test/algorithm.so: profile/test/${DIR_SENTINEL} test/algorithm.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/algorithm.cpp
+profile/test/atomic_typedef.so: profile/test/${DIR_SENTINEL} test/atomic_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/atomic_typedef.cpp
+profile/test/binop_audit.so: profile/test/${DIR_SENTINEL} test/binop_audit.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_audit.cpp
+profile/test/binop_batch.so: profile/test/${DIR_SENTINEL} test/binop_batch.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_batch.cpp
 profile/test/binop_function.so: profile/test/${DIR_SENTINEL} test/binop_function.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_function.cpp
 profile/test/binop_inherit.so: profile/test/${DIR_SENTINEL} test/binop_inherit.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_inherit.cpp
 profile/test/binop_overload.so: profile/test/${DIR_SENTINEL} test/binop_overload.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/binop_overload.cpp
+profile/test/checked_numeric_typedef.so: profile/test/${DIR_SENTINEL} test/checked_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/checked_numeric_typedef.cpp
+profile/test/concat.so: profile/test/${DIR_SENTINEL} test/concat.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/concat.cpp
 profile/test/convert.so: profile/test/${DIR_SENTINEL} test/convert.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/convert.cpp
+profile/test/expr_numeric_typedef.so: profile/test/${DIR_SENTINEL} test/expr_numeric_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/expr_numeric_typedef.cpp
+profile/test/fixed_point_typedef.so: profile/test/${DIR_SENTINEL} test/fixed_point_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_point_typedef.cpp
+profile/test/fixed_string_typedef.so: profile/test/${DIR_SENTINEL} test/fixed_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/fixed_string_typedef.cpp
+profile/test/flat_map.so: profile/test/${DIR_SENTINEL} test/flat_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/flat_map.cpp
+profile/test/format.so: profile/test/${DIR_SENTINEL} test/format.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/format.cpp
 profile/test/hash.so: profile/test/${DIR_SENTINEL} test/hash.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/hash.cpp
+profile/test/id_vector.so: profile/test/${DIR_SENTINEL} test/id_vector.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/id_vector.cpp
 profile/test/inconvertibool.so: profile/test/${DIR_SENTINEL} test/inconvertibool.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/inconvertibool.cpp
+profile/test/interned_string_typedef.so: profile/test/${DIR_SENTINEL} test/interned_string_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/interned_string_typedef.cpp
 profile/test/numeric_typedef.so: profile/test/${DIR_SENTINEL} test/numeric_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/numeric_typedef.cpp
 profile/test/ostream.so: profile/test/${DIR_SENTINEL} test/ostream.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/ostream.cpp
+profile/test/parse.so: profile/test/${DIR_SENTINEL} test/parse.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/parse.cpp
 profile/test/safer_string_typedef.so: profile/test/${DIR_SENTINEL} test/safer_string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/safer_string_typedef.cpp
+profile/test/saturating_typedef.so: profile/test/${DIR_SENTINEL} test/saturating_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/saturating_typedef.cpp
+profile/test/search.so: profile/test/${DIR_SENTINEL} test/search.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/search.cpp
+profile/test/sharded_counter.so: profile/test/${DIR_SENTINEL} test/sharded_counter.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/sharded_counter.cpp
+profile/test/simd_typedef.so: profile/test/${DIR_SENTINEL} test/simd_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/simd_typedef.cpp
+profile/test/slot_map.so: profile/test/${DIR_SENTINEL} test/slot_map.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/slot_map.cpp
+profile/test/span.so: profile/test/${DIR_SENTINEL} test/span.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/span.cpp
 profile/test/string_typedef.so: profile/test/${DIR_SENTINEL} test/string_typedef.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_typedef.cpp
+profile/test/string_view_typedef.so: profile/test/${DIR_SENTINEL} test/string_view_typedef.cpp
+	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/string_view_typedef.cpp
 profile/test/type_traits.so: profile/test/${DIR_SENTINEL} test/type_traits.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test/type_traits.cpp
 profile/test_arrtest/test_evaluator.so: profile/test_arrtest/${DIR_SENTINEL} test_arrtest/test_evaluator.cpp
@@ -304,30 +674,104 @@ profile/test_arrtest/test_test_context.so: profile/test_arrtest/${DIR_SENTINEL}
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_test_context.cpp
 profile/test_arrtest/test_type_name.so: profile/test_arrtest/${DIR_SENTINEL} test_arrtest/test_type_name.cpp
 	${CXX} ${TARGET} $@ ${DEPS} ${COMMON_FLAG} ${PROFILE_FLAG} ${SHARED_FLAG} ${TEST_FLAG} ${CPPFLAGS} ${CXXFLAGS} test_arrtest/test_type_name.cpp
+profile/bench_atomic_typedef: profile/${DIR_SENTINEL} profile/bench/bench_atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_atomic_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_binop: profile/${DIR_SENTINEL} profile/bench/bench_binop.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_binop.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_checked_numeric_typedef: profile/${DIR_SENTINEL} profile/bench/bench_checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_checked_numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_convert: profile/${DIR_SENTINEL} profile/bench/bench_convert.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_convert.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_fixed_point_typedef: profile/${DIR_SENTINEL} profile/bench/bench_fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_fixed_point_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_flat_map: profile/${DIR_SENTINEL} profile/bench/bench_flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_flat_map.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_format: profile/${DIR_SENTINEL} profile/bench/bench_format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_format.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_hash: profile/${DIR_SENTINEL} profile/bench/bench_hash.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_hash.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_hash_policy: profile/${DIR_SENTINEL} profile/bench/bench_hash_policy.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_hash_policy.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_interned_string_typedef: profile/${DIR_SENTINEL} profile/bench/bench_interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_interned_string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_numeric_typedef: profile/${DIR_SENTINEL} profile/bench/bench_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_parse: profile/${DIR_SENTINEL} profile/bench/bench_parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_parse.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_safer_string_typedef: profile/${DIR_SENTINEL} profile/bench/bench_safer_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_safer_string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_saturating_typedef: profile/${DIR_SENTINEL} profile/bench/bench_saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_saturating_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_sharded_counter: profile/${DIR_SENTINEL} profile/bench/bench_sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_sharded_counter.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/bench_string_arena: profile/${DIR_SENTINEL} profile/bench/bench_string_arena.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/bench/bench_string_arena.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/demo_numeric_typedef: profile/${DIR_SENTINEL} profile/example/demo_numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/example/demo_numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/tutorial: profile/${DIR_SENTINEL} profile/example/tutorial.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/example/tutorial.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/algorithm: profile/${DIR_SENTINEL} profile/test/algorithm.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/algorithm.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/atomic_typedef: profile/${DIR_SENTINEL} profile/test/atomic_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/atomic_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/binop_audit: profile/${DIR_SENTINEL} profile/test/binop_audit.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/binop_audit.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/binop_batch: profile/${DIR_SENTINEL} profile/test/binop_batch.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/binop_batch.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/binop_function: profile/${DIR_SENTINEL} profile/test/binop_function.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/binop_function.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/binop_inherit: profile/${DIR_SENTINEL} profile/test/binop_inherit.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/binop_inherit.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/binop_overload: profile/${DIR_SENTINEL} profile/test/binop_overload.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/binop_overload.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/checked_numeric_typedef: profile/${DIR_SENTINEL} profile/test/checked_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/checked_numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/concat: profile/${DIR_SENTINEL} profile/test/concat.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/concat.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/convert: profile/${DIR_SENTINEL} profile/test/convert.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/convert.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/expr_numeric_typedef: profile/${DIR_SENTINEL} profile/test/expr_numeric_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/expr_numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/fixed_point_typedef: profile/${DIR_SENTINEL} profile/test/fixed_point_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/fixed_point_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/fixed_string_typedef: profile/${DIR_SENTINEL} profile/test/fixed_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/fixed_string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/flat_map: profile/${DIR_SENTINEL} profile/test/flat_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/flat_map.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/format: profile/${DIR_SENTINEL} profile/test/format.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/format.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/hash: profile/${DIR_SENTINEL} profile/test/hash.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/hash.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/id_vector: profile/${DIR_SENTINEL} profile/test/id_vector.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/id_vector.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/inconvertibool: profile/${DIR_SENTINEL} profile/test/inconvertibool.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/inconvertibool.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/interned_string_typedef: profile/${DIR_SENTINEL} profile/test/interned_string_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/interned_string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/numeric_typedef: profile/${DIR_SENTINEL} profile/test/numeric_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/numeric_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/ostream: profile/${DIR_SENTINEL} profile/test/ostream.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/ostream.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/parse: profile/${DIR_SENTINEL} profile/test/parse.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/parse.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/safer_string_typedef: profile/${DIR_SENTINEL} profile/test/safer_string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/safer_string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/saturating_typedef: profile/${DIR_SENTINEL} profile/test/saturating_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/saturating_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/search: profile/${DIR_SENTINEL} profile/test/search.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/search.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/sharded_counter: profile/${DIR_SENTINEL} profile/test/sharded_counter.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/sharded_counter.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/simd_typedef: profile/${DIR_SENTINEL} profile/test/simd_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/simd_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/slot_map: profile/${DIR_SENTINEL} profile/test/slot_map.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/slot_map.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/span: profile/${DIR_SENTINEL} profile/test/span.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/span.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/string_typedef: profile/${DIR_SENTINEL} profile/test/string_typedef.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/string_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
+profile/string_view_typedef: profile/${DIR_SENTINEL} profile/test/string_view_typedef.so
+	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/string_view_typedef.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/type_traits: profile/${DIR_SENTINEL} profile/test/type_traits.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test/type_traits.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/test_evaluator: profile/${DIR_SENTINEL} profile/test_arrtest/test_evaluator.so
@@ -342,10 +786,10 @@ profile/test_test_context: profile/${DIR_SENTINEL} profile/test_arrtest/test_tes
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test_arrtest/test_test_context.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
 profile/test_type_name: profile/${DIR_SENTINEL} profile/test_arrtest/test_type_name.so
 	${CXX} ${TARGET} $@ ${CPPFLAGS} ${CXXFLAGS} ${LDFLAGS} profile/test_arrtest/test_type_name.so  ${COMMON_LINK} ${PROFILE_LINK} ${SHARED_LINK} ${TEST_LINK} ${LDLIBS}
-profile_dep = profile/example/demo_numeric_typedef.d profile/example/tutorial.d profile/test/binop_function.d profile/test/binop_inherit.d profile/test/binop_overload.d profile/test/convert.d profile/test/hash.d profile/test/inconvertibool.d profile/test/numeric_typedef.d profile/test/ostream.d profile/test/safer_string_typedef.d profile/test/string_typedef.d profile/test/type_traits.d profile/test_arrtest/test_evaluator.d profile/test_arrtest/test_ostreamable.d profile/test_arrtest/test_result_counter.d profile/test_arrtest/test_result_reporter.d profile/test_arrtest/test_test_context.d profile/test_arrtest/test_type_name.d
-profile_obj = profile/example/demo_numeric_typedef.so profile/example/tutorial.so profile/test/binop_function.so profile/test/binop_inherit.so profile/test/binop_overload.so profile/test/convert.so profile/test/hash.so profile/test/inconvertibool.so profile/test/numeric_typedef.so profile/test/ostream.so profile/test/safer_string_typedef.so profile/test/string_typedef.so profile/test/type_traits.so profile/test_arrtest/test_evaluator.so profile/test_arrtest/test_ostreamable.so profile/test_arrtest/test_result_counter.so profile/test_arrtest/test_result_reporter.so profile/test_arrtest/test_test_context.so profile/test_arrtest/test_type_name.so
+profile_dep = profile/bench/bench_atomic_typedef.d profile/bench/bench_binop.d profile/bench/bench_checked_numeric_typedef.d profile/bench/bench_convert.d profile/bench/bench_fixed_point_typedef.d profile/bench/bench_flat_map.d profile/bench/bench_format.d profile/bench/bench_hash.d profile/bench/bench_hash_policy.d profile/bench/bench_interned_string_typedef.d profile/bench/bench_numeric_typedef.d profile/bench/bench_parse.d profile/bench/bench_safer_string_typedef.d profile/bench/bench_saturating_typedef.d profile/bench/bench_sharded_counter.d profile/bench/bench_string_arena.d profile/example/demo_numeric_typedef.d profile/example/tutorial.d profile/test/algorithm.d profile/test/atomic_typedef.d profile/test/binop_audit.d profile/test/binop_batch.d profile/test/binop_function.d profile/test/binop_inherit.d profile/test/binop_overload.d profile/test/checked_numeric_typedef.d profile/test/concat.d profile/test/convert.d profile/test/expr_numeric_typedef.d profile/test/fixed_point_typedef.d profile/test/fixed_string_typedef.d profile/test/flat_map.d profile/test/format.d profile/test/hash.d profile/test/id_vector.d profile/test/inconvertibool.d profile/test/interned_string_typedef.d profile/test/numeric_typedef.d profile/test/ostream.d profile/test/parse.d profile/test/safer_string_typedef.d profile/test/saturating_typedef.d profile/test/search.d profile/test/sharded_counter.d profile/test/simd_typedef.d profile/test/slot_map.d profile/test/span.d profile/test/string_typedef.d profile/test/string_view_typedef.d profile/test/type_traits.d profile/test_arrtest/test_evaluator.d profile/test_arrtest/test_ostreamable.d profile/test_arrtest/test_result_counter.d profile/test_arrtest/test_result_reporter.d profile/test_arrtest/test_test_context.d profile/test_arrtest/test_type_name.d
+profile_obj = profile/bench/bench_atomic_typedef.so profile/bench/bench_binop.so profile/bench/bench_checked_numeric_typedef.so profile/bench/bench_convert.so profile/bench/bench_fixed_point_typedef.so profile/bench/bench_flat_map.so profile/bench/bench_format.so profile/bench/bench_hash.so profile/bench/bench_hash_policy.so profile/bench/bench_interned_string_typedef.so profile/bench/bench_numeric_typedef.so profile/bench/bench_parse.so profile/bench/bench_safer_string_typedef.so profile/bench/bench_saturating_typedef.so profile/bench/bench_sharded_counter.so profile/bench/bench_string_arena.so profile/example/demo_numeric_typedef.so profile/example/tutorial.so profile/test/algorithm.so profile/test/atomic_typedef.so profile/test/binop_audit.so profile/test/binop_batch.so profile/test/binop_function.so profile/test/binop_inherit.so profile/test/binop_overload.so profile/test/checked_numeric_typedef.so profile/test/concat.so profile/test/convert.so profile/test/expr_numeric_typedef.so profile/test/fixed_point_typedef.so profile/test/fixed_string_typedef.so profile/test/flat_map.so profile/test/format.so profile/test/hash.so profile/test/id_vector.so profile/test/inconvertibool.so profile/test/interned_string_typedef.so profile/test/numeric_typedef.so profile/test/ostream.so profile/test/parse.so profile/test/safer_string_typedef.so profile/test/saturating_typedef.so profile/test/search.so profile/test/sharded_counter.so profile/test/simd_typedef.so profile/test/slot_map.so profile/test/span.so profile/test/string_typedef.so profile/test/string_view_typedef.so profile/test/type_traits.so profile/test_arrtest/test_evaluator.so profile/test_arrtest/test_ostreamable.so profile/test_arrtest/test_result_counter.so profile/test_arrtest/test_result_reporter.so profile/test_arrtest/test_test_context.so profile/test_arrtest/test_type_name.so
 profile_lib = 
-profile_bin = profile/demo_numeric_typedef profile/tutorial profile/binop_function profile/binop_inherit profile/binop_overload profile/convert profile/hash profile/inconvertibool profile/numeric_typedef profile/ostream profile/safer_string_typedef profile/string_typedef profile/type_traits profile/test_evaluator profile/test_ostreamable profile/test_result_counter profile/test_result_reporter profile/test_test_context profile/test_type_name
+profile_bin = profile/bench_atomic_typedef profile/bench_binop profile/bench_checked_numeric_typedef profile/bench_convert profile/bench_fixed_point_typedef profile/bench_flat_map profile/bench_format profile/bench_hash profile/bench_hash_policy profile/bench_interned_string_typedef profile/bench_numeric_typedef profile/bench_parse profile/bench_safer_string_typedef profile/bench_saturating_typedef profile/bench_sharded_counter profile/bench_string_arena profile/demo_numeric_typedef profile/tutorial profile/algorithm profile/atomic_typedef profile/binop_audit profile/binop_batch profile/binop_function profile/binop_inherit profile/binop_overload profile/checked_numeric_typedef profile/concat profile/convert profile/expr_numeric_typedef profile/fixed_point_typedef profile/fixed_string_typedef profile/flat_map profile/format profile/hash profile/id_vector profile/inconvertibool profile/interned_string_typedef profile/numeric_typedef profile/ostream profile/parse profile/safer_string_typedef profile/saturating_typedef profile/search profile/sharded_counter profile/simd_typedef profile/slot_map profile/span profile/string_typedef profile/string_view_typedef profile/type_traits profile/test_evaluator profile/test_ostreamable profile/test_result_counter profile/test_result_reporter profile/test_test_context profile/test_type_name
 profile/obj: ${profile_obj}
 profile/lib:
 profile/bin: ${profile_bin}
@@ -355,6 +799,8 @@ profile/check: profile/bin
 .PHONY: profile/obj profile/lib profile/bin profile/check profile/clean
 debug/${DIR_SENTINEL}:
 	${DIR_CREATE}
+debug/bench/${DIR_SENTINEL}: debug/${DIR_SENTINEL}
+	${DIR_CREATE}
 debug/example/${DIR_SENTINEL}: debug/${DIR_SENTINEL}
 	${DIR_CREATE}
 debug/test/${DIR_SENTINEL}: debug/${DIR_SENTINEL}
@@ -363,6 +809,8 @@ debug/test_arrtest/${DIR_SENTINEL}: debug/${DIR_SENTINEL}
 	${DIR_CREATE}
 normal/${DIR_SENTINEL}:
 	${DIR_CREATE}
+normal/bench/${DIR_SENTINEL}: normal/${DIR_SENTINEL}
+	${DIR_CREATE}
 normal/example/${DIR_SENTINEL}: normal/${DIR_SENTINEL}
 	${DIR_CREATE}
 normal/test/${DIR_SENTINEL}: normal/${DIR_SENTINEL}
@@ -371,6 +819,8 @@ normal/test_arrtest/${DIR_SENTINEL}: normal/${DIR_SENTINEL}
 	${DIR_CREATE}
 profile/${DIR_SENTINEL}:
 	${DIR_CREATE}
+profile/bench/${DIR_SENTINEL}: profile/${DIR_SENTINEL}
+	${DIR_CREATE}
 profile/example/${DIR_SENTINEL}: profile/${DIR_SENTINEL}
 	${DIR_CREATE}
 profile/test/${DIR_SENTINEL}: profile/${DIR_SENTINEL}
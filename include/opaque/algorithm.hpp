@@ -0,0 +1,341 @@
+#ifndef OPAQUE_ALGORITHM_HPP
+#define OPAQUE_ALGORITHM_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "binop/binop_batch.hpp"
+#include "simd.hpp"
+#include "span.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Function objects for the operations used by reduce and the scans.  They
+// forward to operator@ so that only the operations an opaque type permits
+// are available, with the result types it defines.
+//
+
+#define OPAQUE_ALGORITHM_FUNCTOR(NAME, OP) \
+struct NAME { \
+  template <typename L, typename R> \
+  constexpr auto operator()(L&& l, R&& r) const noexcept( \
+    noexcept(opaque::forward<L>(l) OP opaque::forward<R>(r))) -> \
+    decltype(opaque::forward<L>(l) OP opaque::forward<R>(r)) { \
+    return   opaque::forward<L>(l) OP opaque::forward<R>(r); } \
+};
+
+OPAQUE_ALGORITHM_FUNCTOR(plus      , + )
+OPAQUE_ALGORITHM_FUNCTOR(multiplies, * )
+OPAQUE_ALGORITHM_FUNCTOR(bit_and   , & )
+OPAQUE_ALGORITHM_FUNCTOR(bit_or    , | )
+OPAQUE_ALGORITHM_FUNCTOR(bit_xor   , ^ )
+
+#undef OPAQUE_ALGORITHM_FUNCTOR
+
+///
+/// Control how reduce and the scans divide work between threads
+///
+/// Each thread processes at least grain elements, and at most threads
+/// threads are used.  A thread count of zero means the hardware
+/// concurrency.
+///
+struct parallel_policy {
+  unsigned threads;
+  std::size_t grain;
+
+  constexpr parallel_policy(unsigned threads_ = 0,
+                            std::size_t grain_ = std::size_t(1) << 16)
+    noexcept : threads(threads_), grain(grain_) { }
+
+  /// The number of chunks to divide n elements into
+  std::size_t chunks(std::size_t n) const noexcept {
+    std::size_t t = threads ? threads : std::thread::hardware_concurrency();
+    std::size_t c = grain ? n / grain : n;
+    return std::max<std::size_t>(1, std::min(t, c));
+  }
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+// Run f(k, begin, end) for each of the chunks dividing [0, n), on separate
+// threads.  The calling thread runs the first chunk.  An exception thrown
+// by any chunk is rethrown after all chunks have finished.
+template <typename F>
+void for_each_chunk(std::size_t n, std::size_t chunks, F f) {
+  auto begin = [=](std::size_t k) { return n / chunks * k
+                                    + std::min(k, n % chunks); };
+  if (chunks <= 1) {
+    f(std::size_t(0), std::size_t(0), n);
+    return;
+  }
+  std::vector<std::exception_ptr> errors(chunks);
+  auto run = [&](std::size_t k) {
+    try {
+      f(k, begin(k), begin(k + 1));
+    } catch (...) {
+      errors[k] = std::current_exception();
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(chunks - 1);
+  std::size_t k = 1;
+  try {
+    for (; k != chunks; ++k) workers.emplace_back(run, k);
+  } catch (...) {
+    // Unable to start a thread; run the remaining chunks here
+    for (std::size_t j = k; j != chunks; ++j) run(j);
+  }
+  run(0);
+  for (auto& w : workers) w.join();
+  for (auto& e : errors) if (e) std::rethrow_exception(e);
+}
+
+// The lane operation equivalent to a function object
+template <typename OP> struct lane_reduction { using type = void; };
+template <> struct lane_reduction<plus      > { using type = simd::add_t; };
+template <> struct lane_reduction<multiplies> { using type = simd::mul_t; };
+template <> struct lane_reduction<bit_and   > { using type = simd::and_t; };
+template <> struct lane_reduction<bit_or    > { using type = simd::or_t;  };
+template <> struct lane_reduction<bit_xor   > { using type = simd::xor_t; };
+
+template <typename T, typename OP, typename = void>
+struct is_closed : std::false_type { };
+template <typename T, typename OP>
+struct is_closed<T, OP, typename std::enable_if<std::is_same<T,
+  typename std::decay<typename is_functor_call_well_formed<
+    OP, const T&, const T&>::result_type>::type>::value>::type>
+  : std::true_type { };
+
+// How a range of T combines under OP.  When OP is closed over T, chunks
+// can be combined separately and the partial results combined afterwards.
+// When OP is also a lane operation on the storage of T, chunks are
+// combined on the storage with vector instructions.  Saturating arithmetic
+// is not associative, so saturating types are always combined in order.
+// Fixed-point products are rescaled, so they are not lane operations.
+template <typename T, typename OP>
+struct combine {
+  using lane_t = typename binop::detail::lane_type<T>::type;
+  using op_t = typename std::conditional<
+    binop::detail::lane_scale<T>::value != 0 and
+    std::is_same<OP, multiplies>::value,
+    void, typename lane_reduction<OP>::type>::type;
+
+  static constexpr bool closed = is_closed<T,OP>::value and
+    not binop::detail::saturates<T>::value;
+  static constexpr bool lanes = closed and
+    not std::is_void<lane_t>::value and not std::is_void<op_t>::value;
+
+  // Combine a non-empty range
+  template <typename P = T>
+  static typename std::enable_if<    lanes, P>::type
+  range(span<const T> s, OP) noexcept {
+    const lane_t * p = binop::detail::storage(s);
+    return static_cast<T>(simd::reduce<op_t>(p + 1, s.size() - 1, p[0]));
+  }
+  template <typename P = T>
+  static typename std::enable_if<not lanes, P>::type
+  range(span<const T> s, OP op) {
+    T acc = s[0];
+    for (std::size_t i = 1; i != s.size(); ++i) acc = op(acc, s[i]);
+    return acc;
+  }
+};
+
+template <typename T, typename R, typename OP>
+typename std::enable_if<    combine<T,OP>::closed, R>::type
+reduce(span<const T> in, R init, OP op, parallel_policy policy) {
+  if (in.empty()) return init;
+  const std::size_t chunks = policy.chunks(in.size());
+  std::vector<T> partial(chunks, in[0]);
+  for_each_chunk(in.size(), chunks,
+      [&](std::size_t k, std::size_t b, std::size_t e) {
+        partial[k] = combine<T,OP>::range(in.subspan(b, e - b), op);
+      });
+  for (const T& p : partial) init = op(opaque::move(init), p);
+  return init;
+}
+
+template <typename T, typename R, typename OP>
+typename std::enable_if<not combine<T,OP>::closed, R>::type
+reduce(span<const T> in, R init, OP op, parallel_policy) {
+  for (const T& x : in) init = op(opaque::move(init), x);
+  return init;
+}
+
+template <bool inclusive, typename T, typename O, typename R, typename OP>
+void scan_chunk(span<const T> in, span<O> out, R acc, OP op) {
+  for (std::size_t i = 0; i != in.size(); ++i) {
+    if (inclusive) {
+      acc = op(opaque::move(acc), in[i]);
+      out[i] = acc;
+    } else {
+      // Read the input first: the output may be the same range
+      const T x = in[i];
+      out[i] = acc;
+      acc = op(opaque::move(acc), x);
+    }
+  }
+}
+
+// Scan in three passes: combine each chunk, combine the chunk results
+// serially to find where each chunk starts, then scan each chunk.
+template <bool inclusive, typename T, typename O, typename R, typename OP>
+typename std::enable_if<    combine<T,OP>::closed>::type
+scan(span<const T> in, span<O> out, R init, OP op, parallel_policy policy) {
+  const std::size_t chunks = policy.chunks(in.size());
+  if (chunks <= 1) {
+    scan_chunk<inclusive>(in, out, opaque::move(init), op);
+    return;
+  }
+  std::vector<T> partial(chunks, in[0]);
+  for_each_chunk(in.size(), chunks,
+      [&](std::size_t k, std::size_t b, std::size_t e) {
+        partial[k] = combine<T,OP>::range(in.subspan(b, e - b), op);
+      });
+  std::vector<R> start(1, init);
+  start.reserve(chunks);
+  for (std::size_t k = 1; k != chunks; ++k) {
+    start.push_back(op(start.back(), partial[k - 1]));
+  }
+  for_each_chunk(in.size(), chunks,
+      [&](std::size_t k, std::size_t b, std::size_t e) {
+        scan_chunk<inclusive>(in.subspan(b, e - b), out.subspan(b, e - b),
+                              start[k], op);
+      });
+}
+
+template <bool inclusive, typename T, typename O, typename R, typename OP>
+typename std::enable_if<not combine<T,OP>::closed>::type
+scan(span<const T> in, span<O> out, R init, OP op, parallel_policy) {
+  scan_chunk<inclusive>(in, out, opaque::move(init), op);
+}
+
+template <typename C>
+using input_t = span<const typename std::remove_cv<
+  container_element<const C>>::type>;
+template <typename C>
+using output_t = span<container_element<
+  typename std::remove_reference<C>::type>>;
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Combine a range with an initial value, like std::reduce
+///
+/// The result has the type of init, and each step is init = op(init, x)
+/// for elements x.  When op(x, y) for two elements is again an element,
+/// the range is divided into chunks that are combined in parallel and the
+/// chunk results are combined in order, so op must be associative.  The
+/// standard operations on batchable types combine each chunk with vector
+/// instructions, which may change floating-point rounding.  Types that
+/// saturate are combined serially, in order.
+///
+/// For example, distances may be summed in parallel as distances and the
+/// total added to an initial position, giving a position.
+///
+template <typename C, typename R, typename OP = plus>
+R reduce(const C& in, R init, OP op = OP(),
+         parallel_policy policy = parallel_policy()) {
+  return detail::reduce(detail::input_t<C>(in), opaque::move(init), op,
+                        policy);
+}
+
+///
+/// Combine a range starting from a value-initialized element
+///
+template <typename C>
+typename detail::input_t<C>::value_type reduce(const C& in) {
+  using T = typename detail::input_t<C>::value_type;
+  return opaque::reduce(in, T());
+}
+
+///
+/// Scan a range: out[i] = op(...op(init, in[0])..., in[i])
+///
+/// The output may be the input range.  Parallelism is as for reduce.
+///
+template <typename C, typename D, typename OP, typename R>
+void inclusive_scan(const C& in, D&& out, OP op, R init,
+                    parallel_policy policy = parallel_policy()) {
+  detail::scan<true>(detail::input_t<C>(in), detail::output_t<D>(out),
+                     opaque::move(init), op, policy);
+}
+
+///
+/// Scan a range: out[i] = op(...op(in[0], in[1])..., in[i])
+///
+template <typename C, typename D, typename OP = plus>
+void inclusive_scan(const C& in, D&& out, OP op = OP(),
+                    parallel_policy policy = parallel_policy()) {
+  detail::input_t<C> i(in);
+  detail::output_t<D> o(out);
+  if (i.empty()) return;
+  auto first = i[0];
+  o[0] = first;
+  detail::scan<true>(i.subspan(1), o.subspan(1), first, op, policy);
+}
+
+///
+/// Scan a range: out[i] = op(...op(init, in[0])..., in[i - 1])
+///
+/// The first output is init.  The output may be the input range.
+/// Parallelism is as for reduce.
+///
+template <typename C, typename D, typename R, typename OP = plus>
+void exclusive_scan(const C& in, D&& out, R init, OP op = OP(),
+                    parallel_policy policy = parallel_policy()) {
+  detail::scan<false>(detail::input_t<C>(in), detail::output_t<D>(out),
+                      opaque::move(init), op, policy);
+}
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,257 @@
+#ifndef OPAQUE_ATOMIC_TYPEDEF_HPP
+#define OPAQUE_ATOMIC_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "numeric_typedef.hpp"
+#include "overflow.hpp"
+#include "type_traits.hpp"
+#include <atomic>
+#include <type_traits>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Whether the compound assignments of an opaque type are those of its
+/// underlying type
+///
+/// This holds by default for types derived from numeric_typedef_base,
+/// whose operators act on the underlying value directly, so that
+/// atomic_typedef can use the atomic instructions of the underlying type.
+/// It does not hold for types with an overflow_policy, such as
+/// checked_numeric_typedef and saturating_typedef.  Specialize this to
+/// std::false_type for any other type whose operators do more;
+/// atomic_typedef then applies them in a compare-and-exchange loop.
+///
+template <typename O, typename = void>
+struct is_native_arithmetic : std::false_type { };
+template <typename O>
+struct is_native_arithmetic<O, void_t<typename O::shift_type>>
+  : std::integral_constant<bool,
+      std::is_base_of<numeric_typedef_base<typename O::underlying_type, O,
+                                           typename O::shift_type>,
+                      O>::value and
+      not detail::has_overflow_policy<O>::value> { };
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename T, std::size_t = sizeof(T)>
+struct atomic_lock_free : std::false_type { };
+template <typename T>
+struct atomic_lock_free<T, sizeof(char)>
+  : std::integral_constant<bool, ATOMIC_CHAR_LOCK_FREE == 2> { };
+template <typename T>
+struct atomic_lock_free<T, sizeof(short)>
+  : std::integral_constant<bool, ATOMIC_SHORT_LOCK_FREE == 2> { };
+template <typename T>
+struct atomic_lock_free<T, sizeof(int)>
+  : std::integral_constant<bool, ATOMIC_INT_LOCK_FREE == 2> { };
+template <typename T>
+struct atomic_lock_free<T, sizeof(long long)>
+  : std::integral_constant<bool, ATOMIC_LLONG_LOCK_FREE == 2> { };
+
+template <typename O, typename D>
+using add_assign_t = decltype(std::declval<O&>() += std::declval<const D&>());
+template <typename O, typename D>
+using sub_assign_t = decltype(std::declval<O&>() -= std::declval<const D&>());
+template <typename O, typename D>
+using and_assign_t = decltype(std::declval<O&>() &= std::declval<const D&>());
+template <typename O, typename D>
+using or_assign_t  = decltype(std::declval<O&>() |= std::declval<const D&>());
+template <typename O, typename D>
+using xor_assign_t = decltype(std::declval<O&>() ^= std::declval<const D&>());
+
+//
+// Each operation has an atomic instruction on the underlying value, and
+// the compound assignment of the opaque type for compare-and-exchange.
+//
+
+#define OPAQUE_ATOMIC_OPERATION(NAME, OP, FETCH) \
+struct NAME { \
+  template <typename A, typename U> \
+  static U native(A& a, const U& v, std::memory_order order) noexcept { \
+    return a.FETCH(v, order); \
+  } \
+  template <typename O, typename D> \
+  static void apply(O& l, const D& r) { l OP r; } \
+};
+
+OPAQUE_ATOMIC_OPERATION(atomic_add, +=, fetch_add)
+OPAQUE_ATOMIC_OPERATION(atomic_sub, -=, fetch_sub)
+OPAQUE_ATOMIC_OPERATION(atomic_and, &=, fetch_and)
+OPAQUE_ATOMIC_OPERATION(atomic_or , |=, fetch_or )
+OPAQUE_ATOMIC_OPERATION(atomic_xor, ^=, fetch_xor)
+
+#undef OPAQUE_ATOMIC_OPERATION
+
+// The atomic instruction applies when the operand is an opaque type over
+// the same underlying type, and the operator does nothing more
+template <typename O, typename D, typename = void>
+struct atomic_native : std::false_type { };
+template <typename O, typename D>
+struct atomic_native<O, D, void_t<decltype(std::declval<const D&>().value)>>
+  : std::integral_constant<bool,
+      std::is_integral<typename O::underlying_type>::value and
+      not std::is_same<typename O::underlying_type, bool>::value and
+      is_native_arithmetic<O>::value and
+      std::is_same<typename std::decay<decltype(
+        std::declval<const D&>().value)>::type,
+        typename O::underlying_type>::value> { };
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Atomic storage for an opaque typedef
+///
+/// This offers the operations of std::atomic in terms of the opaque type.
+/// The read-modify-write operations fetch_add, fetch_sub, fetch_and,
+/// fetch_or and fetch_xor exist only for operands that the opaque type
+/// accepts in the matching compound assignment, so a position_typedef
+/// takes its Distance type in fetch_add and fetch_sub, and a type without
+/// arithmetic has none of them.  They return the previous value.
+///
+/// Where the underlying type is integral and is_native_arithmetic holds,
+/// these are single atomic instructions.  Otherwise they apply the
+/// operator of the opaque type in a compare-and-exchange loop, which is
+/// still lock-free when the underlying atomic is.  Integral underlying
+/// types are required to be always lock-free.
+///
+template <typename O>
+class atomic_typedef {
+public:
+  typedef O value_type;
+  typedef typename O::underlying_type underlying_type;
+
+  static_assert(not std::is_integral<underlying_type>::value or
+                detail::atomic_lock_free<underlying_type>::value,
+                "Atomics of integral underlying types must be lock-free");
+
+  atomic_typedef() noexcept = default;
+  constexpr atomic_typedef(const O& v) noexcept : atom(v.value) { }
+  atomic_typedef(const atomic_typedef&) = delete;
+  atomic_typedef& operator=(const atomic_typedef&) = delete;
+
+  bool is_lock_free() const noexcept { return atom.is_lock_free(); }
+
+  O load(std::memory_order order = std::memory_order_seq_cst) const noexcept {
+    return O(atom.load(order));
+  }
+  void store(const O& v,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    atom.store(v.value, order);
+  }
+  O exchange(const O& v,
+             std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return O(atom.exchange(v.value, order));
+  }
+
+  bool compare_exchange_weak(O& expected, const O& desired,
+      std::memory_order success, std::memory_order failure) noexcept {
+    return atom.compare_exchange_weak(
+        expected.value, desired.value, success, failure);
+  }
+  bool compare_exchange_weak(O& expected, const O& desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atom.compare_exchange_weak(expected.value, desired.value, order);
+  }
+  bool compare_exchange_strong(O& expected, const O& desired,
+      std::memory_order success, std::memory_order failure) noexcept {
+    return atom.compare_exchange_strong(
+        expected.value, desired.value, success, failure);
+  }
+  bool compare_exchange_strong(O& expected, const O& desired,
+      std::memory_order order = std::memory_order_seq_cst) noexcept {
+    return atom.compare_exchange_strong(expected.value, desired.value, order);
+  }
+
+  template <typename D, typename = detail::add_assign_t<O,D>>
+  O fetch_add(const D& d,
+              std::memory_order order = std::memory_order_seq_cst) {
+    return update<detail::atomic_add>(detail::atomic_native<O,D>(), d, order);
+  }
+  template <typename D, typename = detail::sub_assign_t<O,D>>
+  O fetch_sub(const D& d,
+              std::memory_order order = std::memory_order_seq_cst) {
+    return update<detail::atomic_sub>(detail::atomic_native<O,D>(), d, order);
+  }
+  template <typename D, typename = detail::and_assign_t<O,D>>
+  O fetch_and(const D& d,
+              std::memory_order order = std::memory_order_seq_cst) {
+    return update<detail::atomic_and>(detail::atomic_native<O,D>(), d, order);
+  }
+  template <typename D, typename = detail::or_assign_t<O,D>>
+  O fetch_or(const D& d,
+             std::memory_order order = std::memory_order_seq_cst) {
+    return update<detail::atomic_or>(detail::atomic_native<O,D>(), d, order);
+  }
+  template <typename D, typename = detail::xor_assign_t<O,D>>
+  O fetch_xor(const D& d,
+              std::memory_order order = std::memory_order_seq_cst) {
+    return update<detail::atomic_xor>(detail::atomic_native<O,D>(), d, order);
+  }
+
+private:
+  std::atomic<underlying_type> atom;
+
+  template <typename Op, typename D>
+  O update(std::true_type, const D& d, std::memory_order order) noexcept {
+    return O(Op::native(atom, d.value, order));
+  }
+  template <typename Op, typename D>
+  O update(std::false_type, const D& d, std::memory_order order) {
+    underlying_type current = atom.load(std::memory_order_relaxed);
+    for (;;) {
+      O next(current);
+      Op::apply(next, d);
+      if (atom.compare_exchange_weak(current, next.value, order,
+                                     std::memory_order_relaxed)) {
+        return O(current);
+      }
+    }
+  }
+};
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,302 @@
+#ifndef OPAQUE_BINOP_BATCH_HPP
+#define OPAQUE_BINOP_BATCH_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "binop_function.hpp"
+#include "../numeric_typedef.hpp"
+#include "../overflow.hpp"
+#include "../simd.hpp"
+#include "../span.hpp"
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace opaque {
+namespace binop {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Determine whether operations on T may be performed on its storage
+///
+/// Batch operations process ranges of T as ranges of T::underlying_type
+/// when this holds.  By default it holds for layout-compatible types
+/// derived from numeric_typedef_base, whose operator@= applies operator@=
+/// to the underlying value.  Specialize this to std::false_type for such a
+/// type that redefines any operator@= to do something else.
+///
+/// It does not hold for types with an overflow_policy, such as
+/// checked_numeric_typedef, whose arithmetic is applied element by element
+/// so that the policy is followed, except those that saturate, whose
+/// arithmetic is processed with the saturating lane operations.
+///
+/// Fixed-point types are batchable too, but their multiplication and
+/// division are applied element by element, as are operations between
+/// operands of different scales.
+///
+template <typename T, typename = void>
+struct is_batchable : std::false_type { };
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename U, typename O, typename S>
+std::true_type is_numeric_typedef(const numeric_typedef_base<U,O,S>*);
+std::false_type is_numeric_typedef(...);
+
+template <typename T, typename = void>
+struct saturates : std::false_type { };
+template <typename T>
+struct saturates<T, typename std::enable_if<
+  std::is_same<typename T::overflow_policy, saturate_on_overflow>::value>::type>
+  : std::true_type { };
+
+}
+
+template <typename T>
+struct is_batchable<T, typename std::enable_if<
+  decltype(detail::is_numeric_typedef(std::declval<T*>()))::value>::type>
+  : std::integral_constant<bool, is_layout_compatible<T>::value and
+      (not opaque::detail::has_overflow_policy<T>::value or
+       detail::saturates<T>::value)> { };
+
+namespace detail {
+
+// The template arguments of a binop mixin such as addable<RT,c,P1,P2,I1,I2>
+template <typename Mixin>
+struct mixin_traits;
+
+template <template <typename, bool, typename, typename, typename, typename>
+          class M, typename RT, bool commutative,
+          typename P1, typename P2, typename I1, typename I2>
+struct mixin_traits<M<RT,commutative,P1,P2,I1,I2>> {
+  using result_type = RT;
+  using first_type  = P1;
+  using second_type = P2;
+  using first_intermediate  = I1;
+  using second_intermediate = I2;
+};
+
+// The lane operation equivalent to an operator@= functor.  Shifts have
+// none: vector shift instructions shift every lane by one common count,
+// not by the count in the corresponding lane.
+template <typename OP> struct lane_op { using type = void; };
+template <> struct lane_op<   multiply_equal_t> { using type = simd::mul_t; };
+template <> struct lane_op<     divide_equal_t> { using type = simd::div_t; };
+template <> struct lane_op<    modulus_equal_t> { using type = simd::mod_t; };
+template <> struct lane_op<        add_equal_t> { using type = simd::add_t; };
+template <> struct lane_op<   subtract_equal_t> { using type = simd::sub_t; };
+template <> struct lane_op<     bitand_equal_t> { using type = simd::and_t; };
+template <> struct lane_op<     bitxor_equal_t> { using type = simd::xor_t; };
+template <> struct lane_op<      bitor_equal_t> { using type = simd::or_t;  };
+
+// The lane operation for a result type, which saturates if the type does
+template <typename OP> struct saturating_lane_op : lane_op<OP> { };
+template <> struct saturating_lane_op<multiply_equal_t> {
+  using type = simd::muls_t; };
+template <> struct saturating_lane_op<  divide_equal_t> {
+  using type = simd::divs_t; };
+template <> struct saturating_lane_op< modulus_equal_t> {
+  using type = simd::mods_t; };
+template <> struct saturating_lane_op<     add_equal_t> {
+  using type = simd::adds_t; };
+template <> struct saturating_lane_op<subtract_equal_t> {
+  using type = simd::subs_t; };
+
+// Fixed-point products and quotients are rescaled, so only the other
+// operations apply to the storage
+template <typename OP> struct fixed_point_lane_op : lane_op<OP> { };
+template <> struct fixed_point_lane_op<multiply_equal_t> { using type = void; };
+template <> struct fixed_point_lane_op<  divide_equal_t> { using type = void; };
+
+// The number of fractional bits of an operand, which must agree for its
+// storage to be used directly
+template <typename T, typename = void>
+struct lane_scale : std::integral_constant<unsigned, 0> { };
+template <typename T>
+struct lane_scale<T, typename std::enable_if<
+  opaque::detail::is_fixed_point_opaque<T>::value>::type>
+  : std::integral_constant<unsigned, T::frac_bits> { };
+
+template <typename RT, typename OP>
+using result_lane_op = typename std::conditional<saturates<RT>::value,
+  saturating_lane_op<OP>, typename std::conditional<lane_scale<RT>::value != 0,
+  fixed_point_lane_op<OP>, lane_op<OP>>::type>::type;
+
+// The type of the storage an operand is processed as, or void if the
+// operand must be processed through its own operators
+template <typename T, typename = void>
+struct lane_type { using type = void; };
+template <typename T>
+struct lane_type<T, typename std::enable_if<
+  std::is_arithmetic<T>::value>::type> { using type = T; };
+template <typename T>
+struct lane_type<T, typename std::enable_if<
+  is_batchable<T>::value>::type> { using type = typename T::underlying_type; };
+
+template <typename Mixin>
+struct batch {
+  using traits = mixin_traits<Mixin>;
+  using RT = typename traits::result_type;
+  using P1 = typename traits::first_type;
+  using P2 = typename traits::second_type;
+  using I1 = typename traits::first_intermediate;
+  using I2 = typename traits::second_intermediate;
+  using binop_t = typename Mixin::binop_t;
+  using op_t = typename result_lane_op<RT, typename Mixin::OP>::type;
+  using lane_t = typename lane_type<RT>::type;
+
+  static_assert(std::is_base_of<Mixin, P1>::value or
+                std::is_base_of<Mixin, P2>::value,
+      "The operation is not provided by either operand type");
+
+  static constexpr bool lanes =
+    not std::is_void<op_t  >::value and
+    not std::is_void<lane_t>::value and
+    std::is_same<typename lane_type<P1>::type, lane_t>::value and
+    std::is_same<typename lane_type<P2>::type, lane_t>::value and
+    std::is_same<typename lane_type<I1>::type, lane_t>::value and
+    std::is_same<typename lane_type<I2>::type, lane_t>::value and
+    lane_scale<P1>::value == lane_scale<RT>::value and
+    lane_scale<P2>::value == lane_scale<RT>::value and
+    lane_scale<I1>::value == lane_scale<RT>::value and
+    lane_scale<I2>::value == lane_scale<RT>::value;
+};
+
+template <typename T>
+constexpr typename std::enable_if<
+  std::is_arithmetic<typename std::remove_cv<T>::type>::value, T*>::type
+storage(span<T> s) noexcept {
+  return s.data();
+}
+
+template <typename T>
+constexpr auto storage(span<T> s) noexcept -> typename std::enable_if<
+  not std::is_arithmetic<typename std::remove_cv<T>::type>::value,
+  decltype(as_underlying(s).data())>::type {
+  return as_underlying(s).data();
+}
+
+template <typename B>
+typename std::enable_if<    B::lanes>::type
+apply(span<typename B::RT> out,
+      span<const typename B::P1> lhs, span<const typename B::P2> rhs)
+  noexcept {
+  simd::apply<typename B::op_t>(
+      storage(out), storage(lhs), storage(rhs), out.size());
+}
+
+template <typename B>
+typename std::enable_if<not B::lanes>::type
+apply(span<typename B::RT> out,
+      span<const typename B::P1> lhs, span<const typename B::P2> rhs) {
+  for (std::size_t i = 0; i != out.size(); ++i) {
+    out[i] = B::binop_t::func(lhs[i], rhs[i]);
+  }
+}
+
+template <typename B>
+typename std::enable_if<    B::lanes>::type
+transform_assign(span<typename B::RT> lhs, span<const typename B::P2> rhs)
+  noexcept {
+  simd::apply<typename B::op_t>(storage(lhs), storage(rhs), lhs.size());
+}
+
+template <typename B>
+typename std::enable_if<not B::lanes>::type
+transform_assign(span<typename B::RT> lhs, span<const typename B::P2> rhs) {
+  for (std::size_t i = 0; i != lhs.size(); ++i) {
+    lhs[i] = B::binop_t::func(opaque::move(lhs[i]), rhs[i]);
+  }
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Determine whether a batch operation runs directly on storage
+///
+/// This holds when every operand and intermediate type of the mixin is
+/// batchable or arithmetic with the same underlying type.  Otherwise the
+/// batch operation applies the mixin's operator to each element in turn.
+///
+template <typename Mixin>
+struct is_lane_operation
+  : std::integral_constant<bool, detail::batch<Mixin>::lanes> { };
+
+///
+/// Apply the operation of a binop mixin over ranges: out[i] = lhs[i] @ rhs[i]
+///
+/// Mixin names the permitted operation exactly as the operand types
+/// inherit it, for example addable<position, true, position, distance>,
+/// so the mixed-type rules are the same as for operator@.  Both inputs
+/// must have at least out.size() elements.  The output may be the same
+/// range as an input of the same type, but must not otherwise overlap the
+/// inputs.
+///
+template <typename Mixin>
+void apply(span<typename detail::mixin_traits<Mixin>::result_type> out,
+           span<const typename detail::mixin_traits<Mixin>::first_type> lhs,
+           span<const typename detail::mixin_traits<Mixin>::second_type> rhs)
+{
+  detail::apply<detail::batch<Mixin>>(out, lhs, rhs);
+}
+
+///
+/// Apply the operation of a binop mixin in place: lhs[i] = lhs[i] @ rhs[i]
+///
+/// The left operand type of Mixin must be its result type.  The right
+/// input must have at least lhs.size() elements and must not overlap lhs.
+///
+template <typename Mixin>
+void transform_assign(
+    span<typename detail::mixin_traits<Mixin>::result_type> lhs,
+    span<const typename detail::mixin_traits<Mixin>::second_type> rhs) {
+  static_assert(std::is_same<typename detail::mixin_traits<Mixin>::result_type,
+                typename detail::mixin_traits<Mixin>::first_type>::value,
+      "In-place operation requires the result and left operand types match");
+  detail::transform_assign<detail::batch<Mixin>>(lhs, rhs);
+}
+
+/// @}
+
+}
+}
+
+#endif
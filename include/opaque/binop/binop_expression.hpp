@@ -0,0 +1,277 @@
+#ifndef OPAQUE_BINOP_EXPRESSION_HPP
+#define OPAQUE_BINOP_EXPRESSION_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+#include "../convert.hpp"
+#include <functional>
+#include <type_traits>
+
+namespace opaque {
+namespace binop {
+
+/// \addtogroup internal
+/// @{
+
+template <typename OP, typename RT, bool commutative,
+         typename I1, typename I2, typename L, typename R>
+struct expression;
+
+///
+/// Determine whether a type is a lazy binary expression
+///
+template <typename T>
+struct is_expression : std::false_type { };
+
+template <typename OP, typename RT, bool commutative,
+         typename I1, typename I2, typename L, typename R>
+struct is_expression<expression<OP,RT,commutative,I1,I2,L,R>>
+  : std::true_type { };
+
+///
+/// Determine whether a type is a lazy binary expression evaluating to T
+///
+template <typename E, typename T, bool = is_expression<E>::value>
+struct is_expression_of : std::false_type { };
+
+template <typename E, typename T>
+struct is_expression_of<E,T,true> : std::conditional<
+  std::is_same<typename E::result_type, T>::value,
+  std::true_type, std::false_type>::type { };
+
+//
+// Operands of an expression are stored as a reference to a const lvalue or
+// a reference to an rvalue.  A subexpression is always a temporary, and is
+// stored as a reference to const.  These provide uniform access to all of
+// them.
+//
+
+template <typename S>
+struct operand;
+
+template <typename P>
+struct operand<const P&> {
+  using type = P;
+  static constexpr const P& get(const P& s) noexcept { return s; }
+  template <typename T>
+  static T make(const P& s) { return convert_mutable<T>(s); }
+  template <typename T>
+  static void load(T& target, const P& s) {
+    auto&& source = convert<T>(s);
+    if (static_cast<const void*>(&source) != static_cast<const void*>(&target))
+      target = static_cast<decltype(source)>(source);
+  }
+  static bool overlaps(const P& s, const void * begin, const void * end) {
+    std::less<const void*> less;
+    return less(static_cast<const void*>(&s), end) and
+           less(begin, static_cast<const void*>(&s + 1));
+  }
+};
+
+template <typename P>
+struct operand<P&&> {
+  using type = P;
+  static constexpr P&& get(P& s) noexcept { return opaque::move(s); }
+  template <typename T>
+  static T make(P& s) { return convert_mutable<T>(opaque::move(s)); }
+  template <typename T>
+  static void load(T& target, P& s) {
+    auto&& source = convert<T>(opaque::move(s));
+    if (static_cast<const void*>(&source) != static_cast<const void*>(&target))
+      target = static_cast<decltype(source)>(source);
+  }
+  static bool overlaps(const P& s, const void * begin, const void * end) {
+    return operand<const P&>::overlaps(s, begin, end);
+  }
+};
+
+template <typename OP, typename RT, bool commutative,
+         typename I1, typename I2, typename L, typename R>
+struct operand<const expression<OP,RT,commutative,I1,I2,L,R>&> {
+  using E = expression<OP,RT,commutative,I1,I2,L,R>;
+  using type = RT;
+  static RT get(const E& s) { return s.evaluate(); }
+  template <typename T>
+  static typename std::enable_if<    std::is_same<T,RT>::value, T>::type
+  make(const E& s) { return s.evaluate(); }
+  template <typename T>
+  static typename std::enable_if<not std::is_same<T,RT>::value, T>::type
+  make(const E& s) { return convert_mutable<T>(s.evaluate()); }
+  template <typename T>
+  static typename std::enable_if<    std::is_same<T,RT>::value>::type
+  load(T& target, const E& s) { s.assign_to(target); }
+  template <typename T>
+  static typename std::enable_if<not std::is_same<T,RT>::value>::type
+  load(T& target, const E& s) { target = convert<T>(s.evaluate()); }
+  static bool overlaps(const E& s, const void * begin, const void * end) {
+    return s.overlaps(begin, end);
+  }
+};
+
+///
+/// Lazy binary expression
+///
+/// A binary operation whose evaluation is deferred until its destination is
+/// known.  A tree of expressions is evaluated in a single pass, by loading
+/// one operand into the destination and applying operator@= with the other,
+/// so a chain such as a + b + c + d creates no temporaries, and assigning it
+/// to an existing object reuses that object.
+///
+/// The template arguments have the same meaning as for binary_operator; L
+/// and R are the types holding the operands.
+///
+/// An expression refers to its operands, so it must be evaluated within the
+/// full-expression that creates it.
+///
+template <typename OP, typename RT, bool commutative,
+         typename I1, typename I2, typename L, typename R>
+struct expression {
+  typedef RT result_type;
+
+  L lhs;
+  R rhs;
+
+  /// Evaluate into a new object
+  RT evaluate() const {
+    return evaluate(std::integral_constant<bool, swap>());
+  }
+
+  /// Evaluate into an existing object, which may also be an operand
+  void assign_to(RT& dest) const {
+    assign_to(dest, std::integral_constant<bool, swap>());
+  }
+
+  /// Determine whether any operand overlaps the given storage
+  bool overlaps(const void * begin, const void * end) const {
+    return operand<L>::overlaps(lhs, begin, end) or
+           operand<R>::overlaps(rhs, begin, end);
+  }
+
+private:
+
+  using left_type = typename operand<L>::type;
+  using right_type = typename operand<R>::type;
+
+  static constexpr bool regular_well_formed =
+    is_functor_call_well_formed<OP,I1&,I2>::value;
+  static constexpr bool swapped_well_formed =
+    is_functor_call_well_formed<OP,I2&,I1>::value;
+  static_assert(regular_well_formed or swapped_well_formed,
+      "Operation is not well-formed");
+  static_assert(regular_well_formed or commutative,
+      "Operation is not commutative");
+
+  // Load the right operand instead of the left when only that is possible,
+  // or when it saves a copy because the left operand must be copied but the
+  // right one need not be.
+  static constexpr bool swap = commutative and swapped_well_formed and
+    (not regular_well_formed or
+     (std::is_same<L, const left_type&>::value and
+      not std::is_same<R, const right_type&>::value));
+
+  static constexpr bool in_place(std::false_type) noexcept {
+    return std::is_lvalue_reference<decltype(
+        convert_mutable<I1>(std::declval<RT&>()))>::value;
+  }
+  static constexpr bool in_place(std::true_type) noexcept {
+    return std::is_lvalue_reference<decltype(
+        convert_mutable<I2>(std::declval<RT&>()))>::value;
+  }
+
+  // SL and SA are the storage types of the loaded and applied operands.  For
+  // a reference to an rvalue, const SL& is a non-const lvalue reference.
+  template <typename IL, typename IA, typename SL, typename SA>
+  static IL compute(const SL& load, const SA& apply) {
+    IL temp(operand<SL>::template make<IL>(load));
+    OP{}(temp, convert<IA>(operand<SA>::get(apply)));
+    return temp;
+  }
+
+  template <typename IL, typename IA, typename SL, typename SA>
+  static typename std::enable_if<    std::is_same<IL,RT>::value, RT>::type
+  compute_result(const SL& load, const SA& apply) {
+    return compute<IL,IA,SL,SA>(load, apply);
+  }
+  template <typename IL, typename IA, typename SL, typename SA>
+  static typename std::enable_if<not std::is_same<IL,RT>::value, RT>::type
+  compute_result(const SL& load, const SA& apply) {
+    return static_cast<RT>(compute<IL,IA,SL,SA>(load, apply));
+  }
+
+  template <typename IL, typename IA, typename SL, typename SA>
+  void compute_into(RT& dest, const SL& load, const SA& apply,
+                    std::true_type) const {
+    if (operand<SA>::overlaps(apply, &dest, &dest + 1)) {
+      dest = evaluate();
+      return;
+    }
+    IL& target = convert_mutable<IL>(dest);
+    operand<SL>::load(target, load);
+    OP{}(target, convert<IA>(operand<SA>::get(apply)));
+  }
+  template <typename IL, typename IA, typename SL, typename SA>
+  void compute_into(RT& dest, const SL&, const SA&, std::false_type) const {
+    dest = evaluate();
+  }
+
+  RT evaluate(std::false_type) const {
+    return compute_result<I1,I2,L,R>(lhs, rhs);
+  }
+  RT evaluate(std::true_type) const {
+    return compute_result<I2,I1,R,L>(rhs, lhs);
+  }
+
+  // When only the right operand overlaps the destination, a commutative
+  // operation can still be evaluated in place by loading that operand.
+  static constexpr bool reversible =
+    commutative and regular_well_formed and swapped_well_formed;
+
+  void assign_to(RT& dest, std::false_type tag) const {
+    if (reversible and operand<R>::overlaps(rhs, &dest, &dest + 1) and
+        not operand<L>::overlaps(lhs, &dest, &dest + 1)) {
+      assign_to(dest, std::integral_constant<bool, reversible>());
+      return;
+    }
+    compute_into<I1,I2,L,R>(dest, lhs, rhs,
+        std::integral_constant<bool, in_place(tag)>());
+  }
+  void assign_to(RT& dest, std::true_type tag) const {
+    compute_into<I2,I1,R,L>(dest, rhs, lhs,
+        std::integral_constant<bool, in_place(tag)>());
+  }
+
+};
+
+/// @}
+
+}
+}
+
+#endif
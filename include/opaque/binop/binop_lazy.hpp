@@ -0,0 +1,110 @@
+#ifndef OPAQUE_BINOP_LAZY_HPP
+#define OPAQUE_BINOP_LAZY_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "binop_function.hpp"
+#include "binop_expression.hpp"
+#include "../utility.hpp"
+#include <type_traits>
+
+namespace opaque {
+namespace binop {
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Lazy counterparts of the classes in binop_inherit.hpp.  Instead of
+// computing the result, operator@ returns an expression to be evaluated when
+// it is assigned or converted to its result type.  The template arguments
+// are the same, and so are the permitted operand types, except that an
+// expression evaluating to an operand type is accepted in its place.
+//
+
+#define OPAQUE_BINOP_LAZY(NAME, OPERATOR, FUNCTOR, COMMUTATIVE) \
+template <typename RT, bool commutative=COMMUTATIVE, \
+         typename P1=RT, typename P2=RT, typename I1=P1, typename I2=P2> \
+struct NAME { \
+  using OP = FUNCTOR; \
+  template <typename L, typename R> \
+  using expr_t = expression<OP, RT, commutative, I1, I2, L, R>; \
+  template <typename E, typename P, typename L, typename R> \
+  using if_expr_t = typename std::enable_if< \
+    is_expression_of<E,P>::value, expr_t<L,R>>::type; \
+  friend constexpr expr_t<const P1&, const P2&> \
+  operator OPERATOR(const P1& p1, const P2& p2) noexcept { \
+    return { p1, p2 }; } \
+  friend constexpr expr_t<const P1&,       P2&&> \
+  operator OPERATOR(const P1& p1,       P2&& p2) noexcept { \
+    return { p1, opaque::move(p2) }; } \
+  friend constexpr expr_t<      P1&&, const P2&> \
+  operator OPERATOR(      P1&& p1, const P2& p2) noexcept { \
+    return { opaque::move(p1), p2 }; } \
+  friend constexpr expr_t<      P1&&,       P2&&> \
+  operator OPERATOR(      P1&& p1,       P2&& p2) noexcept { \
+    return { opaque::move(p1), opaque::move(p2) }; } \
+  template <typename E> friend constexpr if_expr_t<E, P1, const E&, const P2&> \
+  operator OPERATOR(const E& e, const P2& p2) { \
+    return { e, p2 }; } \
+  template <typename E> friend constexpr if_expr_t<E, P1, const E&,       P2&&> \
+  operator OPERATOR(const E& e,       P2&& p2) { \
+    return { e, opaque::move(p2) }; } \
+  template <typename E> friend constexpr if_expr_t<E, P2, const P1&, const E&> \
+  operator OPERATOR(const P1& p1, const E& e) { \
+    return { p1, e }; } \
+  template <typename E> friend constexpr if_expr_t<E, P2,       P1&&, const E&> \
+  operator OPERATOR(      P1&& p1, const E& e) { \
+    return { opaque::move(p1), e }; } \
+  template <typename E1, typename E2> friend constexpr \
+  typename std::enable_if<is_expression_of<E1,P1>::value and \
+                          is_expression_of<E2,P2>::value, \
+                          expr_t<const E1&, const E2&>>::type \
+  operator OPERATOR(const E1& e1, const E2& e2) { \
+    return { e1, e2 }; } \
+};
+
+OPAQUE_BINOP_LAZY(lazy_multipliable   , * ,    multiply_equal_t, true )
+OPAQUE_BINOP_LAZY(lazy_dividable      , / ,      divide_equal_t, false)
+OPAQUE_BINOP_LAZY(lazy_modulable      , % ,     modulus_equal_t, false)
+OPAQUE_BINOP_LAZY(lazy_addable        , + ,         add_equal_t, true )
+OPAQUE_BINOP_LAZY(lazy_subtractable   , - ,    subtract_equal_t, false)
+OPAQUE_BINOP_LAZY(lazy_left_shiftable , <<,  left_shift_equal_t, false)
+OPAQUE_BINOP_LAZY(lazy_right_shiftable, >>, right_shift_equal_t, false)
+OPAQUE_BINOP_LAZY(lazy_bitandable     , & ,      bitand_equal_t, true )
+OPAQUE_BINOP_LAZY(lazy_bitxorable     , ^ ,      bitxor_equal_t, true )
+OPAQUE_BINOP_LAZY(lazy_bitorable      , | ,       bitor_equal_t, true )
+
+#undef OPAQUE_BINOP_LAZY
+
+/// @}
+
+}
+}
+
+#endif
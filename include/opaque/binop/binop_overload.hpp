@@ -103,25 +103,29 @@ struct overload<OP,RT,false,const P1& ,      P2&&,I1,I2> {
 template <typename OP, typename RT,
          typename P1, typename P2, typename I1, typename I2>
 struct overload<OP,RT,false,      P1&&,const P2& ,I1,I2> {
+  // Operate on the intermediate as an lvalue and move it into the result
+  // once, even when the result is a different type
   static constexpr RT func(      P1&& p1, const P2&  p2, OP op=OP{}) noexcept(
-    noexcept(static_cast<RT>(
-        op(convert_mutable<I1>(opaque::move(p1)),
-           convert<I2>(                     p2 ))))) {
-    return   static_cast<RT>(
-        op(convert_mutable<I1>(opaque::move(p1)),
-           convert<I2>(                     p2 ))); }
+    noexcept(static_cast<RT>(opaque::move(
+        op(as_lvalue(convert_mutable<I1>(opaque::move(p1))),
+           convert<I2>(                               p2 )))))) {
+    return   static_cast<RT>(opaque::move(
+        op(as_lvalue(convert_mutable<I1>(opaque::move(p1))),
+           convert<I2>(                               p2 )))); }
 };
 
 template <typename OP, typename RT,
          typename P1, typename P2, typename I1, typename I2>
 struct overload<OP,RT,false,      P1&&,      P2&&,I1,I2> {
+  // Operate on the intermediate as an lvalue and move it into the result
+  // once, even when the result is a different type
   static constexpr RT func(      P1&& p1,       P2&& p2, OP op=OP{}) noexcept(
-    noexcept(static_cast<RT>(
-        op(convert_mutable<I1>(opaque::move(p1)),
-           convert<I2>(        opaque::move(p2)))))) {
-    return   static_cast<RT>(
-        op(convert_mutable<I1>(opaque::move(p1)),
-           convert<I2>(        opaque::move(p2)))); }
+    noexcept(static_cast<RT>(opaque::move(
+        op(as_lvalue(convert_mutable<I1>(opaque::move(p1))),
+           convert<I2>(                  opaque::move(p2))))))) {
+    return   static_cast<RT>(opaque::move(
+        op(as_lvalue(convert_mutable<I1>(opaque::move(p1))),
+           convert<I2>(                  opaque::move(p2))))); }
 };
 
 template <typename OP, typename RT,
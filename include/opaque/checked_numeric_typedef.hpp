@@ -0,0 +1,174 @@
+#ifndef OPAQUE_CHECKED_NUMERIC_TYPEDEF_HPP
+#define OPAQUE_CHECKED_NUMERIC_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "numeric_typedef.hpp"
+#include "overflow.hpp"
+#include <type_traits>
+#include <utility>
+
+namespace opaque {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Overflow-checked numeric opaque typedef
+///
+/// Same as numeric_typedef, except that the arithmetic operations detect
+/// when their result does not fit in the underlying type, and then defer
+/// to the overflow policy.  The check is a test of the overflow flag of
+/// the operation, where the compiler provides __builtin_add_overflow and
+/// its relatives, so that it is cheap enough to leave enabled.
+///
+/// The checked operations are +, -, *, /, %, their compound assignments,
+/// increment, decrement and negation.  Bitwise operations and shifts are
+/// those of numeric_typedef; they cannot overflow, except that shifts
+/// by the width of the type or more remain undefined.  Division by zero
+/// also remains undefined.  Signed division of the minimum by -1 is an
+/// overflow, and the remainder of that division is zero.
+///
+/// Template arguments for checked_numeric_typedef:
+///  -# U : The underlying type holding the value, which must be integral
+///  -# O : The opaque type, your subclass
+///  -# P : The overflow policy: throw_on_overflow, saturate_on_overflow,
+///         wrap_on_overflow or trap_on_overflow
+///  -# S : The right-hand operand type for shift operations
+///
+template <typename U, typename O, typename P = throw_on_overflow,
+          typename S = unsigned>
+struct checked_numeric_typedef : numeric_typedef<U,O,S> {
+private:
+  using base = numeric_typedef<U,O,S>;
+  static constexpr bool nothrow =
+    noexcept(P::overflow(std::declval<U>(), true));
+  using is_signed = std::is_signed<U>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  typedef P overflow_policy;
+  using base::value;
+
+  static_assert(std::is_integral<U>::value and
+                not std::is_same<U, bool>::value,
+                "checked_numeric_typedef requires an integral type");
+
+  constexpr14 opaque_type& operator*=(const opaque_type& peer) &
+    noexcept(nothrow) {
+    U r = U();
+    if (detail::mul_overflow(value, peer.value, r)) {
+      r = P::overflow(r, detail::is_negative(value) ==
+                         detail::is_negative(peer.value));
+    }
+    value = r;
+    return downcast(); }
+
+  constexpr14 opaque_type& operator/=(const opaque_type& peer) &
+    noexcept(nothrow) {
+    U r = U();
+    if (detail::div_overflow(value, peer.value, r, is_signed())) {
+      r = P::overflow(r, true);
+    }
+    value = r;
+    return downcast(); }
+
+  constexpr14 opaque_type& operator%=(const opaque_type& peer) &
+    noexcept {
+    value = detail::checked_mod(value, peer.value, is_signed());
+    return downcast(); }
+
+  constexpr14 opaque_type& operator+=(const opaque_type& peer) &
+    noexcept(nothrow) {
+    U r = U();
+    if (detail::add_overflow(value, peer.value, r)) {
+      r = P::overflow(r, not detail::is_negative(peer.value));
+    }
+    value = r;
+    return downcast(); }
+
+  constexpr14 opaque_type& operator-=(const opaque_type& peer) &
+    noexcept(nothrow) {
+    U r = U();
+    if (detail::sub_overflow(value, peer.value, r)) {
+      r = P::overflow(r, detail::is_negative(peer.value));
+    }
+    value = r;
+    return downcast(); }
+
+
+  constexpr14 opaque_type& operator++() &
+    noexcept(nothrow) {
+    if (detail::add_overflow(value, U(1), value)) {
+      value = P::overflow(value, true);
+    }
+    return downcast(); }
+
+  constexpr14 opaque_type& operator--() &
+    noexcept(nothrow) {
+    if (detail::sub_overflow(value, U(1), value)) {
+      value = P::overflow(value, false);
+    }
+    return downcast(); }
+
+  constexpr14 opaque_type operator++(int) & noexcept(nothrow) {
+    opaque_type r(value); operator++(); return r; }
+
+  constexpr14 opaque_type operator--(int) & noexcept(nothrow) {
+    opaque_type r(value); operator--(); return r; }
+
+
+  constexpr14 opaque_type operator-() const & noexcept(nothrow) {
+    U r = U();
+    if (detail::sub_overflow(U(0), value, r)) {
+      r = P::overflow(r, detail::is_negative(value));
+    }
+    return opaque_type(r); }
+
+  constexpr14 opaque_type operator-()       && noexcept(nothrow) {
+    return static_cast<const checked_numeric_typedef&>(*this).operator-(); }
+
+
+  using base::base;
+  explicit checked_numeric_typedef() = default;
+  checked_numeric_typedef(const checked_numeric_typedef& ) = default;
+  checked_numeric_typedef(      checked_numeric_typedef&&) = default;
+  checked_numeric_typedef& operator=(const checked_numeric_typedef& ) &
+    = default;
+  checked_numeric_typedef& operator=(      checked_numeric_typedef&&) &
+    = default;
+protected:
+  ~checked_numeric_typedef() = default;
+  using base::downcast;
+};
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,193 @@
+#ifndef OPAQUE_EXPERIMENTAL_CONCAT_HPP
+#define OPAQUE_EXPERIMENTAL_CONCAT_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../type_traits.hpp"
+#include "../utility.hpp"
+#include "string_typedef.hpp"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+//
+// Every piece of a concatenation is viewed as a pointer and a length, so
+// that the total length is known before anything is copied.
+//
+
+template <typename C>
+struct concat_piece {
+  const C * data;
+  std::size_t size;
+};
+
+template <typename T, typename = void>
+struct is_string_typedef : std::false_type { };
+template <typename T>
+struct is_string_typedef<T, void_t<typename T::underlying_type>>
+  : std::is_base_of<experimental::string_typedef<
+      typename T::underlying_type, T>, T> { };
+
+template <typename O, typename P, typename = void>
+struct concat_accepts : std::false_type { };
+template <typename O>
+struct concat_accepts<O, O> : std::true_type { };
+template <typename O>
+struct concat_accepts<O, typename O::value_type> : std::true_type { };
+// Character arrays only where the opaque type itself accepts them
+template <typename O, typename P>
+struct concat_accepts<O, P, typename std::enable_if<
+  is_string_typedef<O>::value and
+  (std::is_same<P, const typename O::value_type *>::value or
+   std::is_same<P,       typename O::value_type *>::value)>::type>
+  : std::true_type { };
+
+template <typename O>
+concat_piece<typename O::value_type> make_concat_piece(const O& o) noexcept {
+  return { o.data(), o.size() };
+}
+template <typename O>
+concat_piece<typename O::value_type> make_concat_piece(
+    const typename O::value_type& c) noexcept {
+  return { &c, 1 };
+}
+template <typename O>
+concat_piece<typename O::value_type> make_concat_piece(
+    const typename O::value_type * s) {
+  return { s, std::char_traits<typename O::value_type>::length(s) };
+}
+
+// The result type is the first opaque argument
+template <typename... P>
+struct concat_result { };
+template <typename P>
+struct concat_result_is { typedef P type; };
+template <typename P, typename... Rest>
+struct concat_result<P, Rest...> : std::conditional<
+  std::is_class<P>::value, concat_result_is<P>, concat_result<Rest...>>::type
+{ };
+
+template <bool...> struct concat_bools;
+template <bool... B>
+using concat_all = std::is_same<concat_bools<true, B...>,
+                                concat_bools<B..., true>>;
+
+// The result is an opaque type built from a string that can be appended to
+template <typename O, typename = void>
+struct concat_target : std::false_type { };
+template <typename O>
+struct concat_target<O, void_t<
+  decltype(std::declval<typename O::underlying_type&>().append(
+    std::declval<const typename O::value_type *>(), std::size_t())),
+  decltype(O(std::declval<typename O::underlying_type>()))>>
+  : std::true_type { };
+
+template <typename O, typename... P>
+using if_concat_t = typename std::enable_if<
+  concat_target<O>::value and
+  concat_all<concat_accepts<O, P>::value...>::value, O>::type;
+
+template <typename O, typename P, typename... Rest>
+typename std::enable_if<std::is_same<O,P>::value, const O&>::type
+first_opaque(const P& p, const Rest&...) noexcept { return p; }
+template <typename O, typename P, typename... Rest>
+typename std::enable_if<not std::is_same<O,P>::value, const O&>::type
+first_opaque(const P&, const Rest&... rest) noexcept {
+  return first_opaque<O>(rest...);
+}
+
+// Start from an empty string with the allocator of the first operand,
+// where the underlying type has one
+template <typename U>
+auto empty_like(const U& u, int) -> decltype(U(u.get_allocator())) {
+  return U(u.get_allocator());
+}
+template <typename U>
+U empty_like(const U&, long) { return U(); }
+
+template <typename U>
+auto reserve_for(U& u, std::size_t n, int) -> decltype(u.reserve(n)) {
+  return u.reserve(n);
+}
+template <typename U>
+void reserve_for(U&, std::size_t, long) { }
+
+}
+
+/// @}
+
+namespace experimental {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Concatenate strings of one opaque type with a single allocation
+///
+/// The arguments are opaque strings of a single type O, characters of
+/// that type, and, where O derives from string_typedef, null-terminated
+/// character arrays.  The result is of type O; it is built by measuring
+/// every piece, reserving the total once, and appending the pieces in
+/// order.  Where the underlying string type has an allocator, the result
+/// uses the allocator of the first opaque argument.  Arguments of any
+/// other type, including other opaque string types, make the call
+/// ill-formed, as does an O whose underlying type cannot be appended to,
+/// such as a string_view_typedef.
+///
+/// This replaces chains such as prefix + sep + id + suffix, where each
+/// operator+ whose left operand is an lvalue allocates a new string:
+///   key k = concat(prefix, '/', id, suffix);
+///
+template <typename... P,
+          typename O = typename opaque::detail::concat_result<P...>::type>
+opaque::detail::if_concat_t<O, typename std::decay<P>::type...>
+concat(const P&... pieces) {
+  using piece = opaque::detail::concat_piece<typename O::value_type>;
+  const piece views[] = { opaque::detail::make_concat_piece<O>(pieces)... };
+  std::size_t total = 0;
+  for (const piece& v : views) total += v.size;
+  typename O::underlying_type s = opaque::detail::empty_like(
+      opaque::detail::first_opaque<O>(pieces...).value, 0);
+  opaque::detail::reserve_for(s, total, 0);
+  for (const piece& v : views) s.append(v.data, v.size);
+  return O(opaque::move(s));
+}
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,118 @@
+#ifndef OPAQUE_EXPERIMENTAL_EXPR_NUMERIC_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_EXPR_NUMERIC_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../numeric_typedef.hpp"
+#include "../binop/binop_lazy.hpp"
+#include <type_traits>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Numeric opaque typedef with lazily evaluated operators
+///
+/// Same as numeric_typedef, but operator@ returns an expression that is
+/// evaluated in a single pass when it is assigned or converted to the opaque
+/// type.  This is worthwhile for an underlying type that is expensive to
+/// copy, such as a big number or a fixed-size vector: a + b + c + d is
+/// computed in the destination without temporaries.
+///
+/// Mixed-type operations can be added by inheriting from the
+/// opaque::binop::lazy_opname classes, which take the same template arguments
+/// as the opaque::binop::opname classes.
+///
+/// To evaluate an expression in place when assigning it to an existing
+/// object, bring the assignment operators into your subclass with
+///   using base::operator=;
+///
+/// An expression refers to its operands, so it must not outlive the
+/// full-expression that creates it.  In particular, do not store it in a
+/// variable declared with auto.
+///
+/// Template arguments for expr_numeric_typedef:
+///  -# U : The underlying type holding the value
+///  -# O : The opaque type, your subclass
+///  -# S : The right-hand operand type for shift operations
+///
+template <typename U, typename O, typename S = unsigned>
+struct expr_numeric_typedef : numeric_typedef_base<U,O,S>
+  , binop::lazy_multipliable   <O>
+  , binop::lazy_dividable      <O>
+  , binop::lazy_modulable      <O>
+  , binop::lazy_addable        <O>
+  , binop::lazy_subtractable   <O>
+  , binop::lazy_left_shiftable <O, false, O, S>
+  , binop::lazy_right_shiftable<O, false, O, S>
+  , binop::lazy_bitandable     <O>
+  , binop::lazy_bitxorable     <O>
+  , binop::lazy_bitorable      <O>
+{
+private:
+  using base = numeric_typedef_base<U,O,S>;
+  template <typename E, typename R = void>
+  using if_expr_t = typename std::enable_if<
+    binop::is_expression_of<E,O>::value, R>::type;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  /// Evaluate an expression
+  template <typename E, typename = if_expr_t<typename std::decay<E>::type>>
+  expr_numeric_typedef(E&& e)
+    : base(opaque::move(e.evaluate().value)) { }
+
+  /// Evaluate an expression in place
+  template <typename E>
+  if_expr_t<E, opaque_type&> operator=(const E& e) & {
+    e.assign_to(downcast());
+    return downcast();
+  }
+
+  using base::base;
+  explicit expr_numeric_typedef() = default;
+  expr_numeric_typedef(const expr_numeric_typedef& ) = default;
+  expr_numeric_typedef(      expr_numeric_typedef&&) = default;
+  expr_numeric_typedef& operator=(const expr_numeric_typedef& ) & = default;
+  expr_numeric_typedef& operator=(      expr_numeric_typedef&&) & = default;
+protected:
+  ~expr_numeric_typedef() = default;
+  using base::downcast;
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,863 @@
+#ifndef OPAQUE_EXPERIMENTAL_FIXED_STRING_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_FIXED_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../data.hpp"
+#include "../hash.hpp"
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// String with inline storage for up to N characters
+///
+/// This is a trivially copyable string that never allocates.  The
+/// characters are stored inline, null-terminated, followed by the length
+/// in the smallest unsigned integer type that can hold N.  Unused
+/// characters are kept zero, so that equal strings have equal character
+/// storage, and the object can be copied with memcpy, written to a file
+/// or memory-mapped.
+///
+/// Operations that would make the string longer than N characters throw
+/// std::length_error; positions out of range throw std::out_of_range.
+///
+template <std::size_t N>
+class fixed_string {
+  typedef typename std::conditional<(N <= 0xFFu), std::uint8_t,
+          typename std::conditional<(N <= 0xFFFFu), std::uint16_t,
+          typename std::conditional<(N <= 0xFFFFFFFFu), std::uint32_t,
+          std::size_t>::type>::type>::type length_type;
+
+public:
+  typedef std::char_traits<char>                traits_type;
+  typedef char                                  value_type;
+  typedef std::size_t                           size_type;
+  typedef std::ptrdiff_t                        difference_type;
+  typedef char&                                 reference;
+  typedef const char&                           const_reference;
+  typedef char*                                 pointer;
+  typedef const char*                           const_pointer;
+  typedef char*                                 iterator;
+  typedef const char*                           const_iterator;
+  typedef std::reverse_iterator<iterator>       reverse_iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+  static const size_type npos = size_type(0)-size_type(1);
+
+  fixed_string() noexcept : chars(), len() { }
+  fixed_string(const char * s, size_type n) : fixed_string() {
+    append(s, n);
+  }
+  fixed_string(const char * s) : fixed_string() {
+    append(s, traits_type::length(s));
+  }
+  fixed_string(size_type n, char c) : fixed_string() { append(n, c); }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  fixed_string(InputIterator first, InputIterator last) : fixed_string() {
+    append(first, last);
+  }
+  fixed_string(std::initializer_list<char> il) : fixed_string() {
+    append(il.begin(), il.size());
+  }
+  explicit fixed_string(const std::string& s) : fixed_string() {
+    append(s.data(), s.size());
+  }
+
+  /// Copy the characters to a std::string
+  std::string str() const { return std::string(data(), size()); }
+
+  iterator                 begin()       noexcept { return chars; }
+  const_iterator           begin() const noexcept { return chars; }
+  iterator                   end()       noexcept { return chars + len; }
+  const_iterator             end() const noexcept { return chars + len; }
+  reverse_iterator        rbegin()       noexcept {
+    return reverse_iterator(end()); }
+  const_reverse_iterator  rbegin() const noexcept {
+    return const_reverse_iterator(end()); }
+  reverse_iterator          rend()       noexcept {
+    return reverse_iterator(begin()); }
+  const_reverse_iterator    rend() const noexcept {
+    return const_reverse_iterator(begin()); }
+  const_iterator          cbegin() const noexcept { return begin(); }
+  const_iterator            cend() const noexcept { return end(); }
+  const_reverse_iterator crbegin() const noexcept { return rbegin(); }
+  const_reverse_iterator   crend() const noexcept { return rend(); }
+
+  size_type     size() const noexcept { return len; }
+  size_type   length() const noexcept { return len; }
+  static constexpr size_type max_size() noexcept { return N; }
+  static constexpr size_type capacity() noexcept { return N; }
+  bool empty()         const noexcept { return len == 0; }
+
+  void resize(size_type n, char c) {
+    if (n <= size()) erase(n); else append(n - size(), c);
+  }
+  void resize(size_type n) { resize(n, char()); }
+  void clear() noexcept { set_length(0); }
+
+  const_reference operator[](size_type pos) const noexcept {
+    assert(pos <= size());
+    return chars[pos];
+  }
+  reference operator[](size_type pos) noexcept {
+    assert(pos < size());
+    return chars[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("fixed_string::at");
+    return chars[pos];
+  }
+  reference at(size_type pos) {
+    if (pos >= size()) throw std::out_of_range("fixed_string::at");
+    return chars[pos];
+  }
+  const char& front() const noexcept { return chars[0]; }
+        char& front()       noexcept { return chars[0]; }
+  const char& back()  const noexcept { return chars[len - 1]; }
+        char& back()        noexcept { return chars[len - 1]; }
+
+  const char * c_str() const noexcept { return chars; }
+  const char * data()  const noexcept { return chars; }
+  char *       data()        noexcept { return chars; }
+
+  fixed_string& append(const char * s, size_type n) {
+    return replace(size(), 0, s, n);
+  }
+  fixed_string& append(size_type n, char c) {
+    return replace(size(), 0, n, c);
+  }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  fixed_string& append(InputIterator first, InputIterator last) {
+    for (; first != last; ++first) push_back(*first);
+    return *this;
+  }
+  void push_back(char c) {
+    if (size() == N) throw std::length_error("fixed_string");
+    chars[len] = c;
+    len = static_cast<length_type>(len + 1);
+  }
+  void pop_back() noexcept {
+    assert(not empty());
+    set_length(size() - 1u);
+  }
+
+  fixed_string& assign(const char * s, size_type n) {
+    return replace(0, npos, s, n);
+  }
+  fixed_string& assign(size_type n, char c) {
+    return replace(0, npos, n, c);
+  }
+
+  fixed_string& insert(size_type pos, const char * s, size_type n) {
+    return replace(pos, 0, s, n);
+  }
+  fixed_string& insert(size_type pos, size_type n, char c) {
+    return replace(pos, 0, n, c);
+  }
+
+  fixed_string& erase(size_type pos = 0, size_type n = npos) {
+    splice(pos, n, 0);
+    return *this;
+  }
+
+  fixed_string& replace(size_type pos, size_type n1,
+                        const char * s, size_type n2) {
+    if (std::greater_equal<const char*>()(s, chars) and
+        std::less<const char*>()(s, chars + sizeof(chars))) {
+      // The source is part of this string, which splice will modify
+      const fixed_string copy(*this);
+      return replace(pos, n1, copy.chars + (s - chars), n2);
+    }
+    traits_type::copy(splice(pos, n1, n2), s, n2);
+    return *this;
+  }
+  fixed_string& replace(size_type pos, size_type n1, size_type n2, char c) {
+    traits_type::assign(splice(pos, n1, n2), n2, c);
+    return *this;
+  }
+
+  size_type copy(char * s, size_type n, size_type pos = 0) const {
+    check_position(pos);
+    n = std::min(n, size() - pos);
+    traits_type::copy(s, chars + pos, n);
+    return n;
+  }
+
+  fixed_string substr(size_type pos = 0, size_type n = npos) const {
+    check_position(pos);
+    return fixed_string(chars + pos, std::min(n, size() - pos));
+  }
+
+  void swap(fixed_string& peer) noexcept {
+    const fixed_string t(*this);
+    *this = peer;
+    peer = t;
+  }
+
+  int compare(const char * s, size_type n) const noexcept {
+    const int r = traits_type::compare(chars, s, std::min(size(), n));
+    return r != 0 ? r : size() < n ? -1 : size() > n ? 1 : 0;
+  }
+  int compare(const fixed_string& peer) const noexcept {
+    return compare(peer.data(), peer.size());
+  }
+  int compare(size_type pos, size_type n1, const char * s,
+              size_type n2) const {
+    check_position(pos);
+    return fixed_string(chars + pos, std::min(n1, size() - pos))
+      .compare(s, n2);
+  }
+
+  size_type find(const char * s, size_type pos, size_type n) const noexcept {
+    if (n > size() or pos > size() - n) return npos;
+    if (n == 0) return pos;
+    for (const char * p = chars + pos; p + n <= end(); ++p) {
+      p = traits_type::find(p, static_cast<size_type>(end() - p), *s);
+      if (not p or p + n > end()) return npos;
+      if (traits_type::compare(p, s, n) == 0) return to_position(p);
+    }
+    return npos;
+  }
+  size_type find(char c, size_type pos = 0) const noexcept {
+    return find(&c, pos, 1);
+  }
+  size_type rfind(const char * s, size_type pos, size_type n) const noexcept {
+    if (n > size()) return npos;
+    for (size_type i = std::min(pos, size() - n); ; --i) {
+      if (traits_type::compare(chars + i, s, n) == 0) return i;
+      if (i == 0) return npos;
+    }
+  }
+  size_type rfind(char c, size_type pos = npos) const noexcept {
+    return rfind(&c, pos, 1);
+  }
+
+  size_type find_first_of(const char * s, size_type pos,
+                          size_type n) const noexcept {
+    return find_first(s, pos, n, true);
+  }
+  size_type find_last_of(const char * s, size_type pos,
+                         size_type n) const noexcept {
+    return find_last(s, pos, n, true);
+  }
+  size_type find_first_not_of(const char * s, size_type pos,
+                              size_type n) const noexcept {
+    return find_first(s, pos, n, false);
+  }
+  size_type find_last_not_of(const char * s, size_type pos,
+                             size_type n) const noexcept {
+    return find_last(s, pos, n, false);
+  }
+
+  friend bool operator==(const fixed_string& l, const fixed_string& r)
+    noexcept {
+    return l.len == r.len and traits_type::compare(l.chars, r.chars, l.len)
+      == 0;
+  }
+  friend bool operator!=(const fixed_string& l, const fixed_string& r)
+    noexcept { return not (l == r); }
+  friend bool operator< (const fixed_string& l, const fixed_string& r)
+    noexcept { return l.compare(r) <  0; }
+  friend bool operator> (const fixed_string& l, const fixed_string& r)
+    noexcept { return l.compare(r) >  0; }
+  friend bool operator<=(const fixed_string& l, const fixed_string& r)
+    noexcept { return l.compare(r) <= 0; }
+  friend bool operator>=(const fixed_string& l, const fixed_string& r)
+    noexcept { return l.compare(r) >= 0; }
+
+private:
+  void check_position(size_type pos) const {
+    if (pos > size()) throw std::out_of_range("fixed_string");
+  }
+
+  size_type to_position(const char * p) const noexcept {
+    return static_cast<size_type>(p - chars);
+  }
+
+  // Shrink to n characters, zeroing those removed
+  void set_length(size_type n) noexcept {
+    if (n < size()) traits_type::assign(chars + n, size() - n, char());
+    len = static_cast<length_type>(n);
+  }
+
+  // Replace [pos, pos+n1) with n2 characters for the caller to fill
+  char * splice(size_type pos, size_type n1, size_type n2) {
+    check_position(pos);
+    n1 = std::min(n1, size() - pos);
+    if (n2 > N - (size() - n1)) throw std::length_error("fixed_string");
+    const size_type n = size() - n1 + n2;
+    traits_type::move(chars + pos + n2, chars + pos + n1, size() - pos - n1);
+    if (n < size()) set_length(n);
+    else len = static_cast<length_type>(n);
+    return chars + pos;
+  }
+
+  size_type find_first(const char * s, size_type pos, size_type n,
+                       bool member) const noexcept {
+    for (size_type i = pos; i < size(); ++i) {
+      if ((traits_type::find(s, n, chars[i]) != nullptr) == member) return i;
+    }
+    return npos;
+  }
+  size_type find_last(const char * s, size_type pos, size_type n,
+                      bool member) const noexcept {
+    if (empty()) return npos;
+    for (size_type i = std::min(pos, size() - 1); ; --i) {
+      if ((traits_type::find(s, n, chars[i]) != nullptr) == member) return i;
+      if (i == 0) return npos;
+    }
+  }
+
+  char chars[N + 1];
+  length_type len;
+};
+
+template <std::size_t N>
+const typename fixed_string<N>::size_type fixed_string<N>::npos;
+
+/// @}
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Fixed-capacity string opaque typedef base type
+///
+/// This is an opaque typedef base class for strings of at most N
+/// characters, stored inline in a fixed_string.  It never allocates, and
+/// it is trivially copyable, so arrays of it may be copied with memcpy or
+/// memory-mapped.  The interface follows safer_string_typedef: there is
+/// no interoperability with character arrays in ways that would modify
+/// the opaque object or create new opaque object instances, and
+/// operations that would exceed the capacity throw std::length_error.
+///
+/// OPAQUE_HASHABLE hashes the characters with opaque::hashing::hash_bytes.
+///
+/// Template arguments:
+///  -# N : The capacity in characters
+///  -# R : The result type, your subclass
+///
+template <std::size_t N, typename R>
+struct fixed_string_typedef : data<fixed_string<N>,R> {
+private:
+  using base = opaque::data<fixed_string<N>,R>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  typedef typename underlying_type::traits_type            traits_type;
+  typedef typename underlying_type::value_type             value_type;
+  typedef typename underlying_type::size_type              size_type;
+  typedef typename underlying_type::difference_type        difference_type;
+  typedef typename underlying_type::reference              reference;
+  typedef typename underlying_type::const_reference        const_reference;
+  typedef typename underlying_type::pointer                pointer;
+  typedef typename underlying_type::const_pointer          const_pointer;
+  typedef typename underlying_type::iterator               iterator;
+  typedef typename underlying_type::const_iterator         const_iterator;
+  typedef typename underlying_type::reverse_iterator       reverse_iterator;
+  typedef typename underlying_type::const_reverse_iterator
+    const_reverse_iterator;
+  static const size_type npos = size_type(0)-size_type(1);
+
+private:
+  typedef char charT;
+public:
+
+  //
+  // Constructors follow safer_string_typedef: explicit construction from
+  // underlying_type, and explicit construction from anything else.
+  //
+
+  explicit fixed_string_typedef(const underlying_type& str) noexcept
+    : base(str) { }
+  explicit fixed_string_typedef(const underlying_type& str, size_type pos,
+      size_type n = npos)
+    : base(str.substr(pos, n)) { }
+  fixed_string_typedef(const opaque_type& str, size_type pos,
+      size_type n = npos)
+    : base(str.value.substr(pos, n)) { }
+  explicit fixed_string_typedef(const charT* s, size_type n)
+    : base(s, n) { }
+  explicit fixed_string_typedef(const charT* s)
+    : base(s) { }
+  explicit fixed_string_typedef(size_type n, charT c)
+    : base(n, c) { }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  explicit fixed_string_typedef(InputIterator Begin, InputIterator End)
+    : base(Begin, End) { }
+  explicit fixed_string_typedef(std::initializer_list<charT> il)
+    : base(il) { }
+  explicit fixed_string_typedef(const std::string& str)
+    : base(str) { }
+
+  opaque_type& operator=(charT c) {
+    value.assign(1, c);
+    return downcast();
+  }
+  opaque_type& operator=(std::initializer_list<charT> il) {
+    value.assign(il.begin(), il.size());
+    return downcast();
+  }
+
+  /// Copy the characters to a std::string
+  std::string str() const { return value.str(); }
+
+  iterator                 begin()       noexcept { return value.begin()  ; }
+  const_iterator           begin() const noexcept { return value.begin()  ; }
+  iterator                   end()       noexcept { return value.end()    ; }
+  const_iterator             end() const noexcept { return value.end()    ; }
+  reverse_iterator        rbegin()       noexcept { return value.rbegin() ; }
+  const_reverse_iterator  rbegin() const noexcept { return value.rbegin() ; }
+  reverse_iterator          rend()       noexcept { return value.rend()   ; }
+  const_reverse_iterator    rend() const noexcept { return value.rend()   ; }
+  const_iterator          cbegin() const noexcept { return value.cbegin() ; }
+  const_iterator            cend() const noexcept { return value.cend()   ; }
+  const_reverse_iterator crbegin() const noexcept { return value.crbegin(); }
+  const_reverse_iterator   crend() const noexcept { return value.crend()  ; }
+
+  size_type     size() const noexcept { return value.size(); }
+  size_type   length() const noexcept { return value.length(); }
+  static constexpr size_type max_size() noexcept { return N; }
+  static constexpr size_type capacity() noexcept { return N; }
+  void resize(size_type n, charT c)   { return value.resize(n, c); }
+  void resize(size_type n)            { return value.resize(n); }
+  void clear()               noexcept { return value.clear(); }
+  bool empty()         const noexcept { return value.empty(); }
+
+  const_reference operator[](size_type pos) const { return value[pos]; }
+        reference operator[](size_type pos)       { return value[pos]; }
+  const_reference at(size_type n)           const { return value.at(n); }
+        reference at(size_type n)                 { return value.at(n); }
+
+  const charT& front() const { return value.front(); }
+        charT& front()       { return value.front(); }
+  const charT& back()  const { return value.back(); }
+        charT& back()        { return value.back(); }
+
+  opaque_type& operator+=(const opaque_type& str) {
+    return append(str);
+  }
+  opaque_type& operator+=(charT c) {
+    value.push_back(c);
+    return downcast();
+  }
+  opaque_type& operator+=(std::initializer_list<charT> il) {
+    return append(il);
+  }
+  opaque_type& append(const opaque_type& str) {
+    value.append(str.data(), str.size());
+    return downcast();
+  }
+  opaque_type& append(const opaque_type& str, size_type pos,
+      size_type n = npos) {
+    const underlying_type s = str.value.substr(pos, n);
+    value.append(s.data(), s.size());
+    return downcast();
+  }
+  opaque_type& append(size_type n, charT c) {
+    value.append(n, c);
+    return downcast();
+  }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  opaque_type& append(InputIterator first, InputIterator last) {
+    value.append(first, last);
+    return downcast();
+  }
+  opaque_type& append(std::initializer_list<charT> il) {
+    value.append(il.begin(), il.size());
+    return downcast();
+  }
+  void push_back(charT c) {
+    return value.push_back(c);
+  }
+
+  opaque_type& assign(const opaque_type& str) {
+    value = str.value;
+    return downcast();
+  }
+  opaque_type& assign(const opaque_type& str, size_type pos,
+      size_type n = npos) {
+    value = str.value.substr(pos, n);
+    return downcast();
+  }
+  opaque_type& assign(size_type n, charT c) {
+    value.assign(n, c);
+    return downcast();
+  }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  opaque_type& assign(InputIterator first, InputIterator last) {
+    value = underlying_type(first, last);
+    return downcast();
+  }
+  opaque_type& assign(std::initializer_list<charT> il) {
+    value.assign(il.begin(), il.size());
+    return downcast();
+  }
+
+  opaque_type& insert(size_type pos1, const opaque_type& str) {
+    value.insert(pos1, str.data(), str.size());
+    return downcast();
+  }
+  opaque_type& insert(size_type pos1, const opaque_type& str,
+      size_type pos2, size_type n = npos) {
+    const underlying_type s = str.value.substr(pos2, n);
+    value.insert(pos1, s.data(), s.size());
+    return downcast();
+  }
+  opaque_type& insert(size_type pos, size_type n, charT c) {
+    value.insert(pos, n, c);
+    return downcast();
+  }
+  iterator insert(const_iterator p, charT c) {
+    return insert(p, 1, c);
+  }
+  iterator insert(const_iterator p, size_type n, charT c) {
+    const size_type pos = position(p);
+    value.insert(pos, n, c);
+    return begin() + pos;
+  }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  iterator insert(const_iterator p, InputIterator first, InputIterator last) {
+    const size_type pos = position(p);
+    const underlying_type s(first, last);
+    value.insert(pos, s.data(), s.size());
+    return begin() + pos;
+  }
+  iterator insert(const_iterator p, std::initializer_list<charT> il) {
+    const size_type pos = position(p);
+    value.insert(pos, il.begin(), il.size());
+    return begin() + pos;
+  }
+
+  opaque_type& erase(size_type pos = 0, size_type n = npos) {
+    value.erase(pos, n);
+    return downcast();
+  }
+  iterator erase(const_iterator p) {
+    return erase(p, p + 1);
+  }
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_type pos = position(first);
+    value.erase(pos, static_cast<size_type>(last - first));
+    return begin() + pos;
+  }
+
+  void pop_back() { return value.pop_back(); }
+
+  opaque_type& replace(size_type pos1, size_type n1, const opaque_type& str) {
+    value.replace(pos1, n1, str.data(), str.size());
+    return downcast();
+  }
+  opaque_type& replace(size_type pos1, size_type n1, const opaque_type& str,
+      size_type pos2, size_type n2 = npos) {
+    const underlying_type s = str.value.substr(pos2, n2);
+    value.replace(pos1, n1, s.data(), s.size());
+    return downcast();
+  }
+  opaque_type& replace(size_type pos, size_type n1, size_type n2, charT c) {
+    value.replace(pos, n1, n2, c);
+    return downcast();
+  }
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      const opaque_type& str) {
+    return replace(position(i1), static_cast<size_type>(i2 - i1), str);
+  }
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      const charT* s, size_type n) {
+    value.replace(position(i1), static_cast<size_type>(i2 - i1), s, n);
+    return downcast();
+  }
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      const charT* s) {
+    return replace(i1, i2, s, traits_type::length(s));
+  }
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      size_type n, charT c) {
+    value.replace(position(i1), static_cast<size_type>(i2 - i1), n, c);
+    return downcast();
+  }
+  template <class InputIterator, typename = typename std::enable_if<
+    not std::is_integral<InputIterator>::value>::type>
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      InputIterator j1, InputIterator j2) {
+    const underlying_type s(j1, j2);
+    return replace(i1, i2, s.data(), s.size());
+  }
+  opaque_type& replace(const_iterator i1, const_iterator i2,
+      std::initializer_list<charT> il) {
+    return replace(i1, i2, il.begin(), il.size());
+  }
+
+  size_type copy(charT* s, size_type n, size_type pos = 0) const {
+    return value.copy(s, n, pos);
+  }
+  void swap(opaque_type& str) noexcept { return value.swap(str.value); }
+
+  const charT* c_str() const noexcept { return value.c_str(); }
+  const charT* data()  const noexcept { return value.data(); }
+
+  size_type find (const opaque_type& str, size_type pos = 0) const noexcept {
+    return value.find(str.data(), pos, str.size());
+  }
+  size_type find (const charT* s, size_type pos, size_type n) const {
+    return value.find(s, pos, n);
+  }
+  size_type find (const charT* s, size_type pos = 0) const {
+    return value.find(s, pos, traits_type::length(s));
+  }
+  size_type find (charT c, size_type pos = 0) const noexcept {
+    return value.find(c, pos);
+  }
+  size_type rfind(const opaque_type& str, size_type pos = npos) const noexcept {
+    return value.rfind(str.data(), pos, str.size());
+  }
+  size_type rfind(const charT* s, size_type pos, size_type n) const {
+    return value.rfind(s, pos, n);
+  }
+  size_type rfind(const charT* s, size_type pos = npos) const {
+    return value.rfind(s, pos, traits_type::length(s));
+  }
+  size_type rfind(charT c, size_type pos = npos) const noexcept {
+    return value.rfind(c, pos);
+  }
+
+  size_type find_first_of(const opaque_type& str, size_type pos = 0) const
+    noexcept {
+    return value.find_first_of(str.data(), pos, str.size());
+  }
+  size_type find_first_of(const charT* s, size_type pos, size_type n) const {
+    return value.find_first_of(s, pos, n);
+  }
+  size_type find_first_of(const charT* s, size_type pos = 0) const {
+    return value.find_first_of(s, pos, traits_type::length(s));
+  }
+  size_type find_first_of(charT c, size_type pos = 0) const noexcept {
+    return value.find_first_of(&c, pos, 1);
+  }
+  size_type find_last_of (const opaque_type& str, size_type pos = npos) const
+    noexcept {
+    return value.find_last_of(str.data(), pos, str.size());
+  }
+  size_type find_last_of (const charT* s, size_type pos, size_type n) const {
+    return value.find_last_of(s, pos, n);
+  }
+  size_type find_last_of (const charT* s, size_type pos = npos) const {
+    return value.find_last_of(s, pos, traits_type::length(s));
+  }
+  size_type find_last_of (charT c, size_type pos = npos) const noexcept {
+    return value.find_last_of(&c, pos, 1);
+  }
+
+  size_type find_first_not_of(const opaque_type& str, size_type pos = 0) const
+    noexcept {
+    return value.find_first_not_of(str.data(), pos, str.size());
+  }
+  size_type find_first_not_of(const charT* s, size_type pos, size_type n)
+    const {
+    return value.find_first_not_of(s, pos, n);
+  }
+  size_type find_first_not_of(const charT* s, size_type pos = 0) const {
+    return value.find_first_not_of(s, pos, traits_type::length(s));
+  }
+  size_type find_first_not_of(charT c, size_type pos = 0) const noexcept {
+    return value.find_first_not_of(&c, pos, 1);
+  }
+  size_type find_last_not_of (const opaque_type& str, size_type pos = npos)
+    const noexcept {
+    return value.find_last_not_of(str.data(), pos, str.size());
+  }
+  size_type find_last_not_of (const charT* s, size_type pos, size_type n)
+    const {
+    return value.find_last_not_of(s, pos, n);
+  }
+  size_type find_last_not_of (const charT* s, size_type pos = npos) const {
+    return value.find_last_not_of(s, pos, traits_type::length(s));
+  }
+  size_type find_last_not_of (charT c, size_type pos = npos) const noexcept {
+    return value.find_last_not_of(&c, pos, 1);
+  }
+
+  opaque_type substr(size_type pos = 0, size_type n = npos) const {
+    return opaque_type(value.substr(pos, n));
+  }
+  int compare(const opaque_type& str) const noexcept {
+    return value.compare(str.value);
+  }
+  int compare(size_type pos1, size_type n1, const opaque_type& str) const {
+    return value.compare(pos1, n1, str.data(), str.size());
+  }
+  int compare(size_type pos1, size_type n1, const opaque_type& str,
+      size_type pos2, size_type n2 = npos) const {
+    const underlying_type s = str.value.substr(pos2, n2);
+    return value.compare(pos1, n1, s.data(), s.size());
+  }
+  int compare(const charT* s) const {
+    return value.compare(s, traits_type::length(s));
+  }
+  int compare(size_type pos1, size_type n1, const charT* s) const {
+    return value.compare(pos1, n1, s, traits_type::length(s));
+  }
+  int compare(size_type pos1, size_type n1, const charT* s, size_type n2)
+    const {
+    return value.compare(pos1, n1, s, n2);
+  }
+
+  friend opaque_type operator+(const opaque_type& l, const opaque_type& r) {
+    opaque_type result(l);
+    return result.append(r);
+  }
+  friend opaque_type operator+(      charT lhs, const opaque_type& rhs) {
+    opaque_type result(1, lhs);
+    return result.append(rhs);
+  }
+  friend opaque_type operator+(const opaque_type& lhs,       charT rhs) {
+    opaque_type result(lhs);
+    return result += rhs;
+  }
+
+  friend bool operator==(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value == rhs.value;
+  }
+  friend bool operator==(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) == 0;
+  }
+  friend bool operator==(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) == 0;
+  }
+  friend bool operator!=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value != rhs.value;
+  }
+  friend bool operator!=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) != 0;
+  }
+  friend bool operator!=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) != 0;
+  }
+
+  friend bool operator< (const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value <  rhs.value;
+  }
+  friend bool operator< (const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) >  0;
+  }
+  friend bool operator< (const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) <  0;
+  }
+  friend bool operator> (const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value >  rhs.value;
+  }
+  friend bool operator> (const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) <  0;
+  }
+  friend bool operator> (const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) >  0;
+  }
+
+  friend bool operator<=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value <= rhs.value;
+  }
+  friend bool operator<=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) >= 0;
+  }
+  friend bool operator<=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) <= 0;
+  }
+  friend bool operator>=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value >= rhs.value;
+  }
+  friend bool operator>=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) <= 0;
+  }
+  friend bool operator>=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  friend void swap(opaque_type& lhs, opaque_type& rhs) noexcept {
+    return lhs.value.swap(rhs.value);
+  }
+
+  fixed_string_typedef() = default;
+  fixed_string_typedef(const fixed_string_typedef& ) = default;
+  fixed_string_typedef(      fixed_string_typedef&&) = default;
+  fixed_string_typedef& operator=(const fixed_string_typedef& ) = default;
+  fixed_string_typedef& operator=(      fixed_string_typedef&&) = default;
+protected:
+  ~fixed_string_typedef() = default;
+  using base::downcast;
+
+private:
+  size_type position(const_iterator p) const noexcept {
+    return static_cast<size_type>(p - begin());
+  }
+};
+
+template <std::size_t N, typename R>
+const typename fixed_string_typedef<N,R>::size_type
+fixed_string_typedef<N,R>::npos;
+
+/// @}
+
+}
+}
+
+namespace std {
+
+/// Hash the characters of a fixed_string
+template <std::size_t N>
+struct hash<opaque::experimental::fixed_string<N>> {
+  using argument_type = opaque::experimental::fixed_string<N>;
+  using result_type = size_t;
+  result_type operator()(const argument_type& s) const noexcept {
+    return static_cast<size_t>(opaque::hashing::hash_bytes(s.data(), s.size()));
+  }
+};
+
+}
+
+#endif
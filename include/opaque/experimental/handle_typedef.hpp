@@ -0,0 +1,152 @@
+#ifndef OPAQUE_EXPERIMENTAL_HANDLE_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_HANDLE_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../numeric_typedef.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Numeric opaque typedef to represent a generational handle
+///
+/// A handle packs a slot index and a generation counter into a single
+/// unsigned word, with the index in the low IndexBits bits and the
+/// generation in the GenerationBits bits above it.  A container that
+/// bumps the generation of a slot when its element is erased can then
+/// recognize a handle to the erased element, even after the slot has been
+/// reused.  See opaque::slot_map.
+///
+/// The underlying type is std::uint32_t when the two fields fit in 32
+/// bits, and std::uint64_t otherwise.  A value-initialized handle has
+/// generation zero, which a container never hands out, so it can serve as
+/// a null handle.
+///
+/// Handles may be compared, but the arithmetic operations are deleted.
+///
+/// Template arguments for handle_typedef:
+///  -# O : The opaque type, your subclass
+///  -# IndexBits : The number of bits used for the index
+///  -# GenerationBits : The number of bits used for the generation
+///
+template <typename O, unsigned IndexBits, unsigned GenerationBits>
+struct handle_typedef
+  : numeric_typedef_base<typename std::conditional<
+      (IndexBits + GenerationBits <= 32), std::uint32_t, std::uint64_t>::type,
+      O>
+{
+  static_assert(IndexBits > 0 and GenerationBits > 0,
+      "A handle needs both index and generation bits");
+  static_assert(IndexBits + GenerationBits <= 64,
+      "A handle must fit in 64 bits");
+private:
+  using base = numeric_typedef_base<typename std::conditional<
+      (IndexBits + GenerationBits <= 32), std::uint32_t, std::uint64_t>::type,
+      O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  static constexpr unsigned index_bits = IndexBits;
+  static constexpr unsigned generation_bits = GenerationBits;
+  static constexpr underlying_type max_index =
+    static_cast<underlying_type>(~underlying_type(0) >>
+        (8 * sizeof(underlying_type) - IndexBits));
+  static constexpr underlying_type max_generation =
+    static_cast<underlying_type>(~underlying_type(0) >>
+        (8 * sizeof(underlying_type) - GenerationBits));
+
+  /// Pack an index and a generation into a handle
+  static constexpr opaque_type make(underlying_type index,
+                                    underlying_type generation) noexcept {
+    return opaque_type(static_cast<underlying_type>(
+          (index & max_index) |
+          static_cast<underlying_type>(
+            (generation & max_generation) << IndexBits)));
+  }
+
+  constexpr underlying_type index() const noexcept {
+    return static_cast<underlying_type>(value & max_index);
+  }
+  constexpr underlying_type generation() const noexcept {
+    return static_cast<underlying_type>((value >> IndexBits) & max_generation);
+  }
+
+  opaque_type& operator*= (const opaque_type&) = delete;
+  opaque_type& operator/= (const opaque_type&) = delete;
+  opaque_type& operator%= (const opaque_type&) = delete;
+  opaque_type& operator+= (const opaque_type&) = delete;
+  opaque_type& operator-= (const opaque_type&) = delete;
+  opaque_type& operator<<=(const unsigned&) = delete;
+  opaque_type& operator>>=(const unsigned&) = delete;
+  opaque_type& operator&= (const opaque_type&) = delete;
+  opaque_type& operator^= (const opaque_type&) = delete;
+  opaque_type& operator|= (const opaque_type&) = delete;
+  opaque_type& operator++() = delete;
+  opaque_type& operator--() = delete;
+  opaque_type  operator++(int) = delete;
+  opaque_type  operator--(int) = delete;
+  opaque_type  operator+() const = delete;
+  opaque_type  operator-() const = delete;
+  opaque_type  operator~() const = delete;
+
+  using base::base;
+  explicit handle_typedef() = default;
+  handle_typedef(const handle_typedef& ) = default;
+  handle_typedef(      handle_typedef&&) = default;
+  handle_typedef& operator=(const handle_typedef& ) & = default;
+  handle_typedef& operator=(      handle_typedef&&) & = default;
+protected:
+  ~handle_typedef() = default;
+  using base::downcast;
+};
+
+template <typename O, unsigned I, unsigned G>
+constexpr unsigned handle_typedef<O,I,G>::index_bits;
+template <typename O, unsigned I, unsigned G>
+constexpr unsigned handle_typedef<O,I,G>::generation_bits;
+template <typename O, unsigned I, unsigned G>
+constexpr typename handle_typedef<O,I,G>::underlying_type
+handle_typedef<O,I,G>::max_index;
+template <typename O, unsigned I, unsigned G>
+constexpr typename handle_typedef<O,I,G>::underlying_type
+handle_typedef<O,I,G>::max_generation;
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,361 @@
+#ifndef OPAQUE_EXPERIMENTAL_INTERNED_STRING_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_INTERNED_STRING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../data.hpp"
+#include "../hash.hpp"
+#include "safer_string_typedef.hpp"
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Table of interned strings, identified by 32-bit ids
+///
+/// Interning a string returns an id that is equal to the id of every
+/// equal string interned in the same table.  Strings are never removed,
+/// and their storage never moves, so references to them stay valid for
+/// the lifetime of the table.  The empty string always has id 0.
+///
+/// All operations are thread-safe.  Looking up the string of an id, and
+/// interning a string that is already present, are lock-free: they read
+/// the table through atomically published pointers.  Adding a new string
+/// takes a mutex.  Superseded lookup indexes are kept until the table is
+/// destroyed, because concurrent readers may still be probing them.
+///
+class intern_table {
+public:
+  typedef std::uint32_t id_type;
+
+  intern_table() {
+    std::lock_guard<std::mutex> lock(mutex);
+    grow(minimum_index);
+    add(std::string());
+  }
+  ~intern_table() {
+    for (auto& s : segments) delete[] s.load(std::memory_order_relaxed);
+  }
+  intern_table(const intern_table&) = delete;
+  intern_table& operator=(const intern_table&) = delete;
+
+  /// The table shared by every interned string type with this tag
+  template <typename Tag>
+  static intern_table& instance() {
+    static intern_table table;
+    return table;
+  }
+
+  /// Intern a string, returning its id
+  id_type intern(const char * s, std::size_t n) {
+    const std::uint64_t h = hashing::hash_bytes(s, n);
+    id_type id;
+    if (lookup(s, n, h, id)) return id;
+    std::lock_guard<std::mutex> lock(mutex);
+    if (lookup(s, n, h, id)) return id;
+    return add(std::string(s, n), h);
+  }
+  id_type intern(const std::string& s) { return intern(s.data(), s.size()); }
+
+  /// Find the id of a string without interning it
+  bool find(const char * s, std::size_t n, id_type& id) const noexcept {
+    return lookup(s, n, hashing::hash_bytes(s, n), id);
+  }
+
+  /// The string of an id, which must have been returned by this table
+  const std::string& str(id_type id) const noexcept {
+    assert(id < size());
+    const std::size_t q = (id / segment_base) + 1;
+    const unsigned k = log2(q);
+    const std::size_t offset = id - segment_base * ((std::size_t(1) << k) - 1);
+    return segments[k].load(std::memory_order_acquire)[offset];
+  }
+
+  /// The number of interned strings
+  std::size_t size() const noexcept {
+    return count.load(std::memory_order_acquire);
+  }
+
+private:
+  // Each slot of the index packs the high half of a string's hash with
+  // its id plus one, so that an empty slot is zero
+  struct index {
+    explicit index(std::size_t capacity)
+      : mask(capacity - 1), slots(new std::atomic<std::uint64_t>[capacity]) {
+      for (std::size_t i = 0; i < capacity; ++i) {
+        slots[i].store(0, std::memory_order_relaxed);
+      }
+    }
+    std::size_t mask;
+    std::unique_ptr<std::atomic<std::uint64_t>[]> slots;
+  };
+
+  static constexpr std::size_t minimum_index = 64;
+  static constexpr std::size_t segment_base = 64;
+  // Segment k holds segment_base << k strings; enough for every id
+  static constexpr unsigned segment_count = 27;
+  static constexpr id_type max_id = ~id_type(0) - 1;
+
+  static unsigned log2(std::size_t q) noexcept {
+    unsigned k = 0;
+    while (q >>= 1) ++k;
+    return k;
+  }
+
+  static std::uint64_t tag(std::uint64_t h) noexcept {
+    return h & 0xFFFFFFFF00000000ull;
+  }
+
+  bool lookup(const char * s, std::size_t n, std::uint64_t h,
+              id_type& id) const noexcept {
+    const index * x = current.load(std::memory_order_acquire);
+    for (std::size_t i = static_cast<std::size_t>(h) & x->mask; ;
+         i = (i + 1) & x->mask) {
+      const std::uint64_t v = x->slots[i].load(std::memory_order_acquire);
+      if (v == 0) return false;
+      if (tag(v) == tag(h)) {
+        const id_type candidate = static_cast<id_type>(v - 1);
+        const std::string& t = str(candidate);
+        if (t.size() == n and std::memcmp(t.data(), s, n) == 0) {
+          id = candidate;
+          return true;
+        }
+      }
+    }
+  }
+
+  static void insert(const index& x, std::uint64_t h, id_type id) noexcept {
+    std::size_t i = static_cast<std::size_t>(h) & x.mask;
+    while (x.slots[i].load(std::memory_order_relaxed) != 0) {
+      i = (i + 1) & x.mask;
+    }
+    x.slots[i].store(tag(h) | (std::uint64_t(id) + 1),
+                     std::memory_order_release);
+  }
+
+  // The following require the mutex to be held
+
+  void grow(std::size_t capacity) {
+    std::unique_ptr<index> x(new index(capacity));
+    const std::size_t n = count.load(std::memory_order_relaxed);
+    for (std::size_t id = 0; id < n; ++id) {
+      const std::string& s = str(static_cast<id_type>(id));
+      insert(*x, hashing::hash_bytes(s.data(), s.size()),
+             static_cast<id_type>(id));
+    }
+    indexes.reserve(indexes.size() + 1);
+    current.store(x.get(), std::memory_order_release);
+    indexes.push_back(opaque::move(x));
+  }
+
+  id_type add(std::string&& s) {
+    const std::uint64_t h = hashing::hash_bytes(s.data(), s.size());
+    return add(opaque::move(s), h);
+  }
+
+  id_type add(std::string&& s, std::uint64_t h) {
+    const std::size_t n = count.load(std::memory_order_relaxed);
+    if (n > max_id) throw std::length_error("intern_table::intern");
+    const index * x = current.load(std::memory_order_relaxed);
+    if (2 * (n + 1) > x->mask + 1) grow(2 * (x->mask + 1));
+
+    const std::size_t q = (n / segment_base) + 1;
+    const unsigned k = log2(q);
+    std::string * segment = segments[k].load(std::memory_order_relaxed);
+    if (not segment) {
+      segment = new std::string[segment_base << k];
+      segments[k].store(segment, std::memory_order_release);
+    }
+    segment[n - segment_base * ((std::size_t(1) << k) - 1)] =
+      opaque::move(s);
+
+    const id_type id = static_cast<id_type>(n);
+    count.store(n + 1, std::memory_order_release);
+    insert(*current.load(std::memory_order_relaxed), h, id);
+    return id;
+  }
+
+  std::mutex mutex;
+  std::atomic<std::string *> segments[segment_count] = { };
+  std::atomic<std::size_t> count{0};
+  std::atomic<const index *> current{nullptr};
+  std::vector<std::unique_ptr<index>> indexes;
+};
+
+/// @}
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Interned string opaque typedef base type
+///
+/// This is an opaque typedef base class for immutable strings that are
+/// stored once, in an intern_table, and represented by their 32-bit id.
+/// Copies never allocate, and equality is a single integer comparison.
+/// Hashing the underlying value (as OPAQUE_HASHABLE does) is likewise a
+/// single integer operation.  The characters are available through
+/// str(), c_str(), data() and size(), and through view() as a
+/// std::string_view when compiling for C++17 or later.
+///
+/// All types with the same Tag share a table; by default each type has
+/// its own.  Ids are only meaningful within their table, so they should
+/// not be persisted or compared across tables.  Ordering compares the
+/// characters, not the ids.
+///
+/// Conversion from and to safer_string_typedef is explicit.
+///
+/// Template arguments:
+///  -# O : The opaque type, your subclass
+///  -# Tag : The tag type selecting the intern_table
+///
+template <typename O, typename Tag = O>
+struct interned_string_typedef : data<std::uint32_t, O> {
+private:
+  using base = opaque::data<std::uint32_t, O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  typedef std::string                 string_type;
+  typedef char                        value_type;
+  typedef std::size_t                 size_type;
+  typedef string_type::const_iterator const_iterator;
+
+  /// The table holding the strings of this type
+  static intern_table& table() { return intern_table::instance<Tag>(); }
+
+  /// The empty string
+  constexpr interned_string_typedef() noexcept : base(underlying_type(0)) { }
+
+  explicit interned_string_typedef(const string_type& s)
+    : base(table().intern(s)) { }
+  explicit interned_string_typedef(const char * s, size_type n)
+    : base(table().intern(s, n)) { }
+  explicit interned_string_typedef(const char * s)
+    : base(table().intern(s, std::strlen(s))) { }
+
+  /// Intern the value of a safer_string_typedef
+  template <typename S, typename R>
+  explicit interned_string_typedef(const safer_string_typedef<S,R>& s)
+    : base(table().intern(s.data(), s.size())) {
+    static_assert(std::is_same<typename S::value_type, char>::value,
+        "Only narrow strings can be interned");
+  }
+
+  /// Copy the characters to a safer_string_typedef
+  template <typename R, typename = typename std::enable_if<
+    std::is_base_of<safer_string_typedef<typename R::underlying_type, R>,
+                    R>::value>::type>
+  explicit operator R() const {
+    return R(typename R::underlying_type(data(), size()));
+  }
+
+  /// Find an interned string without interning it
+  static bool find(const string_type& s, opaque_type& result) noexcept {
+    underlying_type id;
+    if (not table().find(s.data(), s.size(), id)) return false;
+    result.value = id;
+    return true;
+  }
+
+  const string_type& str() const noexcept { return table().str(value); }
+  const char * c_str() const noexcept { return str().c_str(); }
+  const char * data() const noexcept { return str().data(); }
+  size_type size() const noexcept { return str().size(); }
+  size_type length() const noexcept { return str().size(); }
+  bool empty() const noexcept { return value == 0; }
+  const_iterator begin() const noexcept { return str().begin(); }
+  const_iterator end() const noexcept { return str().end(); }
+  const char& operator[](size_type pos) const noexcept { return str()[pos]; }
+
+#if __cplusplus >= 201703L
+  std::string_view view() const noexcept {
+    return std::string_view(data(), size());
+  }
+#endif
+
+  /// Compare the characters
+  int compare(const opaque_type& peer) const noexcept {
+    return value == peer.value ? 0 : str().compare(peer.str());
+  }
+
+  bool operator==(const opaque_type& peer) const noexcept {
+    return value == peer.value; }
+  bool operator!=(const opaque_type& peer) const noexcept {
+    return value != peer.value; }
+  bool operator< (const opaque_type& peer) const noexcept {
+    return compare(peer) <  0; }
+  bool operator> (const opaque_type& peer) const noexcept {
+    return compare(peer) >  0; }
+  bool operator<=(const opaque_type& peer) const noexcept {
+    return compare(peer) <= 0; }
+  bool operator>=(const opaque_type& peer) const noexcept {
+    return compare(peer) >= 0; }
+
+  interned_string_typedef(const interned_string_typedef& ) = default;
+  interned_string_typedef(      interned_string_typedef&&) = default;
+  interned_string_typedef& operator=(const interned_string_typedef& ) & =
+    default;
+  interned_string_typedef& operator=(      interned_string_typedef&&) & =
+    default;
+protected:
+  ~interned_string_typedef() = default;
+};
+
+/// Write the characters, rather than the id
+template <typename O, typename Tag>
+std::ostream& operator<<(std::ostream& stream,
+                         const interned_string_typedef<O,Tag>& s) {
+  return stream << s.str();
+}
+
+/// @}
+
+}
+}
+
+#endif
@@ -29,10 +29,38 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 #include "../data.hpp"
+#include "../search.hpp"
 #include <memory>
 #include <string>
+#include <type_traits>
 
 namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+//
+// Concatenate two character sequences into a string using the given
+// allocator.  The standard operator+ on two lvalue strings instead uses
+// select_on_container_copy_construction, which for a polymorphic
+// allocator is the default resource rather than the operand's arena.
+//
+template <typename S>
+S string_concat(const typename S::allocator_type& a,
+    const typename S::value_type* l, typename S::size_type ln,
+    const typename S::value_type* r, typename S::size_type rn) {
+  S s(a);
+  s.reserve(ln + rn);
+  s.append(l, ln).append(r, rn);
+  return s;
+}
+
+}
+
+/// @}
+
 namespace experimental {
 
 /// \addtogroup typedefs
@@ -104,7 +132,7 @@ public:
     : base(a) { }
   explicit safer_string_typedef(const underlying_type& str, size_type pos,
       size_type n = npos, const Allocator& a = Allocator())
-    : base(str.value, pos, n, a) { }
+    : base(str, pos, n, a) { }
   safer_string_typedef(const opaque_type& str, size_type pos,
       size_type n = npos, const Allocator& a = Allocator())
     : base(str.value, pos, n, a) { }
@@ -125,9 +153,9 @@ public:
       const Allocator& a = Allocator())
     : base(il, a) { }
   explicit safer_string_typedef(const underlying_type& str, const Allocator& a)
-    : base(str.value, a) { }
+    : base(str, a) { }
   explicit safer_string_typedef(underlying_type&& str, const Allocator& a)
-    : base(std::move(str.value), a) { }
+    : base(std::move(str), a) { }
   safer_string_typedef(const opaque_type& str, const Allocator& a)
     : base(str.value, a) { }
   safer_string_typedef(opaque_type&& str, const Allocator& a)
@@ -374,13 +402,13 @@ public:
   }
 
   size_type find (const opaque_type& str, size_type pos = 0) const noexcept {
-    return value.find(str.value, pos);
+    return find_n(searchable(), str.data(), pos, str.size());
   }
   size_type find (const charT* s, size_type pos, size_type n) const {
-    return value.find(s, pos, n);
+    return find_n(searchable(), s, pos, n);
   }
   size_type find (const charT* s, size_type pos = 0) const {
-    return value.find(s, pos);
+    return find_n(searchable(), s, pos, traits_type::length(s));
   }
   size_type find (charT c, size_type pos = 0) const noexcept {
     return value.find(c, pos);
@@ -399,13 +427,13 @@ public:
   }
 
   size_type find_first_of(const opaque_type& str, size_type pos = 0) const noexcept {
-    return value.find_first_of(str.value, pos);
+    return find_first_of_n(searchable(), str.data(), pos, str.size());
   }
   size_type find_first_of(const charT* s, size_type pos, size_type n) const {
-    return value.find_first_of(s, pos, n);
+    return find_first_of_n(searchable(), s, pos, n);
   }
   size_type find_first_of(const charT* s, size_type pos = 0) const {
-    return value.find_first_of(s, pos);
+    return find_first_of_n(searchable(), s, pos, traits_type::length(s));
   }
   size_type find_first_of(charT c, size_type pos = 0) const noexcept {
     return value.find_first_of(c, pos);
@@ -424,16 +452,16 @@ public:
   }
 
   size_type find_first_not_of(const opaque_type& str, size_type pos = 0) const noexcept {
-    return value.find_first_not_of(str.value, pos);
+    return find_first_not_of_n(searchable(), str.data(), pos, str.size());
   }
   size_type find_first_not_of(const charT* s, size_type pos, size_type n) const {
-    return value.find_first_not_of(s, pos, n);
+    return find_first_not_of_n(searchable(), s, pos, n);
   }
   size_type find_first_not_of(const charT* s, size_type pos = 0) const {
-    return value.find_first_not_of(s, pos);
+    return find_first_not_of_n(searchable(), s, pos, traits_type::length(s));
   }
   size_type find_first_not_of(charT c, size_type pos = 0) const noexcept {
-    return value.find_first_not_of(c, pos);
+    return find_first_not_of_n(searchable(), &c, pos, 1);
   }
   size_type find_last_not_of (const opaque_type& str, size_type pos = npos) const noexcept {
     return value.find_last_not_of(str.value, pos);
@@ -449,7 +477,7 @@ public:
   }
 
   opaque_type substr(size_type pos = 0, size_type n = npos) const {
-    return opaque_type(value.substr(pos, n));
+    return opaque_type(value, pos, n, value.get_allocator());
   }
   int compare(const opaque_type& str) const noexcept {
     return value.compare(str.value);
@@ -473,7 +501,8 @@ public:
   }
 
   friend opaque_type operator+(const opaque_type&  l, const opaque_type&  r) {
-    return opaque_type(          l.value  +           r.value );
+    return opaque_type(opaque::detail::string_concat<S>(l.get_allocator(),
+          l.data(), l.size(), r.data(), r.size()));
   }
   friend opaque_type operator+(      opaque_type&& l, const opaque_type&  r) {
     return opaque_type(std::move(l.value) +           r.value );
@@ -487,18 +516,20 @@ public:
   // friend opaque_type operator+(const charT* lhs, const opaque_type&  rhs);
   // friend opaque_type operator+(const charT* lhs,       opaque_type&& rhs);
   friend opaque_type operator+(      charT  lhs, const opaque_type&  rhs) {
-    return lhs +           rhs.value ;
+    return opaque_type(opaque::detail::string_concat<S>(rhs.get_allocator(),
+          &lhs, 1, rhs.data(), rhs.size()));
   }
   friend opaque_type operator+(      charT  lhs,       opaque_type&& rhs) {
-    return lhs + std::move(rhs.value);
+    return opaque_type(lhs + std::move(rhs.value));
   }
   // friend opaque_type operator+(const opaque_type&  lhs, const charT* rhs);
   // friend opaque_type operator+(      opaque_type&& lhs, const charT* rhs);
   friend opaque_type operator+(const opaque_type&  lhs,       charT  rhs) {
-    return           lhs.value  + rhs;
+    return opaque_type(opaque::detail::string_concat<S>(lhs.get_allocator(),
+          lhs.data(), lhs.size(), &rhs, 1));
   }
   friend opaque_type operator+(      opaque_type&& lhs,       charT  rhs) {
-    return std::move(lhs.value) + rhs;
+    return opaque_type(std::move(lhs.value) + rhs);
   }
 
   friend bool operator==(const opaque_type& lhs, const opaque_type& rhs) {
@@ -571,6 +602,43 @@ public:
 protected:
   ~safer_string_typedef() = default;
   using base::downcast;
+
+private:
+  //
+  // Strings of char with the standard traits search with the kernels of
+  // search.hpp, which pick an instruction set at run time; any other
+  // string searches with its own members.
+  //
+  typedef std::integral_constant<bool,
+    std::is_same<traits_type, std::char_traits<char>>::value> searchable;
+
+  size_type find_n(std::true_type, const charT* s, size_type pos,
+      size_type n) const noexcept {
+    return static_cast<size_type>(
+        search::find(value.data(), value.size(), s, pos, n));
+  }
+  size_type find_n(std::false_type, const charT* s, size_type pos,
+      size_type n) const {
+    return value.find(s, pos, n);
+  }
+  size_type find_first_of_n(std::true_type, const charT* s, size_type pos,
+      size_type n) const noexcept {
+    return static_cast<size_type>(
+        search::find_first_of(value.data(), value.size(), s, pos, n));
+  }
+  size_type find_first_of_n(std::false_type, const charT* s, size_type pos,
+      size_type n) const {
+    return value.find_first_of(s, pos, n);
+  }
+  size_type find_first_not_of_n(std::true_type, const charT* s,
+      size_type pos, size_type n) const noexcept {
+    return static_cast<size_type>(
+        search::find_first_not_of(value.data(), value.size(), s, pos, n));
+  }
+  size_type find_first_not_of_n(std::false_type, const charT* s,
+      size_type pos, size_type n) const {
+    return value.find_first_not_of(s, pos, n);
+  }
 };
 
 /// @}
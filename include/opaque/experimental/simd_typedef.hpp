@@ -0,0 +1,203 @@
+#ifndef OPAQUE_EXPERIMENTAL_SIMD_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_SIMD_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../binop/binop_inherit.hpp"
+#include "../data.hpp"
+#include "../simd.hpp"
+#include <cstddef>
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Vector opaque typedef base type
+///
+/// Same as simd_typedef, but without providing operator@ in terms of
+/// operator@= by default.  Mixed-type operator@ may be provided by
+/// inheriting from the opaque::binop::opname classes, as for
+/// numeric_typedef_base.
+///
+/// Template arguments for simd_typedef_base:
+///  -# U : The type of each lane
+///  -# O : The opaque type, your subclass
+///  -# N : The number of lanes
+///  -# S : The right-hand operand type for shift operations
+///
+template <typename U, typename O, std::size_t N, typename S = unsigned>
+struct simd_typedef_base : data<simd::lanes<U,N>, O> {
+private:
+  using base = opaque::data<simd::lanes<U,N>, O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  typedef U lane_type;
+  typedef S shift_type;
+  using base::value;
+
+  /// The number of lanes
+  static constexpr std::size_t size() noexcept { return N; }
+
+  /// Create a vector with every lane set to v
+  static opaque_type broadcast(const lane_type& v) noexcept(
+      std::is_nothrow_copy_constructible<lane_type>::value) {
+    underlying_type lanes;
+    for (auto& lane : lanes) lane = v;
+    return opaque_type(lanes);
+  }
+
+  constexpr14 lane_type& operator[](std::size_t i) noexcept {
+    return value[i]; }
+  constexpr const lane_type& operator[](std::size_t i) const noexcept {
+    return value[i]; }
+
+  opaque_type& operator*=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::mul_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator/=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::div_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator%=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::mod_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator+=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::add_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator-=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::sub_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator<<=(const shift_type& count) & noexcept {
+    simd::apply_shift<simd::shl_t>(value.lane, count, N);
+    return downcast(); }
+
+  opaque_type& operator>>=(const shift_type& count) & noexcept {
+    simd::apply_shift<simd::shr_t>(value.lane, count, N);
+    return downcast(); }
+
+  opaque_type& operator&=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::and_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator^=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::xor_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+  opaque_type& operator|=(const opaque_type& peer) & noexcept {
+    simd::apply<simd::or_t>(value.lane, peer.value.lane, N);
+    return downcast(); }
+
+
+  constexpr opaque_type operator+() const & noexcept {
+    return opaque_type(value); }
+
+  opaque_type operator-() const & noexcept {
+    underlying_type lanes = underlying_type();
+    simd::apply<simd::sub_t>(lanes.lane, value.lane, N);
+    return opaque_type(lanes); }
+
+  opaque_type operator~() const & noexcept {
+    underlying_type lanes;
+    for (auto& lane : lanes) lane = static_cast<lane_type>(~lane_type());
+    simd::apply<simd::xor_t>(lanes.lane, value.lane, N);
+    return opaque_type(lanes); }
+
+  /// Check whether every lane is equal
+  bool operator==(const opaque_type& peer) const noexcept {
+    for (std::size_t i = 0; i < N; ++i) {
+      if (not (value[i] == peer.value[i])) return false;
+    }
+    return true; }
+  bool operator!=(const opaque_type& peer) const noexcept {
+    return not (*this == peer); }
+
+
+  using base::base;
+  explicit simd_typedef_base() = default;
+  simd_typedef_base(const simd_typedef_base& ) = default;
+  simd_typedef_base(      simd_typedef_base&&) = default;
+  simd_typedef_base& operator=(const simd_typedef_base& ) & = default;
+  simd_typedef_base& operator=(      simd_typedef_base&&) & = default;
+protected:
+  ~simd_typedef_base() = default;
+  using base::downcast;
+};
+
+///
+/// Vector opaque typedef
+///
+/// This is a base class for types holding N lanes of a numeric type, with
+/// the compound operators of numeric_typedef applied lane-wise.  The
+/// operators use SSE2 or AVX2 vector instructions where the compiler
+/// targets them and the lane type and operation allow, and a scalar loop
+/// otherwise.  The same rules apply as for numeric_typedef: distinct
+/// vector types cannot be mixed in an expression unless you permit it.
+///
+/// Template arguments for simd_typedef:
+///  -# U : The type of each lane
+///  -# O : The opaque type, your subclass
+///  -# N : The number of lanes
+///  -# S : The right-hand operand type for shift operations
+///
+template <typename U, typename O, std::size_t N, typename S = unsigned>
+struct simd_typedef : simd_typedef_base<U,O,N,S>
+  , binop::multipliable   <O>
+  , binop::dividable      <O>
+  , binop::modulable      <O>
+  , binop::addable        <O>
+  , binop::subtractable   <O>
+  , binop::left_shiftable <O, false, O, S>
+  , binop::right_shiftable<O, false, O, S>
+  , binop::bitandable     <O>
+  , binop::bitxorable     <O>
+  , binop::bitorable      <O>
+{
+  using simd_typedef_base<U,O,N,S>::simd_typedef_base;
+  explicit simd_typedef() = default;
+  simd_typedef(const simd_typedef& ) = default;
+  simd_typedef(      simd_typedef&&) = default;
+  simd_typedef& operator=(const simd_typedef& ) & = default;
+  simd_typedef& operator=(      simd_typedef&&) & = default;
+protected:
+  ~simd_typedef() = default;
+};
+
+/// @}
+
+}
+}
+
+#endif
@@ -57,6 +57,7 @@ public:
   using base::value;
 
   using typename base::allocator_type;
+  using typename base::traits_type;
   using typename base::size_type;
   using base::npos;
 
@@ -114,16 +115,18 @@ public:
   }
 
   friend opaque_type operator+(const charT* lhs, const opaque_type&  rhs) {
-    return lhs +           rhs.value ;
+    return opaque_type(opaque::detail::string_concat<S>(rhs.get_allocator(),
+          lhs, traits_type::length(lhs), rhs.data(), rhs.size()));
   }
   friend opaque_type operator+(const charT* lhs,       opaque_type&& rhs) {
-    return lhs + std::move(rhs.value);
+    return opaque_type(lhs + std::move(rhs.value));
   }
   friend opaque_type operator+(const opaque_type&  lhs, const charT* rhs) {
-    return           lhs.value  + rhs;
+    return opaque_type(opaque::detail::string_concat<S>(lhs.get_allocator(),
+          lhs.data(), lhs.size(), rhs, traits_type::length(rhs)));
   }
   friend opaque_type operator+(      opaque_type&& lhs, const charT* rhs) {
-    return std::move(lhs.value) + rhs;
+    return opaque_type(std::move(lhs.value) + rhs);
   }
 
   string_typedef() = default;
@@ -0,0 +1,538 @@
+#ifndef OPAQUE_EXPERIMENTAL_STRING_VIEW_TYPEDEF_HPP
+#define OPAQUE_EXPERIMENTAL_STRING_VIEW_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "../data.hpp"
+#include "../hash.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
+
+namespace opaque {
+namespace experimental {
+
+/// \addtogroup miscellaneous
+/// @{
+
+#if __cplusplus >= 201703L
+
+template <typename C, typename T = std::char_traits<C>>
+using basic_string_view = std::basic_string_view<C,T>;
+
+#else
+
+///
+/// Read-only view of a character sequence
+///
+/// This is the subset of the C++17 std::basic_string_view interface used
+/// by string_view_typedef, for use before C++17.  From C++17 on,
+/// opaque::experimental::basic_string_view is std::basic_string_view.
+///
+template <typename C, typename T = std::char_traits<C>>
+class basic_string_view {
+public:
+  typedef T                                     traits_type;
+  typedef C                                     value_type;
+  typedef const C*                              pointer;
+  typedef const C*                              const_pointer;
+  typedef const C&                              reference;
+  typedef const C&                              const_reference;
+  typedef const C*                              const_iterator;
+  typedef const_iterator                        iterator;
+  typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+  typedef const_reverse_iterator                reverse_iterator;
+  typedef std::size_t                           size_type;
+  typedef std::ptrdiff_t                        difference_type;
+  static const size_type npos = size_type(0)-size_type(1);
+
+  constexpr basic_string_view() noexcept : p(nullptr), n(0) { }
+  constexpr basic_string_view(const C * s, size_type count) noexcept
+    : p(s), n(count) { }
+  basic_string_view(const C * s) : p(s), n(T::length(s)) { }
+  template <typename A>
+  basic_string_view(const std::basic_string<C,T,A>& s) noexcept
+    : p(s.data()), n(s.size()) { }
+
+  /// Copy the characters to a std::basic_string
+  template <typename A>
+  explicit operator std::basic_string<C,T,A>() const {
+    return std::basic_string<C,T,A>(p, n);
+  }
+
+  constexpr const_iterator  begin() const noexcept { return p; }
+  constexpr const_iterator    end() const noexcept { return p + n; }
+  constexpr const_iterator cbegin() const noexcept { return p; }
+  constexpr const_iterator   cend() const noexcept { return p + n; }
+  const_reverse_iterator   rbegin() const noexcept {
+    return const_reverse_iterator(end()); }
+  const_reverse_iterator     rend() const noexcept {
+    return const_reverse_iterator(begin()); }
+  const_reverse_iterator  crbegin() const noexcept { return rbegin(); }
+  const_reverse_iterator    crend() const noexcept { return rend(); }
+
+  constexpr size_type     size() const noexcept { return n; }
+  constexpr size_type   length() const noexcept { return n; }
+  constexpr size_type max_size() const noexcept { return npos / sizeof(C); }
+  constexpr bool         empty() const noexcept { return n == 0; }
+
+  constexpr const_reference operator[](size_type pos) const noexcept {
+    return p[pos];
+  }
+  const_reference at(size_type pos) const {
+    if (pos >= n) throw std::out_of_range("basic_string_view::at");
+    return p[pos];
+  }
+  constexpr const_reference front() const noexcept { return p[0]; }
+  constexpr const_reference  back() const noexcept { return p[n - 1]; }
+  constexpr const_pointer    data() const noexcept { return p; }
+
+  void remove_prefix(size_type k) noexcept { p += k; n -= k; }
+  void remove_suffix(size_type k) noexcept { n -= k; }
+  void swap(basic_string_view& v) noexcept {
+    std::swap(p, v.p);
+    std::swap(n, v.n);
+  }
+
+  size_type copy(C * s, size_type k, size_type pos = 0) const {
+    check_position(pos);
+    k = std::min(k, n - pos);
+    T::copy(s, p + pos, k);
+    return k;
+  }
+
+  basic_string_view substr(size_type pos = 0, size_type k = npos) const {
+    check_position(pos);
+    return basic_string_view(p + pos, std::min(k, n - pos));
+  }
+
+  int compare(basic_string_view v) const noexcept {
+    const int r = T::compare(p, v.p, std::min(n, v.n));
+    return r != 0 ? r : n < v.n ? -1 : n > v.n ? 1 : 0;
+  }
+  int compare(size_type pos1, size_type n1, basic_string_view v) const {
+    return substr(pos1, n1).compare(v);
+  }
+  int compare(size_type pos1, size_type n1, basic_string_view v,
+              size_type pos2, size_type n2) const {
+    return substr(pos1, n1).compare(v.substr(pos2, n2));
+  }
+  int compare(const C * s) const {
+    return compare(basic_string_view(s));
+  }
+  int compare(size_type pos1, size_type n1, const C * s) const {
+    return substr(pos1, n1).compare(basic_string_view(s));
+  }
+  int compare(size_type pos1, size_type n1, const C * s, size_type n2) const {
+    return substr(pos1, n1).compare(basic_string_view(s, n2));
+  }
+
+  size_type find(basic_string_view v, size_type pos = 0) const noexcept {
+    if (v.n > n or pos > n - v.n) return npos;
+    if (v.n == 0) return pos;
+    for (const C * q = p + pos; ; ++q) {
+      q = T::find(q, static_cast<size_type>(end() - q), v.p[0]);
+      if (not q or v.n > static_cast<size_type>(end() - q)) return npos;
+      if (T::compare(q, v.p, v.n) == 0) return static_cast<size_type>(q - p);
+    }
+  }
+  size_type rfind(basic_string_view v, size_type pos = npos) const noexcept {
+    if (v.n > n) return npos;
+    for (size_type i = std::min(pos, n - v.n); ; --i) {
+      if (T::compare(p + i, v.p, v.n) == 0) return i;
+      if (i == 0) return npos;
+    }
+  }
+  size_type find_first_of(basic_string_view v, size_type pos = 0) const
+    noexcept { return find_first(v, pos, true); }
+  size_type find_last_of(basic_string_view v, size_type pos = npos) const
+    noexcept { return find_last(v, pos, true); }
+  size_type find_first_not_of(basic_string_view v, size_type pos = 0) const
+    noexcept { return find_first(v, pos, false); }
+  size_type find_last_not_of(basic_string_view v, size_type pos = npos) const
+    noexcept { return find_last(v, pos, false); }
+
+#define OPAQUE_STRING_VIEW_FIND(name, start) \
+  size_type name(C c, size_type pos = start) const noexcept { \
+    return name(basic_string_view(&c, 1), pos); } \
+  size_type name(const C * s, size_type pos, size_type k) const noexcept { \
+    return name(basic_string_view(s, k), pos); } \
+  size_type name(const C * s, size_type pos = start) const { \
+    return name(basic_string_view(s), pos); }
+  OPAQUE_STRING_VIEW_FIND(find, 0)
+  OPAQUE_STRING_VIEW_FIND(rfind, npos)
+  OPAQUE_STRING_VIEW_FIND(find_first_of, 0)
+  OPAQUE_STRING_VIEW_FIND(find_last_of, npos)
+  OPAQUE_STRING_VIEW_FIND(find_first_not_of, 0)
+  OPAQUE_STRING_VIEW_FIND(find_last_not_of, npos)
+#undef OPAQUE_STRING_VIEW_FIND
+
+  friend bool operator==(basic_string_view l, basic_string_view r) noexcept {
+    return l.n == r.n and T::compare(l.p, r.p, l.n) == 0; }
+  friend bool operator!=(basic_string_view l, basic_string_view r) noexcept {
+    return not (l == r); }
+  friend bool operator< (basic_string_view l, basic_string_view r) noexcept {
+    return l.compare(r) <  0; }
+  friend bool operator> (basic_string_view l, basic_string_view r) noexcept {
+    return l.compare(r) >  0; }
+  friend bool operator<=(basic_string_view l, basic_string_view r) noexcept {
+    return l.compare(r) <= 0; }
+  friend bool operator>=(basic_string_view l, basic_string_view r) noexcept {
+    return l.compare(r) >= 0; }
+
+  friend std::basic_ostream<C,T>& operator<<(std::basic_ostream<C,T>& os,
+                                             basic_string_view v) {
+    return os.write(v.p, static_cast<std::streamsize>(v.n));
+  }
+
+private:
+  void check_position(size_type pos) const {
+    if (pos > n) throw std::out_of_range("basic_string_view");
+  }
+  size_type find_first(basic_string_view v, size_type pos,
+                       bool member) const noexcept {
+    for (size_type i = pos; i < n; ++i) {
+      if ((T::find(v.p, v.n, p[i]) != nullptr) == member) return i;
+    }
+    return npos;
+  }
+  size_type find_last(basic_string_view v, size_type pos,
+                      bool member) const noexcept {
+    if (n == 0) return npos;
+    for (size_type i = std::min(pos, n - 1); ; --i) {
+      if ((T::find(v.p, v.n, p[i]) != nullptr) == member) return i;
+      if (i == 0) return npos;
+    }
+  }
+
+  const C * p;
+  size_type n;
+};
+
+template <typename C, typename T>
+const typename basic_string_view<C,T>::size_type basic_string_view<C,T>::npos;
+
+#endif
+
+typedef basic_string_view<char> string_view;
+
+/// @}
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// String view opaque typedef base type
+///
+/// This is an opaque typedef base class for non-owning, read-only views
+/// of strings, such as tokens referring into a buffer being parsed.
+/// Creating and copying one never allocates.  It provides the read-only
+/// part of the safer_string_typedef interface, plus starts_with and
+/// ends_with.  The viewed characters must outlive the object; for that
+/// reason construction from a temporary string is deleted.
+///
+/// Conversion to an owning opaque string type (such as a
+/// safer_string_typedef, string_typedef or fixed_string_typedef) is
+/// explicit, and copies the characters.  Hashing with OPAQUE_HASHABLE
+/// hashes the characters.
+///
+/// Template arguments:
+///  -# O : The opaque type, your subclass
+///  -# V : The view type (by default opaque::experimental::string_view)
+///
+template <typename O, typename V = string_view>
+struct string_view_typedef : data<V,O> {
+private:
+  using base = opaque::data<V,O>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  typedef typename V::traits_type            traits_type;
+  typedef typename V::value_type             value_type;
+  typedef typename V::size_type              size_type;
+  typedef typename V::difference_type        difference_type;
+  typedef typename V::const_reference        const_reference;
+  typedef typename V::const_pointer          const_pointer;
+  typedef typename V::const_iterator         const_iterator;
+  typedef typename V::const_reverse_iterator const_reverse_iterator;
+  static const size_type npos = size_type(0)-size_type(1);
+
+private:
+  typedef value_type charT;
+  typedef std::basic_string<charT, traits_type> string_type;
+
+  template <typename S>
+  using if_string = typename std::enable_if<
+    std::is_convertible<decltype(std::declval<const S&>().data()),
+                        const charT*>::value and
+    std::is_convertible<decltype(std::declval<const S&>().size()),
+                        size_type>::value>::type;
+
+public:
+  explicit constexpr string_view_typedef(const underlying_type& v) noexcept
+    : base(v) { }
+  explicit constexpr string_view_typedef(const charT* s, size_type n)
+    noexcept : base(s, n) { }
+  explicit string_view_typedef(const charT* s)
+    : base(s) { }
+  template <typename A>
+  explicit string_view_typedef(
+      const std::basic_string<charT,traits_type,A>& s) noexcept
+    : base(s.data(), s.size()) { }
+  template <typename A>
+  explicit string_view_typedef(
+      const std::basic_string<charT,traits_type,A>&& s) = delete;
+
+  /// View the characters of an owning opaque string
+  template <typename S, typename = if_string<S>,
+            typename = typename std::enable_if<
+              opaque::detail::is_opaque<S>::value>::type>
+  explicit string_view_typedef(const S& s) noexcept
+    : base(s.data(), s.size()) { }
+  template <typename S, typename = if_string<S>,
+            typename = typename std::enable_if<
+              opaque::detail::is_opaque<S>::value>::type>
+  explicit string_view_typedef(const S&& s) = delete;
+
+  /// Copy the characters to an owning opaque string
+  template <typename R, typename = typename std::enable_if<
+    opaque::detail::is_opaque<R>::value and
+    std::is_constructible<typename R::underlying_type,
+                          const charT*, size_type>::value>::type>
+  explicit operator R() const {
+    return R(typename R::underlying_type(data(), size()));
+  }
+
+  /// Copy the characters to a std::basic_string
+  string_type str() const { return string_type(data(), size()); }
+
+  const_iterator           begin() const noexcept { return value.begin()  ; }
+  const_iterator             end() const noexcept { return value.end()    ; }
+  const_reverse_iterator  rbegin() const noexcept { return value.rbegin() ; }
+  const_reverse_iterator    rend() const noexcept { return value.rend()   ; }
+  const_iterator          cbegin() const noexcept { return value.cbegin() ; }
+  const_iterator            cend() const noexcept { return value.cend()   ; }
+  const_reverse_iterator crbegin() const noexcept { return value.crbegin(); }
+  const_reverse_iterator   crend() const noexcept { return value.crend()  ; }
+
+  size_type     size() const noexcept { return value.size(); }
+  size_type   length() const noexcept { return value.length(); }
+  size_type max_size() const noexcept { return value.max_size(); }
+  bool empty()         const noexcept { return value.empty(); }
+
+  const_reference operator[](size_type pos) const { return value[pos]; }
+  const_reference at(size_type n)           const { return value.at(n); }
+  const_reference front()                   const { return value.front(); }
+  const_reference back()                    const { return value.back(); }
+  const_pointer   data()           const noexcept { return value.data(); }
+
+  void remove_prefix(size_type n) { return value.remove_prefix(n); }
+  void remove_suffix(size_type n) { return value.remove_suffix(n); }
+
+  size_type copy(charT* s, size_type n, size_type pos = 0) const {
+    return value.copy(s, n, pos);
+  }
+  void swap(opaque_type& v) noexcept { return value.swap(v.value); }
+
+  opaque_type substr(size_type pos = 0, size_type n = npos) const {
+    return opaque_type(value.substr(pos, n));
+  }
+
+  bool starts_with(const opaque_type& v) const noexcept {
+    return starts_with(v.data(), v.size());
+  }
+  bool starts_with(charT c) const noexcept {
+    return not empty() and traits_type::eq(front(), c);
+  }
+  bool starts_with(const charT* s) const {
+    return starts_with(s, traits_type::length(s));
+  }
+  bool ends_with(const opaque_type& v) const noexcept {
+    return ends_with(v.data(), v.size());
+  }
+  bool ends_with(charT c) const noexcept {
+    return not empty() and traits_type::eq(back(), c);
+  }
+  bool ends_with(const charT* s) const {
+    return ends_with(s, traits_type::length(s));
+  }
+
+  int compare(const opaque_type& v) const noexcept {
+    return value.compare(v.value);
+  }
+  int compare(size_type pos1, size_type n1, const opaque_type& v) const {
+    return value.compare(pos1, n1, v.value);
+  }
+  int compare(size_type pos1, size_type n1, const opaque_type& v,
+      size_type pos2, size_type n2 = npos) const {
+    return value.compare(pos1, n1, v.value, pos2, n2);
+  }
+  int compare(const charT* s) const {
+    return value.compare(s);
+  }
+  int compare(size_type pos1, size_type n1, const charT* s) const {
+    return value.compare(pos1, n1, s);
+  }
+  int compare(size_type pos1, size_type n1, const charT* s, size_type n2)
+    const {
+    return value.compare(pos1, n1, s, n2);
+  }
+
+#define OPAQUE_STRING_VIEW_TYPEDEF_FIND(name, start) \
+  size_type name(const opaque_type& v, size_type pos = start) const \
+    noexcept { return value.name(v.value, pos); } \
+  size_type name(const charT* s, size_type pos, size_type n) const { \
+    return value.name(s, pos, n); } \
+  size_type name(const charT* s, size_type pos = start) const { \
+    return value.name(s, pos); } \
+  size_type name(charT c, size_type pos = start) const noexcept { \
+    return value.name(c, pos); }
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(find, 0)
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(rfind, npos)
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(find_first_of, 0)
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(find_last_of, npos)
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(find_first_not_of, 0)
+  OPAQUE_STRING_VIEW_TYPEDEF_FIND(find_last_not_of, npos)
+#undef OPAQUE_STRING_VIEW_TYPEDEF_FIND
+
+  friend bool operator==(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value == rhs.value;
+  }
+  friend bool operator==(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) == 0;
+  }
+  friend bool operator==(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) == 0;
+  }
+  friend bool operator!=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value != rhs.value;
+  }
+  friend bool operator!=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) != 0;
+  }
+  friend bool operator!=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) != 0;
+  }
+
+  friend bool operator< (const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value <  rhs.value;
+  }
+  friend bool operator< (const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) >  0;
+  }
+  friend bool operator< (const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) <  0;
+  }
+  friend bool operator> (const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value >  rhs.value;
+  }
+  friend bool operator> (const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) <  0;
+  }
+  friend bool operator> (const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) >  0;
+  }
+
+  friend bool operator<=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value <= rhs.value;
+  }
+  friend bool operator<=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) >= 0;
+  }
+  friend bool operator<=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) <= 0;
+  }
+  friend bool operator>=(const opaque_type& lhs, const opaque_type& rhs) {
+    return lhs.value >= rhs.value;
+  }
+  friend bool operator>=(const       charT* lhs, const opaque_type& rhs) {
+    return rhs.compare(lhs) <= 0;
+  }
+  friend bool operator>=(const opaque_type& lhs, const       charT* rhs) {
+    return lhs.compare(rhs) >= 0;
+  }
+
+  friend void swap(opaque_type& lhs, opaque_type& rhs) noexcept {
+    return lhs.value.swap(rhs.value);
+  }
+
+  constexpr string_view_typedef() noexcept : base() { }
+  string_view_typedef(const string_view_typedef& ) = default;
+  string_view_typedef(      string_view_typedef&&) = default;
+  string_view_typedef& operator=(const string_view_typedef& ) = default;
+  string_view_typedef& operator=(      string_view_typedef&&) = default;
+protected:
+  ~string_view_typedef() = default;
+  using base::downcast;
+
+private:
+  bool starts_with(const charT* s, size_type n) const noexcept {
+    return size() >= n and traits_type::compare(data(), s, n) == 0;
+  }
+  bool ends_with(const charT* s, size_type n) const noexcept {
+    return size() >= n and
+      traits_type::compare(data() + (size() - n), s, n) == 0;
+  }
+};
+
+template <typename O, typename V>
+const typename string_view_typedef<O,V>::size_type
+string_view_typedef<O,V>::npos;
+
+/// @}
+
+}
+}
+
+#if __cplusplus < 201703L
+namespace std {
+
+/// Hash the characters of a string view
+template <typename C, typename T>
+struct hash<opaque::experimental::basic_string_view<C,T>> {
+  using argument_type = opaque::experimental::basic_string_view<C,T>;
+  using result_type = size_t;
+  result_type operator()(const argument_type& v) const noexcept {
+    return static_cast<size_t>(
+        opaque::hashing::hash_bytes(v.data(), v.size() * sizeof(C)));
+  }
+};
+
+}
+#endif
+
+#endif
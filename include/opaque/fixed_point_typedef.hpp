@@ -0,0 +1,276 @@
+#ifndef OPAQUE_FIXED_POINT_TYPEDEF_HPP
+#define OPAQUE_FIXED_POINT_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "binop/binop_inherit.hpp"
+#include "numeric_typedef.hpp"
+#include "type_traits.hpp"
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+// The type in which products and quotients of a representation are formed
+template <typename Rep, bool = (sizeof(Rep) < sizeof(long long))>
+struct fixed_point_wide {
+  typedef typename std::conditional<std::is_signed<Rep>::value,
+    long long, unsigned long long>::type type;
+};
+#if defined __SIZEOF_INT128__
+template <typename Rep>
+struct fixed_point_wide<Rep, false> {
+  __extension__ typedef typename std::conditional<std::is_signed<Rep>::value,
+    __int128, unsigned __int128>::type type;
+};
+#else
+template <typename Rep>
+struct fixed_point_wide<Rep, false> { typedef Rep type; };
+#endif
+
+//
+// Move a value from From to To fractional bits.  Widening multiplies by a
+// power of two, which is defined for negative values where a left shift is
+// not, and narrowing is an arithmetic right shift, which rounds toward
+// negative infinity.  Unsigned types narrower than int are widened in
+// unsigned arithmetic.
+//
+template <typename T, unsigned From, unsigned To, bool = (To >= From)>
+struct fixed_point_scale {
+  typedef typename std::conditional<std::is_signed<T>::value, T,
+    typename std::common_type<T, unsigned>::type>::type P;
+  static constexpr T apply(T v) noexcept {
+    return static_cast<T>(static_cast<P>(v) * (P(1) << (To - From))); }
+};
+template <typename T, unsigned From, unsigned To>
+struct fixed_point_scale<T, From, To, false> {
+  static constexpr T apply(T v) noexcept {
+    return static_cast<T>(v >> (From - To)); }
+};
+
+// The value of one in a representation with N fractional bits
+template <typename F, unsigned N>
+constexpr F fixed_point_unit() noexcept {
+  return static_cast<F>(std::uintmax_t(1) << N);
+}
+
+// Round x to the nearest integer, halfway cases away from zero, given its
+// truncation t; the difference of the two is exact
+template <typename U, typename F>
+constexpr U fixed_point_round(F x, U t) noexcept {
+  return x - static_cast<F>(t) >= F(0.5) ? static_cast<U>(t + 1)
+       : x - static_cast<F>(t) <= F(-0.5) ? static_cast<U>(t - 1) : t;
+}
+
+}
+
+/// @}
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Fixed-point opaque typedef
+///
+/// A numeric opaque typedef whose underlying integer holds the value
+/// multiplied by 2^FracBits.  Addition, subtraction, remainder and
+/// comparison apply directly to the underlying value.  Multiplication
+/// forms the product in a type twice as wide and shifts it right by
+/// FracBits, and division shifts the dividend left by FracBits before
+/// dividing, so neither divides by the scale at run time.  Products are
+/// rounded toward negative infinity, and quotients toward zero.  Where
+/// the compiler has no 128-bit integer, the products and quotients of 64
+/// bit representations are formed in 64 bits.  Increment and decrement
+/// add and subtract one, not one unit of the underlying value.
+///
+/// Construction from the underlying type sets the underlying value, as for
+/// every opaque typedef.  Construction from another fixed-point opaque type
+/// is explicit and rescales its value, with the shift computed at compile
+/// time.  Construction from floating point is deleted, since it would
+/// otherwise truncate the number into the underlying value; from_floating
+/// rounds to the nearest representable value instead.  The explicit
+/// conversion to floating point is exact where the floating point type has
+/// enough digits.
+///
+/// Operations between types of different scales are declared with the
+/// binop:: mixins, naming as intermediate types the fixed-point type the
+/// operation is to be computed in.  The operands are rescaled to it, and
+/// no floating point is involved.  For example, given Price and Notional,
+/// a Quantity type can declare
+///
+///     binop::multipliable<Notional, true, Price, Quantity,
+///                         Notional, Notional>
+///
+/// to give Price * Quantity -> Notional.  The product is exact to the
+/// resolution of Notional when Notional has at least as many fractional
+/// bits as each operand, and the rescaled operands fit in its
+/// representation.
+///
+/// Template arguments for fixed_point_typedef:
+///  -# Rep : The underlying integral type holding the scaled value
+///  -# FracBits : The number of fractional bits, fewer than the value bits
+///     of Rep
+///  -# O : The opaque type, your subclass
+///
+template <typename Rep, unsigned FracBits, typename O>
+struct fixed_point_typedef : numeric_typedef_base<Rep,O>
+  , binop::multipliable<O>
+  , binop::dividable   <O>
+  , binop::modulable   <O>
+  , binop::addable     <O>
+  , binop::subtractable<O>
+{
+private:
+  using base = numeric_typedef_base<Rep,O>;
+  using wide_type = typename detail::fixed_point_wide<Rep>::type;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  using base::value;
+
+  static_assert(std::is_integral<Rep>::value and
+                not std::is_same<Rep, bool>::value,
+                "fixed_point_typedef requires an integral type");
+  static_assert(FracBits < unsigned(std::numeric_limits<Rep>::digits),
+                "fixed_point_typedef requires fewer fractional bits than "
+                "the value bits of Rep");
+
+  /// The number of fractional bits of the underlying value
+  static constexpr unsigned frac_bits = FracBits;
+
+  ///
+  /// Convert from floating point, rounding to nearest
+  ///
+  /// Halfway cases round away from zero.  The behavior is undefined if
+  /// the result is not representable.
+  ///
+  template <typename F>
+  static constexpr typename std::enable_if<std::is_floating_point<F>::value,
+                                           opaque_type>::type
+  from_floating(F f) noexcept {
+    return opaque_type(detail::fixed_point_round<Rep>(
+        f * detail::fixed_point_unit<F,FracBits>(),
+        static_cast<Rep>(f * detail::fixed_point_unit<F,FracBits>())));
+  }
+
+  /// Convert to floating point
+  template <typename F, typename = typename
+    std::enable_if<std::is_floating_point<F>::value>::type>
+  explicit constexpr operator F() const & noexcept {
+    return static_cast<F>(value) *
+      (F(1) / detail::fixed_point_unit<F,FracBits>());
+  }
+
+  /// Convert to floating point
+  template <typename F, typename = typename
+    std::enable_if<std::is_floating_point<F>::value>::type>
+  explicit constexpr operator F()       && noexcept {
+    return static_cast<F>(value) *
+      (F(1) / detail::fixed_point_unit<F,FracBits>());
+  }
+
+  constexpr14 opaque_type& operator*=(const opaque_type& peer) & noexcept {
+    value = static_cast<Rep>((static_cast<wide_type>(value) * peer.value)
+                             >> FracBits);
+    return downcast(); }
+
+  constexpr14 opaque_type& operator/=(const opaque_type& peer) & noexcept {
+    value = static_cast<Rep>(static_cast<wide_type>(value) *
+                             (wide_type(1) << FracBits) / peer.value);
+    return downcast(); }
+
+
+  constexpr14 opaque_type& operator++() & noexcept {
+    value = static_cast<Rep>(value +
+      detail::fixed_point_scale<Rep,0,FracBits>::apply(Rep(1)));
+    return downcast(); }
+
+  constexpr14 opaque_type& operator--() & noexcept {
+    value = static_cast<Rep>(value -
+      detail::fixed_point_scale<Rep,0,FracBits>::apply(Rep(1)));
+    return downcast(); }
+
+  constexpr14 opaque_type operator++(int) & noexcept {
+    opaque_type r(value); operator++(); return r; }
+
+  constexpr14 opaque_type operator--(int) & noexcept {
+    opaque_type r(value); operator--(); return r; }
+
+
+  /// Rescale the value of another fixed-point opaque type
+  template <typename P, typename = typename std::enable_if<
+    detail::is_fixed_point_opaque<typename std::decay<P>::type>::value and
+    not std::is_same<typename std::decay<P>::type, O>::value>::type>
+  explicit constexpr fixed_point_typedef(P&& p) noexcept
+    : base(rescale<typename std::decay<P>::type>(p.value)) { }
+
+  template <typename F, typename std::enable_if<std::is_floating_point<
+    typename std::decay<F>::type>::value, int>::type = 0>
+  explicit fixed_point_typedef(F&&) = delete;
+
+  using base::base;
+  explicit fixed_point_typedef() = default;
+  fixed_point_typedef(const fixed_point_typedef& ) = default;
+  fixed_point_typedef(      fixed_point_typedef&&) = default;
+  fixed_point_typedef& operator=(const fixed_point_typedef& ) & = default;
+  fixed_point_typedef& operator=(      fixed_point_typedef&&) & = default;
+protected:
+  ~fixed_point_typedef() = default;
+  using base::downcast;
+private:
+  // Widen in the target representation and narrow in the source one
+  template <typename P>
+  static constexpr typename std::enable_if<(FracBits >= P::frac_bits),
+                                           Rep>::type
+  rescale(const typename P::underlying_type& v) noexcept {
+    return detail::fixed_point_scale<Rep, P::frac_bits, FracBits>::apply(
+        static_cast<Rep>(v));
+  }
+  template <typename P>
+  static constexpr typename std::enable_if<(FracBits < P::frac_bits),
+                                           Rep>::type
+  rescale(const typename P::underlying_type& v) noexcept {
+    return static_cast<Rep>(detail::fixed_point_scale<
+        typename P::underlying_type, P::frac_bits, FracBits>::apply(v));
+  }
+};
+
+template <typename Rep, unsigned FracBits, typename O>
+constexpr unsigned fixed_point_typedef<Rep,FracBits,O>::frac_bits;
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,584 @@
+#ifndef OPAQUE_FLAT_MAP_HPP
+#define OPAQUE_FLAT_MAP_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "hash.hpp"
+#include "utility.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#if defined __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Allow lookup in a flat_map by the underlying_type of its key
+///
+/// Specialize this to std::true_type for an opaque key type to let
+/// flat_map<Key,V>::find and friends accept a Key::underlying_type.  It is
+/// off by default because it lets unrelated values of the underlying type
+/// be used as keys, which is what the opaque type is meant to prevent.
+///
+template <typename Key>
+struct allow_underlying_lookup : std::false_type { };
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+//
+// Control bytes for flat_map.  Each slot has one: a full slot holds the
+// low seven bits of its hash, and the high bit marks empty or deleted
+// slots.  A group is the run of control bytes examined at once while
+// probing, returning bit masks of the matching positions.
+//
+
+using ctrl_t = std::int8_t;
+constexpr ctrl_t ctrl_empty   = -128;
+constexpr ctrl_t ctrl_deleted = -2;
+
+#if defined __SSE2__
+
+struct ctrl_group {
+  static constexpr std::size_t width = 16;
+  explicit ctrl_group(const ctrl_t * p) noexcept
+    : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) { }
+  unsigned match(ctrl_t h2) const noexcept {
+    return static_cast<unsigned>(
+        _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl)));
+  }
+  unsigned match_empty() const noexcept { return match(ctrl_empty); }
+  unsigned match_free() const noexcept {
+    return static_cast<unsigned>(_mm_movemask_epi8(ctrl));
+  }
+private:
+  __m128i ctrl;
+};
+
+#else
+
+struct ctrl_group {
+  static constexpr std::size_t width = 8;
+  explicit ctrl_group(const ctrl_t * p) noexcept {
+    std::memcpy(ctrl, p, width);
+  }
+  unsigned match(ctrl_t h2) const noexcept {
+    unsigned m = 0;
+    for (std::size_t i = 0; i != width; ++i) {
+      m |= unsigned(ctrl[i] == h2) << i;
+    }
+    return m;
+  }
+  unsigned match_empty() const noexcept { return match(ctrl_empty); }
+  unsigned match_free() const noexcept {
+    unsigned m = 0;
+    for (std::size_t i = 0; i != width; ++i) m |= unsigned(ctrl[i] < 0) << i;
+    return m;
+  }
+private:
+  ctrl_t ctrl[width];
+};
+
+#endif
+
+inline std::size_t lowest_bit(unsigned m) noexcept {
+  return static_cast<std::size_t>(__builtin_ctz(m));
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Hash map with open addressing, for opaque key types
+///
+/// Elements are stored in one array, with a parallel array of control
+/// bytes that is probed a group at a time with vector instructions (see
+/// "Swiss tables").  Because occupancy is recorded in the control bytes,
+/// every value of the key type may be used as a key.
+///
+/// The hash is std::hash<Key> by default, as defined by OPAQUE_HASHABLE or
+/// OPAQUE_HASHABLE_WITH.  It is scrambled with hashing::mix_bits before use,
+/// so that hashes which are poorly distributed in their low bits, such as
+/// the identity, still spread over the table.
+///
+/// Unlike std::unordered_map, inserting or erasing may invalidate all
+/// iterators and references.  Lookup by Key::underlying_type is available
+/// when allow_underlying_lookup<Key> holds.
+///
+template <typename Key, typename T,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class flat_map {
+  static_assert(detail::is_opaque<Key>::value,
+      "flat_map keys must be opaque typedefs");
+
+  using ctrl_t = detail::ctrl_t;
+  using group = detail::ctrl_group;
+
+public:
+  typedef Key key_type;
+  typedef T mapped_type;
+  typedef std::pair<const Key, T> value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Hash hasher;
+  typedef KeyEqual key_equal;
+  typedef value_type& reference;
+  typedef const value_type& const_reference;
+  typedef typename Key::underlying_type underlying_type;
+
+  template <typename V>
+  class basic_iterator {
+  public:
+    typedef std::forward_iterator_tag iterator_category;
+    typedef typename std::remove_const<V>::type value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef V* pointer;
+    typedef V& reference;
+
+    basic_iterator() noexcept : ctrl(nullptr), slot(nullptr), end(nullptr) { }
+    /// Add const
+    template <typename W, typename = typename std::enable_if<
+      std::is_convertible<W*, V*>::value>::type>
+    basic_iterator(const basic_iterator<W>& i) noexcept
+      : ctrl(i.ctrl), slot(i.slot), end(i.end) { }
+
+    reference operator*() const noexcept { return *slot; }
+    pointer operator->() const noexcept { return slot; }
+    basic_iterator& operator++() noexcept {
+      ++ctrl;
+      ++slot;
+      skip();
+      return *this;
+    }
+    basic_iterator operator++(int) noexcept {
+      basic_iterator i = *this;
+      ++*this;
+      return i;
+    }
+    friend bool operator==(const basic_iterator& l, const basic_iterator& r)
+      noexcept { return l.slot == r.slot; }
+    friend bool operator!=(const basic_iterator& l, const basic_iterator& r)
+      noexcept { return l.slot != r.slot; }
+
+  private:
+    friend class flat_map;
+    template <typename W> friend class basic_iterator;
+    basic_iterator(const ctrl_t * c, V * s, const ctrl_t * e) noexcept
+      : ctrl(c), slot(s), end(e) { }
+    void skip() noexcept {
+      while (ctrl != end and *ctrl < 0) {
+        ++ctrl;
+        ++slot;
+      }
+    }
+    const ctrl_t * ctrl;
+    V * slot;
+    const ctrl_t * end;
+  };
+
+  typedef basic_iterator<      value_type> iterator;
+  typedef basic_iterator<const value_type> const_iterator;
+
+  flat_map() noexcept(std::is_nothrow_default_constructible<Hash>::value and
+                      std::is_nothrow_default_constructible<KeyEqual>::value)
+    : ctrl(nullptr), slots(nullptr), mask(0), used(0), growth(0)
+    , hash(), equal() { }
+
+  explicit flat_map(size_type n, const Hash& h = Hash(),
+                    const KeyEqual& e = KeyEqual())
+    : ctrl(nullptr), slots(nullptr), mask(0), used(0), growth(0)
+    , hash(h), equal(e) {
+    reserve(n);
+  }
+
+  flat_map(const flat_map& peer)
+    : ctrl(nullptr), slots(nullptr), mask(0), used(0), growth(0)
+    , hash(peer.hash), equal(peer.equal) {
+    reserve(peer.size());
+    for (const value_type& v : peer) insert(v);
+  }
+
+  flat_map(flat_map&& peer) noexcept
+    : ctrl(peer.ctrl), slots(peer.slots), mask(peer.mask), used(peer.used)
+    , growth(peer.growth), hash(peer.hash), equal(peer.equal) {
+    peer.release();
+  }
+
+  flat_map& operator=(const flat_map& peer) {
+    if (this != &peer) {
+      flat_map copy(peer);
+      swap(copy);
+    }
+    return *this;
+  }
+
+  flat_map& operator=(flat_map&& peer) noexcept {
+    if (this != &peer) {
+      destroy();
+      ctrl = peer.ctrl;
+      slots = peer.slots;
+      mask = peer.mask;
+      used = peer.used;
+      growth = peer.growth;
+      hash = peer.hash;
+      equal = peer.equal;
+      peer.release();
+    }
+    return *this;
+  }
+
+  ~flat_map() { destroy(); }
+
+  void swap(flat_map& peer) noexcept {
+    using std::swap;
+    swap(ctrl, peer.ctrl);
+    swap(slots, peer.slots);
+    swap(mask, peer.mask);
+    swap(used, peer.used);
+    swap(growth, peer.growth);
+    swap(hash, peer.hash);
+    swap(equal, peer.equal);
+  }
+
+  iterator begin() noexcept {
+    iterator i(ctrl, slots, ctrl + capacity());
+    i.skip();
+    return i;
+  }
+  const_iterator begin() const noexcept {
+    const_iterator i(ctrl, slots, ctrl + capacity());
+    i.skip();
+    return i;
+  }
+  iterator end() noexcept {
+    return iterator(ctrl + capacity(), slots + capacity(), ctrl + capacity());
+  }
+  const_iterator end() const noexcept {
+    return const_iterator(ctrl + capacity(), slots + capacity(),
+                          ctrl + capacity());
+  }
+  const_iterator cbegin() const noexcept { return begin(); }
+  const_iterator cend() const noexcept { return end(); }
+
+  bool empty() const noexcept { return used == 0; }
+  size_type size() const noexcept { return used; }
+  /// The number of slots
+  size_type capacity() const noexcept { return slots ? mask + 1 : 0; }
+
+  void clear() noexcept {
+    if (not slots) return;
+    for (size_type i = 0; i != capacity(); ++i) {
+      if (ctrl[i] >= 0) slots[i].~value_type();
+    }
+    std::memset(ctrl, detail::ctrl_empty, capacity() + group::width);
+    used = 0;
+    growth = max_load(capacity());
+  }
+
+  /// Make room for n elements without further allocation
+  void reserve(size_type n) {
+    size_type cap = group::width;
+    while (max_load(cap) < n) cap *= 2;
+    if (cap > capacity()) resize(cap);
+  }
+
+  template <typename... Args>
+  std::pair<iterator,bool> try_emplace(const key_type& key, Args&&... args) {
+    return emplace_key(key, std::piecewise_construct,
+        std::forward_as_tuple(key),
+        std::forward_as_tuple(opaque::forward<Args>(args)...));
+  }
+
+  template <typename... Args>
+  std::pair<iterator,bool> try_emplace(key_type&& key, Args&&... args) {
+    return emplace_key(key, std::piecewise_construct,
+        std::forward_as_tuple(opaque::move(key)),
+        std::forward_as_tuple(opaque::forward<Args>(args)...));
+  }
+
+  std::pair<iterator,bool> insert(const value_type& v) {
+    return emplace_key(v.first, v);
+  }
+
+  std::pair<iterator,bool> insert(value_type&& v) {
+    return emplace_key(v.first, opaque::move(v));
+  }
+
+  mapped_type& operator[](const key_type& key) {
+    return try_emplace(key).first->second;
+  }
+
+  mapped_type& operator[](key_type&& key) {
+    return try_emplace(opaque::move(key)).first->second;
+  }
+
+  iterator find(const key_type& key) {
+    return to_iterator(find_index(key));
+  }
+  const_iterator find(const key_type& key) const {
+    return to_iterator(find_index(key));
+  }
+  size_type count(const key_type& key) const {
+    return find_index(key) != npos ? 1 : 0;
+  }
+  bool contains(const key_type& key) const {
+    return find_index(key) != npos;
+  }
+  mapped_type& at(const key_type& key) {
+    return at_index(find_index(key));
+  }
+  const mapped_type& at(const key_type& key) const {
+    return at_index(find_index(key));
+  }
+
+  //
+  // Lookup by underlying_type, when allow_underlying_lookup<Key> holds
+  //
+  template <typename U, typename = typename std::enable_if<
+    allow_underlying_lookup<Key>::value and
+    std::is_convertible<const U&, underlying_type>::value>::type>
+  iterator find(const U& u) { return find(key_type(u)); }
+  template <typename U, typename = typename std::enable_if<
+    allow_underlying_lookup<Key>::value and
+    std::is_convertible<const U&, underlying_type>::value>::type>
+  const_iterator find(const U& u) const { return find(key_type(u)); }
+  template <typename U, typename = typename std::enable_if<
+    allow_underlying_lookup<Key>::value and
+    std::is_convertible<const U&, underlying_type>::value>::type>
+  bool contains(const U& u) const { return contains(key_type(u)); }
+  template <typename U, typename = typename std::enable_if<
+    allow_underlying_lookup<Key>::value and
+    std::is_convertible<const U&, underlying_type>::value>::type>
+  mapped_type& at(const U& u) { return at(key_type(u)); }
+  template <typename U, typename = typename std::enable_if<
+    allow_underlying_lookup<Key>::value and
+    std::is_convertible<const U&, underlying_type>::value>::type>
+  const mapped_type& at(const U& u) const { return at(key_type(u)); }
+
+  size_type erase(const key_type& key) {
+    const size_type i = find_index(key);
+    if (i == npos) return 0;
+    erase_index(i);
+    return 1;
+  }
+
+  iterator erase(const_iterator pos) {
+    const size_type i = static_cast<size_type>(pos.slot - slots);
+    erase_index(i);
+    iterator next(ctrl + i, slots + i, ctrl + capacity());
+    next.skip();
+    return next;
+  }
+
+  hasher hash_function() const { return hash; }
+  key_equal key_eq() const { return equal; }
+
+private:
+  static constexpr size_type npos = size_type(-1);
+
+  // At most 7/8 of the slots are used, so every probe finds an empty slot
+  static constexpr size_type max_load(size_type cap) noexcept {
+    return cap - cap / 8;
+  }
+
+  std::uint64_t hash_of(const key_type& key) const {
+    return hashing::mix_bits(static_cast<std::uint64_t>(hash(key)));
+  }
+  static ctrl_t h2(std::uint64_t h) noexcept {
+    return static_cast<ctrl_t>(h & 0x7f);
+  }
+  size_type h1(std::uint64_t h) const noexcept {
+    return static_cast<size_type>(h >> 7) & mask;
+  }
+
+  // Set a control byte, and its copy past the end when it is one of the
+  // first group::width, so a group may be loaded from any slot
+  void set_ctrl(size_type i, ctrl_t c) noexcept {
+    ctrl[i] = c;
+    if (i < group::width) ctrl[capacity() + i] = c;
+  }
+
+  // Groups are visited at triangular offsets, which reach every group
+  // because the number of slots is a power of two
+  size_type find_index(const key_type& key, std::uint64_t h) const {
+    if (not slots) return npos;
+    const ctrl_t tag = h2(h);
+    size_type pos = h1(h);
+    for (size_type step = group::width; ; step += group::width) {
+      const group g(ctrl + pos);
+      for (unsigned m = g.match(tag); m; m &= m - 1) {
+        const size_type i = (pos + detail::lowest_bit(m)) & mask;
+        if (equal(slots[i].first, key)) return i;
+      }
+      if (g.match_empty()) return npos;
+      pos = (pos + step) & mask;
+    }
+  }
+  size_type find_index(const key_type& key) const {
+    return find_index(key, hash_of(key));
+  }
+
+  size_type find_free(std::uint64_t h) const noexcept {
+    size_type pos = h1(h);
+    for (size_type step = group::width; ; step += group::width) {
+      const unsigned m = group(ctrl + pos).match_free();
+      if (m) return (pos + detail::lowest_bit(m)) & mask;
+      pos = (pos + step) & mask;
+    }
+  }
+
+  template <typename... Args>
+  std::pair<iterator,bool> emplace_key(const key_type& key, Args&&... args) {
+    const std::uint64_t h = hash_of(key);
+    size_type i = find_index(key, h);
+    if (i != npos) return std::make_pair(to_iterator(i), false);
+    if (not slots) resize(group::width);
+    i = find_free(h);
+    if (growth == 0 and ctrl[i] == detail::ctrl_empty) {
+      // Reclaim deleted slots if they are many, otherwise grow
+      resize(used * 2 < max_load(capacity()) ? capacity() : capacity() * 2);
+      i = find_free(h);
+    }
+    ::new (static_cast<void*>(slots + i))
+      value_type(opaque::forward<Args>(args)...);
+    if (ctrl[i] == detail::ctrl_empty) --growth;
+    set_ctrl(i, h2(h));
+    ++used;
+    return std::make_pair(to_iterator(i), true);
+  }
+
+  void erase_index(size_type i) {
+    slots[i].~value_type();
+    set_ctrl(i, detail::ctrl_deleted);
+    --used;
+  }
+
+  mapped_type& at_index(size_type i) const {
+    if (i == npos) throw std::out_of_range("flat_map::at");
+    return slots[i].second;
+  }
+
+  iterator to_iterator(size_type i) noexcept {
+    return i == npos ? end()
+      : iterator(ctrl + i, slots + i, ctrl + capacity());
+  }
+  const_iterator to_iterator(size_type i) const noexcept {
+    return i == npos ? end()
+      : const_iterator(ctrl + i, slots + i, ctrl + capacity());
+  }
+
+  // Move every element into a new table of cap slots
+  void resize(size_type cap) {
+    ctrl_t * new_ctrl = new ctrl_t[cap + group::width];
+    value_type * new_slots;
+    try {
+      new_slots = static_cast<value_type*>(
+          ::operator new(cap * sizeof(value_type)));
+    } catch (...) {
+      delete[] new_ctrl;
+      throw;
+    }
+    std::memset(new_ctrl, detail::ctrl_empty, cap + group::width);
+    ctrl_t * old_ctrl = ctrl;
+    value_type * old_slots = slots;
+    const size_type old_cap = capacity();
+    ctrl = new_ctrl;
+    slots = new_slots;
+    mask = cap - 1;
+    growth = max_load(cap) - used;
+    for (size_type j = 0; j != old_cap; ++j) {
+      if (old_ctrl[j] < 0) continue;
+      const std::uint64_t h = hash_of(old_slots[j].first);
+      const size_type i = find_free(h);
+      ::new (static_cast<void*>(slots + i))
+        value_type(opaque::move(old_slots[j]));
+      set_ctrl(i, h2(h));
+      old_slots[j].~value_type();
+    }
+    delete[] old_ctrl;
+    ::operator delete(old_slots);
+  }
+
+  void destroy() noexcept {
+    clear();
+    delete[] ctrl;
+    ::operator delete(slots);
+    release();
+  }
+
+  void release() noexcept {
+    ctrl = nullptr;
+    slots = nullptr;
+    mask = used = growth = 0;
+  }
+
+  ctrl_t * ctrl;
+  value_type * slots;
+  size_type mask;
+  size_type used;
+  size_type growth;
+  Hash hash;
+  KeyEqual equal;
+};
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+constexpr typename flat_map<Key,T,Hash,KeyEqual>::size_type
+flat_map<Key,T,Hash,KeyEqual>::npos;
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void swap(flat_map<Key,T,Hash,KeyEqual>& l, flat_map<Key,T,Hash,KeyEqual>& r)
+  noexcept {
+  l.swap(r);
+}
+
+/// @}
+
+}
+
+#endif
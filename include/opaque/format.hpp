@@ -0,0 +1,516 @@
+#ifndef OPAQUE_FORMAT_HPP
+#define OPAQUE_FORMAT_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "data.hpp"
+#include "type_traits.hpp"
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#if __cplusplus >= 201703L && defined __has_include
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// The result of to_chars and format_to
+///
+/// As std::to_chars_result: on success, ptr is one past the last character
+/// written and ec is value-initialized; when the output does not fit, ptr
+/// is the end of the buffer and ec is std::errc::value_too_large.
+///
+struct to_chars_result {
+  char * ptr;
+  std::errc ec;
+};
+
+///
+/// Formatting traits used by format_to when none are specialized
+///
+/// The prefix and suffix are written around the value, so a unit can be
+/// written as a suffix such as " m".  A precision of -1 writes floating
+/// point values as to_chars does; other precisions give a fixed number of
+/// digits after the point.
+///
+struct default_format_traits {
+  static constexpr const char * prefix() noexcept { return ""; }
+  static constexpr const char * suffix() noexcept { return ""; }
+  static constexpr int precision() noexcept { return -1; }
+};
+
+///
+/// Formatting traits of an opaque type
+///
+/// Specialize this for an opaque type, deriving from default_format_traits
+/// to change only some of the traits.
+///
+template <typename O>
+struct format_traits : default_format_traits { };
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename T = void>
+struct digit_table {
+  static const char pairs[201];
+};
+template <typename T>
+const char digit_table<T>::pairs[201] =
+  "00010203040506070809101112131415161718192021222324252627282930313233"
+  "34353637383940414243444546474849505152535455565758596061626364656667"
+  "6869707172737475767778798081828384858687888990919293949596979899";
+
+inline to_chars_result too_large(char * last) noexcept {
+  return { last, std::errc::value_too_large };
+}
+
+template <typename U>
+unsigned count_digits(U v) noexcept {
+  unsigned n = 1;
+  for (; v >= 10000; v /= 10000) n += 4;
+  if (v >= 1000) return n + 3;
+  if (v >= 100) return n + 2;
+  if (v >= 10) return n + 1;
+  return n;
+}
+
+// Write two digits at a time from the end
+template <typename U>
+to_chars_result format_unsigned(char * first, char * last, U v) noexcept {
+  const unsigned n = count_digits(v);
+  if (static_cast<std::size_t>(last - first) < n) return too_large(last);
+  char * p = first + n;
+  while (v >= 100) {
+    const std::size_t i = static_cast<std::size_t>(v % 100) * 2;
+    v = static_cast<U>(v / 100);
+    *--p = digit_table<>::pairs[i + 1];
+    *--p = digit_table<>::pairs[i];
+  }
+  if (v >= 10) {
+    const std::size_t i = static_cast<std::size_t>(v) * 2;
+    *--p = digit_table<>::pairs[i + 1];
+    *--p = digit_table<>::pairs[i];
+  } else {
+    *--p = static_cast<char>('0' + v);
+  }
+  return { first + n, std::errc() };
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value and
+                        std::is_unsigned<T>::value, to_chars_result>::type
+format_integer(char * first, char * last, T v) noexcept {
+  return format_unsigned(first, last,
+      static_cast<typename std::common_type<T, unsigned>::type>(v));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value and
+                        std::is_signed<T>::value, to_chars_result>::type
+format_integer(char * first, char * last, T v) noexcept {
+  typedef typename std::make_unsigned<
+    typename std::common_type<T, int>::type>::type U;
+  if (v >= 0) return format_unsigned(first, last, static_cast<U>(v));
+  if (first == last) return too_large(last);
+  *first = '-';
+  // Negate in the unsigned type, which is defined for the minimum value
+  const to_chars_result r = format_unsigned(first + 1, last,
+      static_cast<U>(U(0) - static_cast<U>(v)));
+  return r.ec == std::errc() ? r : too_large(last);
+}
+
+inline to_chars_result format_bool(char * first, char * last, bool v) {
+  const char * s = v ? "true" : "false";
+  const std::size_t n = v ? 4 : 5;
+  if (static_cast<std::size_t>(last - first) < n) return too_large(last);
+  std::memcpy(first, s, n);
+  return { first + n, std::errc() };
+}
+
+#if defined __cpp_lib_to_chars
+
+template <typename T>
+to_chars_result format_float(char * first, char * last, T v, int precision) {
+  const std::to_chars_result r = precision < 0
+    ? std::to_chars(first, last, v)
+    : std::to_chars(first, last, v, std::chars_format::fixed, precision);
+  return { r.ptr, r.ec };
+}
+
+#else
+
+template <typename T>
+bool reads_back(const char * s, T v) {
+  const T r = static_cast<T>(std::strtold(s, nullptr));
+  return not (r < v) and not (v < r);
+}
+
+// Without std::to_chars for floating point, use snprintf with the fewest
+// significant digits that read back as the same value
+template <typename T>
+to_chars_result print_float(char * first, char * last, T v, int precision) {
+  char buffer[512];
+  const long double x = v;
+  int n;
+  if (precision >= 0) {
+    n = std::snprintf(buffer, sizeof buffer, "%.*Lf", precision, x);
+  } else {
+    n = std::snprintf(buffer, sizeof buffer, "%.*Lg",
+                      std::numeric_limits<T>::digits10, x);
+    if (n > 0 and not reads_back(buffer, v)) {
+      n = std::snprintf(buffer, sizeof buffer, "%.*Lg",
+                        std::numeric_limits<T>::max_digits10, x);
+    }
+  }
+  if (n < 0 or static_cast<std::size_t>(n) >= sizeof buffer or
+      static_cast<std::size_t>(last - first) < static_cast<std::size_t>(n)) {
+    return too_large(last);
+  }
+  std::memcpy(first, buffer, static_cast<std::size_t>(n));
+  return { first + n, std::errc() };
+}
+
+//
+// Most doubles that are logged have few decimal places, and are m / 10^k
+// for an integer m below 2^53.  Both m and 10^k are exact, so dividing
+// them rounds exactly as reading the decimal would: when it gives back
+// the value, the decimal with the fewest places k is a round trip, and
+// is written without snprintf.  Other values return false.
+//
+inline bool format_decimal(char * first, char * last, double v,
+                           to_chars_result& r) noexcept {
+  static const double exact = 9007199254740992.0;
+  static const double scales[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+                                   1e15 };
+  const bool negative = std::signbit(v);
+  const double a = negative ? -v : v;
+  std::uint64_t scale = 1;
+  for (unsigned k = 0; k != 16; ++k, scale *= 10) {
+    const double s = a * scales[k];
+    if (not (s < exact)) return false;
+    const std::uint64_t m = static_cast<std::uint64_t>(s + 0.5);
+    const double back = static_cast<double>(m) / scales[k];
+    if (back < a or a < back) continue;
+    r = too_large(last);
+    char * p = first;
+    if (negative) {
+      if (p == last) return true;
+      *p++ = '-';
+    }
+    r = format_unsigned(p, last, m / scale);
+    if (r.ec != std::errc() or k == 0) return true;
+    if (static_cast<std::size_t>(last - r.ptr) <= k) {
+      r = too_large(last);
+      return true;
+    }
+    p = r.ptr;
+    *p++ = '.';
+    std::uint64_t f = m % scale;
+    for (unsigned i = k; i != 0; --i, f /= 10) {
+      p[i - 1] = static_cast<char>('0' + f % 10);
+    }
+    r.ptr = p + k;
+    return true;
+  }
+  return false;
+}
+
+template <typename T>
+to_chars_result format_float(char * first, char * last, T v, int precision) {
+  return print_float(first, last, v, precision);
+}
+inline to_chars_result format_float(char * first, char * last, double v,
+                                    int precision) {
+  to_chars_result r;
+  if (precision < 0 and format_decimal(first, last, v, r)) return r;
+  return print_float(first, last, v, precision);
+}
+
+#endif
+
+// Opaque strings are formatted as their characters
+template <typename O, typename = void>
+struct is_char_string : std::false_type { };
+template <typename O>
+struct is_char_string<O, void_t<typename O::opaque_type, decltype(
+    std::declval<const O&>().size()),
+    typename std::enable_if<std::is_convertible<decltype(
+    std::declval<const O&>().data()), const char *>::value>::type>>
+  : std::true_type { };
+
+template <typename O, typename = void>
+struct is_arithmetic_opaque : std::false_type { };
+template <typename O>
+struct is_arithmetic_opaque<O, void_t<typename O::underlying_type>>
+  : std::integral_constant<bool,
+      std::is_arithmetic<typename O::underlying_type>::value and
+      not is_char_string<O>::value and
+      not is_fixed_point_opaque<O>::value> { };
+
+inline to_chars_result copy_chars(char * first, char * last,
+                                  const char * s, std::size_t n) noexcept {
+  if (static_cast<std::size_t>(last - first) < n) return too_large(last);
+  if (n) std::memcpy(first, s, n);
+  return { first + n, std::errc() };
+}
+
+template <typename T>
+typename std::enable_if<std::is_same<T,bool>::value, to_chars_result>::type
+format_value(char * first, char * last, T v, int) {
+  return format_bool(first, last, v);
+}
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value and
+                        not std::is_same<T,bool>::value,
+                        to_chars_result>::type
+format_value(char * first, char * last, T v, int) {
+  return format_integer(first, last, v);
+}
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value,
+                        to_chars_result>::type
+format_value(char * first, char * last, T v, int precision) {
+  return format_float(first, last, v, precision);
+}
+
+// The magnitude of a fixed-point value, and whether it is negative
+template <typename T>
+typename std::enable_if<std::is_unsigned<T>::value, std::uint64_t>::type
+fixed_magnitude(T v, bool& negative) noexcept {
+  negative = false;
+  return v;
+}
+template <typename T>
+typename std::enable_if<std::is_signed<T>::value, std::uint64_t>::type
+fixed_magnitude(T v, bool& negative) noexcept {
+  negative = v < 0;
+  const std::uint64_t m = static_cast<std::uint64_t>(v);
+  return negative ? 0 - m : m;
+}
+
+// Add one to the last of n decimal digits, returning the carry out of
+// the first
+inline bool round_up_digits(char * digits, unsigned n) noexcept {
+  for (; n != 0; --n) {
+    if (digits[n - 1] != '9') {
+      ++digits[n - 1];
+      return false;
+    }
+    digits[n - 1] = '0';
+  }
+  return true;
+}
+
+//
+// Write the fraction f / 2^F, one digit at a time by multiplying what
+// remains by ten.  Without a precision the digits stop as soon as they
+// identify f, being within half of 2^-F of it, and the last digit is
+// rounded to the nearer side, or up when halfway; the remainder and that
+// bound are kept in units of 2^-(F+1).  With a precision the digits are
+// rounded half up.  Only the first F digits can be nonzero, so at most
+// that many are stored.  Every step is exact in 64 bits for F up to 59.
+// As f is the magnitude, rounding up is away from zero.
+//
+template <unsigned F>
+unsigned format_fraction(std::uint64_t f, int precision, char * digits,
+                         bool& carry) noexcept {
+  const std::uint64_t unit = std::uint64_t(1) << F;
+  unsigned n = 0;
+  carry = false;
+  if (precision < 0) {
+    if (f == 0) return 0;
+    std::uint64_t r = f << 1, bound = 1;
+    for (;;) {
+      r *= 10;
+      bound *= 10;
+      digits[n++] = static_cast<char>('0' + (r >> (F + 1)));
+      r &= 2 * unit - 1;
+      const bool low = r < bound, high = r + bound > 2 * unit;
+      if (not low and not high) continue;
+      if (high and (not low or r >= unit)) {
+        carry = round_up_digits(digits, n);
+        while (n != 0 and digits[n - 1] == '0') --n;
+      }
+      return n;
+    }
+  }
+  std::uint64_t r = f;
+  const unsigned stored = static_cast<unsigned>(precision) < F
+                        ? static_cast<unsigned>(precision) : F;
+  for (; n != stored; ++n) {
+    r *= 10;
+    digits[n] = static_cast<char>('0' + (r >> F));
+    r &= unit - 1;
+  }
+  if (2 * r >= unit) carry = round_up_digits(digits, n);
+  return n;
+}
+
+template <unsigned F, typename T>
+to_chars_result format_fixed(char * first, char * last, T v,
+                             int precision) noexcept {
+  static_assert(F <= 59, "Fixed-point values are formatted with up to 59 "
+                         "fractional bits");
+  bool negative;
+  const std::uint64_t m = fixed_magnitude(v, negative);
+  char digits[F + 1];
+  bool carry;
+  const unsigned n = format_fraction<F>(
+      m & ((std::uint64_t(1) << F) - 1), precision, digits, carry);
+  const std::size_t zeros =
+    precision > 0 ? static_cast<std::size_t>(precision) - n : 0;
+  char * p = first;
+  if (negative) {
+    if (p == last) return too_large(last);
+    *p++ = '-';
+  }
+  const to_chars_result r = format_unsigned(p, last, (m >> F) + carry);
+  if (r.ec != std::errc()) return r;
+  if (n == 0 and zeros == 0) return r;
+  p = r.ptr;
+  if (static_cast<std::size_t>(last - p) <= n + zeros) return too_large(last);
+  *p++ = '.';
+  std::memcpy(p, digits, n);
+  std::memset(p + n, '0', zeros);
+  return { p + n + zeros, std::errc() };
+}
+
+template <typename O>
+typename std::enable_if<is_arithmetic_opaque<O>::value,
+                        to_chars_result>::type
+format_opaque(char * first, char * last, const O& o, int precision) {
+  return format_value(first, last, o.value, precision);
+}
+template <typename O>
+typename std::enable_if<is_char_string<O>::value, to_chars_result>::type
+format_opaque(char * first, char * last, const O& o, int) {
+  return copy_chars(first, last, o.data(), o.size());
+}
+template <typename O>
+typename std::enable_if<is_fixed_point_opaque<O>::value,
+                        to_chars_result>::type
+format_opaque(char * first, char * last, const O& o, int precision) {
+  return format_fixed<O::frac_bits>(first, last, o.value, precision);
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Write the value of an opaque type to a character buffer
+///
+/// Numeric opaque types are written as their underlying value: integers,
+/// including character types, in decimal; bool as true or false; and
+/// floating point in a form that reads back as the same value.  That form
+/// is the shortest where std::to_chars supports floating point, and
+/// otherwise the one with the fewest decimal places or digits.
+/// Fixed-point opaque types are written in decimal with the fewest
+/// digits after the point that identify their value.
+/// Opaque strings of char are written as their characters.  Formatting
+/// traits are not applied, and nothing depends on the locale.
+///
+template <typename O>
+auto to_chars(char * first, char * last, const O& o)
+  -> decltype(detail::format_opaque(first, last, o, -1)) {
+  return detail::format_opaque(first, last, o, -1);
+}
+
+///
+/// Write an opaque value to a character buffer with its formatting traits
+///
+/// This writes the prefix, the value as to_chars does but with the
+/// precision of the traits, and the suffix.  Nothing is terminated; on
+/// failure the contents of the buffer are unspecified.
+///
+template <typename O, typename Traits = format_traits<O>>
+auto format_to(char * first, char * last, const O& o)
+  -> decltype(detail::format_opaque(first, last, o, -1)) {
+  const char * prefix = Traits::prefix();
+  const char * suffix = Traits::suffix();
+  to_chars_result r = detail::copy_chars(first, last,
+      prefix, std::char_traits<char>::length(prefix));
+  if (r.ec != std::errc()) return r;
+  r = detail::format_opaque(r.ptr, last, o, Traits::precision());
+  if (r.ec != std::errc()) return r;
+  return detail::copy_chars(r.ptr, last,
+      suffix, std::char_traits<char>::length(suffix));
+}
+
+///
+/// Format an opaque value, with its formatting traits, as a std::string
+///
+template <typename O, typename Traits = format_traits<O>>
+auto to_string(const O& o)
+  -> decltype(detail::format_opaque(nullptr, nullptr, o, -1), std::string()) {
+  char buffer[128];
+  const to_chars_result r =
+    format_to<O,Traits>(buffer, buffer + sizeof buffer, o);
+  if (r.ec == std::errc()) {
+    return std::string(buffer, r.ptr);
+  }
+  std::string s(sizeof buffer, '\0');
+  for (;;) {
+    s.resize(s.size() * 2);
+    char * p = &s[0];
+    const to_chars_result big = format_to<O,Traits>(p, p + s.size(), o);
+    if (big.ec == std::errc()) {
+      s.resize(static_cast<std::size_t>(big.ptr - p));
+      return s;
+    }
+  }
+}
+
+/// @}
+
+}
+
+#endif
@@ -29,7 +29,282 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //
 #include "data.hpp"
+#include "type_traits.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename U, typename O>
+std::true_type is_data(const data<U,O>*);
+std::false_type is_data(...);
+
+template <typename T>
+using is_opaque = decltype(is_data(std::declval<T*>()));
+
+template <typename U, typename O>
+constexpr const U& hash_key(const data<U,O>& key) noexcept {
+  return key.value;
+}
+template <typename T>
+constexpr typename std::enable_if<not is_opaque<T>::value, const T&>::type
+hash_key(const T& key) noexcept {
+  return key;
+}
+
+template <typename T>
+using if_integer_t = typename std::enable_if<
+  std::is_integral<T>::value or std::is_enum<T>::value>::type;
+
+template <typename T, typename = void>
+struct is_byte_sequence : std::false_type { };
+template <typename T>
+struct is_byte_sequence<T, void_t<decltype(
+    std::declval<const T&>().data() + std::declval<const T&>().size())>>
+  : std::is_trivially_copyable<typename std::remove_pointer<
+      decltype(std::declval<const T&>().data())>::type> { };
+
+// Multiply to 128 bits, leaving the low half in a and the high half in b
+inline void hash_mum(std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined __SIZEOF_INT128__
+  __extension__ typedef unsigned __int128 uint128;
+  uint128 r = a;
+  r *= b;
+  a = static_cast<std::uint64_t>(r);
+  b = static_cast<std::uint64_t>(r >> 64);
+#else
+  const std::uint64_t ha = a >> 32, la = a & 0xffffffff;
+  const std::uint64_t hb = b >> 32, lb = b & 0xffffffff;
+  const std::uint64_t hh = ha * hb, hl = ha * lb, lh = la * hb, ll = la * lb;
+  const std::uint64_t mid = (ll >> 32) + (hl & 0xffffffff) + (lh & 0xffffffff);
+  a = ll + (hl << 32) + (lh << 32);
+  b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+}
+
+inline std::uint64_t hash_mix(std::uint64_t a, std::uint64_t b) noexcept {
+  hash_mum(a, b);
+  return a ^ b;
+}
+
+inline std::uint64_t hash_read8(const unsigned char * p) noexcept {
+  std::uint64_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+inline std::uint64_t hash_read4(const unsigned char * p) noexcept {
+  std::uint32_t v;
+  std::memcpy(&v, p, sizeof(v));
+  return v;
+}
+inline std::uint64_t hash_read3(const unsigned char * p, std::size_t n)
+  noexcept {
+  return std::uint64_t(p[0]) << 16 | std::uint64_t(p[n >> 1]) << 8 | p[n - 1];
+}
+
+constexpr std::uint64_t hash_shift(std::uint64_t x, unsigned s) noexcept {
+  return x ^ x >> s;
+}
+
+}
+
+/// @}
+
+namespace hashing {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Scramble the bits of an integer
+///
+/// Every input bit affects every output bit.  This is the finalizer of
+/// the SplitMix64 generator, and is a bijection.
+///
+constexpr std::uint64_t mix_bits(std::uint64_t x) noexcept {
+  return detail::hash_shift(detail::hash_shift(detail::hash_shift(
+      x, 30) * 0xbf58476d1ce4e5b9ull, 27) * 0x94d049bb133111ebull, 31);
+}
+
+///
+/// Hash a sequence of bytes
+///
+/// This follows wyhash: input is consumed eight bytes at a time, in three
+/// independent lanes for long inputs, and combined with 64x64->128 bit
+/// multiplication.  Results assume little-endian loads, so they differ
+/// between platforms of different byte order.
+///
+inline std::uint64_t hash_bytes(const void * key, std::size_t n,
+                                std::uint64_t seed = 0) noexcept {
+  using namespace opaque::detail;
+  const std::uint64_t s[4] = {
+    0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull,
+    0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+  const unsigned char * p = static_cast<const unsigned char *>(key);
+  seed ^= hash_mix(seed ^ s[0], s[1]);
+  std::uint64_t a, b;
+  if (n <= 16) {
+    if (n >= 4) {
+      const std::size_t k = (n >> 3) << 2;
+      a = hash_read4(p) << 32 | hash_read4(p + k);
+      b = hash_read4(p + n - 4) << 32 | hash_read4(p + n - 4 - k);
+    } else if (n > 0) {
+      a = hash_read3(p, n);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    std::size_t i = n;
+    if (i > 48) {
+      std::uint64_t see1 = seed, see2 = seed;
+      do {
+        seed = hash_mix(hash_read8(p     ) ^ s[1], hash_read8(p +  8) ^ seed);
+        see1 = hash_mix(hash_read8(p + 16) ^ s[2], hash_read8(p + 24) ^ see1);
+        see2 = hash_mix(hash_read8(p + 32) ^ s[3], hash_read8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = hash_mix(hash_read8(p) ^ s[1], hash_read8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = hash_read8(p + i - 16);
+    b = hash_read8(p + i - 8);
+  }
+  a ^= s[1];
+  b ^= seed;
+  hash_mum(a, b);
+  return hash_mix(a ^ s[0] ^ n, b ^ s[1]);
+}
+
+///
+/// Hash with std::hash of the underlying type
+///
+/// This is the policy used by OPAQUE_HASHABLE.
+///
+struct standard {
+  template <typename K>
+  std::size_t operator()(const K& key) const {
+    using T = typename std::decay<decltype(detail::hash_key(key))>::type;
+    return std::hash<T>{}(detail::hash_key(key));
+  }
+};
+
+///
+/// Use integers as their own hash
+///
+/// This is the cheapest hash, and is ideal for dense sequential keys in a
+/// table that reduces hashes modulo a prime.  It is poor for tables that
+/// keep only the low bits of the hash when keys share low bits.
+///
+struct identity {
+  template <typename K>
+  std::size_t operator()(const K& key) const
+    noexcept(noexcept(apply(detail::hash_key(key)))) {
+    return apply(detail::hash_key(key));
+  }
+private:
+  template <typename T, typename = detail::if_integer_t<T>>
+  static constexpr std::size_t apply(const T& v) noexcept {
+    return static_cast<std::size_t>(v);
+  }
+  template <typename T>
+  static std::size_t apply(T * const & v) noexcept {
+    return reinterpret_cast<std::uintptr_t>(v);
+  }
+  template <typename T, typename = typename std::enable_if<
+    not std::is_integral<T>::value and not std::is_enum<T>::value and
+    not std::is_pointer<T>::value>::type, typename = void>
+  static std::size_t apply(const T& v) {
+    return std::hash<T>{}(v);
+  }
+};
+
+///
+/// Scramble integers with mix_bits
+///
+/// Suitable for open-addressing tables that keep only some bits of the
+/// hash.  Floating-point values are hashed by representation, with both
+/// zeros hashing alike.  Other types have their std::hash scrambled.
+///
+struct mix {
+  template <typename K>
+  std::size_t operator()(const K& key) const
+    noexcept(noexcept(apply(detail::hash_key(key)))) {
+    return apply(detail::hash_key(key));
+  }
+private:
+  template <typename T, typename = detail::if_integer_t<T>>
+  static constexpr std::size_t apply(const T& v) noexcept {
+    return static_cast<std::size_t>(mix_bits(static_cast<std::uint64_t>(v)));
+  }
+  template <typename T, typename = typename std::enable_if<
+    std::is_floating_point<T>::value>::type, typename = void>
+  static std::size_t apply(const T& v) noexcept {
+    const T z = std::fpclassify(v) == FP_ZERO ? T(0) : v;
+    std::uint64_t bits = 0;
+    std::memcpy(&bits, &z, sizeof(z) < sizeof(bits) ? sizeof(z) : sizeof(bits));
+    return static_cast<std::size_t>(mix_bits(bits));
+  }
+  template <typename T, typename = typename std::enable_if<
+    not std::is_integral<T>::value and not std::is_enum<T>::value and
+    not std::is_floating_point<T>::value>::type, typename = void,
+    typename = void>
+  static std::size_t apply(const T& v) {
+    return static_cast<std::size_t>(mix_bits(std::hash<T>{}(v)));
+  }
+};
+
+///
+/// Hash the bytes of strings and integers with hash_bytes
+///
+/// Strings, and other types with data() and size() over trivially
+/// copyable elements, are hashed by content.  Integers are hashed by
+/// representation.  Other types are hashed with std::hash.
+///
+struct bytes {
+  template <typename K>
+  std::size_t operator()(const K& key) const
+    noexcept(noexcept(apply(detail::hash_key(key)))) {
+    return apply(detail::hash_key(key));
+  }
+private:
+  template <typename T, typename = typename std::enable_if<
+    detail::is_byte_sequence<T>::value>::type>
+  static std::size_t apply(const T& v) noexcept {
+    return static_cast<std::size_t>(
+        hash_bytes(v.data(), v.size() * sizeof(*v.data())));
+  }
+  template <typename T, typename = detail::if_integer_t<T>, typename = void>
+  static std::size_t apply(const T& v) noexcept {
+    return static_cast<std::size_t>(hash_bytes(&v, sizeof(v)));
+  }
+  template <typename T, typename = typename std::enable_if<
+    not detail::is_byte_sequence<T>::value and
+    not std::is_integral<T>::value and not std::is_enum<T>::value>::type,
+    typename = void, typename = void>
+  static std::size_t apply(const T& v) {
+    return std::hash<T>{}(v);
+  }
+};
+
+/// @}
+
+}
+
+}
 
 /// \addtogroup miscellaneous
 /// @{
@@ -51,6 +326,25 @@ namespace std {\
   };\
 }
 
+///
+/// Create a std::hash specialization for an opaque typedef using a policy
+///
+/// The policy is a function object such as those in opaque::hashing.
+/// This macro must be used outside any namespace, because it creates a
+/// specialization in std.
+///
+#define OPAQUE_HASHABLE_WITH(name, policy) \
+namespace std {\
+  template <> struct hash<name> {\
+    using argument_type = typename name::opaque_type;\
+    using result_type = size_t;\
+    result_type operator()(const argument_type& key) const\
+      noexcept(noexcept(policy{}(key))) {\
+      return policy{}(key);\
+    }\
+  };\
+}
+
 /// @}
 
 #endif
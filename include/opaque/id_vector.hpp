@@ -0,0 +1,344 @@
+#ifndef OPAQUE_ID_VECTOR_HPP
+#define OPAQUE_ID_VECTOR_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "data.hpp"
+#include "hash.hpp"
+#include "span.hpp"
+#include "utility.hpp"
+#include <cassert>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename Id>
+struct id_traits {
+  static_assert(is_opaque<Id>::value,
+      "The index type must be an opaque typedef");
+  using underlying_type = typename Id::underlying_type;
+  static_assert(std::is_integral<underlying_type>::value,
+      "The index type must wrap an integer");
+
+  static std::size_t index(const Id& id) noexcept {
+    return static_cast<std::size_t>(id.value);
+  }
+  static Id make(std::size_t i) {
+    return Id(static_cast<underlying_type>(i));
+  }
+};
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Range of consecutive opaque indices
+///
+template <typename Id>
+class id_range {
+public:
+  class iterator {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef Id value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef const Id* pointer;
+    typedef Id reference;
+
+    explicit iterator(std::size_t i_ = 0) noexcept : i(i_) { }
+    Id operator*() const { return detail::id_traits<Id>::make(i); }
+    iterator& operator++() noexcept { ++i; return *this; }
+    iterator operator++(int) noexcept { iterator r = *this; ++i; return r; }
+    friend bool operator==(iterator l, iterator r) noexcept {
+      return l.i == r.i; }
+    friend bool operator!=(iterator l, iterator r) noexcept {
+      return l.i != r.i; }
+  private:
+    std::size_t i;
+  };
+
+  constexpr id_range(std::size_t first_, std::size_t last_) noexcept
+    : first(first_), last(last_) { }
+  iterator begin() const noexcept { return iterator(first); }
+  iterator end() const noexcept { return iterator(last); }
+  std::size_t size() const noexcept { return last - first; }
+
+private:
+  std::size_t first;
+  std::size_t last;
+};
+
+///
+/// Range of (index, element) pairs over contiguous elements
+///
+/// Dereferencing an iterator gives a std::pair<Id, T&> by value, so the
+/// elements may be modified through it.
+///
+template <typename Id, typename T>
+class id_item_range {
+public:
+  typedef std::pair<Id, T&> value_type;
+
+  class iterator {
+  public:
+    typedef std::input_iterator_tag iterator_category;
+    typedef std::pair<Id, T&> value_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef void pointer;
+    typedef value_type reference;
+
+    iterator(T * p_, std::size_t i_) noexcept : p(p_), i(i_) { }
+    value_type operator*() const {
+      return value_type(detail::id_traits<Id>::make(i), *p);
+    }
+    iterator& operator++() noexcept { ++p; ++i; return *this; }
+    iterator operator++(int) noexcept { iterator r = *this; ++*this; return r; }
+    friend bool operator==(iterator l, iterator r) noexcept {
+      return l.p == r.p; }
+    friend bool operator!=(iterator l, iterator r) noexcept {
+      return l.p != r.p; }
+  private:
+    T * p;
+    std::size_t i;
+  };
+
+  id_item_range(T * p_, std::size_t n_) noexcept : p(p_), n(n_) { }
+  iterator begin() const noexcept { return iterator(p, 0); }
+  iterator end() const noexcept { return iterator(p + n, n); }
+  std::size_t size() const noexcept { return n; }
+
+private:
+  T * p;
+  std::size_t n;
+};
+
+///
+/// Non-owning view of contiguous elements indexed by an opaque index type
+///
+/// operator[] accepts only Id.  It is checked with assert, so it costs
+/// nothing when NDEBUG is defined; at() always checks.
+///
+template <typename Id, typename T>
+class id_span {
+  using traits = detail::id_traits<Id>;
+public:
+  typedef Id index_type;
+  typedef T element_type;
+  typedef typename std::remove_cv<T>::type value_type;
+  typedef std::size_t size_type;
+  typedef T& reference;
+  typedef T* iterator;
+
+  constexpr id_span() noexcept : s() { }
+  constexpr explicit id_span(span<T> s_) noexcept : s(s_) { }
+  constexpr id_span(T * p, size_type n) noexcept : s(p, n) { }
+
+  /// Add const to the element type
+  template <typename E, typename = typename std::enable_if<
+    std::is_convertible<E(*)[], T(*)[]>::value>::type>
+  constexpr id_span(const id_span<Id,E>& peer) noexcept : s(peer.values()) { }
+
+  reference operator[](const Id& id) const noexcept {
+    assert(traits::index(id) < size());
+    return s[traits::index(id)];
+  }
+  reference at(const Id& id) const {
+    if (not contains(id)) throw std::out_of_range("id_span::at");
+    return s[traits::index(id)];
+  }
+  bool contains(const Id& id) const noexcept {
+    return traits::index(id) < size();
+  }
+
+  T * data() const noexcept { return s.data(); }
+  size_type size() const noexcept { return s.size(); }
+  bool empty() const noexcept { return s.empty(); }
+
+  /// The elements, without indices
+  iterator begin() const noexcept { return s.begin(); }
+  iterator end() const noexcept { return s.end(); }
+  span<T> values() const noexcept { return s; }
+
+  /// The valid indices
+  id_range<Id> ids() const noexcept { return id_range<Id>(0, size()); }
+  /// The elements with their indices
+  id_item_range<Id,T> items() const noexcept {
+    return id_item_range<Id,T>(data(), size());
+  }
+
+private:
+  span<T> s;
+};
+
+///
+/// Contiguous container indexed by an opaque index type
+///
+/// This is a std::vector whose elements are identified by Id rather than
+/// by position.  operator[] accepts only Id, and is checked with assert,
+/// so it costs nothing when NDEBUG is defined; at() always checks.
+/// Appending returns the index of the new element.
+///
+/// The iterators of the container visit the elements only; use items()
+/// to visit (Id, T&) pairs, or ids() for the indices.
+///
+template <typename Id, typename T, typename Allocator = std::allocator<T>>
+class id_vector {
+  using traits = detail::id_traits<Id>;
+  using storage = std::vector<T, Allocator>;
+  static_assert(not std::is_same<T, bool>::value,
+      "std::vector<bool> does not store elements contiguously");
+
+public:
+  typedef Id index_type;
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef typename storage::size_type size_type;
+  typedef typename storage::reference reference;
+  typedef typename storage::const_reference const_reference;
+  typedef typename storage::iterator iterator;
+  typedef typename storage::const_iterator const_iterator;
+
+  id_vector() = default;
+  explicit id_vector(size_type n) : v(n) { }
+  id_vector(size_type n, const T& value) : v(n, value) { }
+  id_vector(std::initializer_list<T> il) : v(il) { }
+  /// Adopt the elements of a vector, indexed by position
+  explicit id_vector(storage&& values) noexcept : v(opaque::move(values)) { }
+
+  reference operator[](const Id& id) noexcept {
+    assert(traits::index(id) < size());
+    return v[traits::index(id)];
+  }
+  const_reference operator[](const Id& id) const noexcept {
+    assert(traits::index(id) < size());
+    return v[traits::index(id)];
+  }
+  reference at(const Id& id) {
+    if (not contains(id)) throw std::out_of_range("id_vector::at");
+    return v[traits::index(id)];
+  }
+  const_reference at(const Id& id) const {
+    if (not contains(id)) throw std::out_of_range("id_vector::at");
+    return v[traits::index(id)];
+  }
+  bool contains(const Id& id) const noexcept {
+    return traits::index(id) < size();
+  }
+
+  /// Append an element, returning its index
+  Id push_back(const T& value) {
+    v.push_back(value);
+    return traits::make(size() - 1);
+  }
+  Id push_back(T&& value) {
+    v.push_back(opaque::move(value));
+    return traits::make(size() - 1);
+  }
+  template <typename... Args>
+  Id emplace_back(Args&&... args) {
+    v.emplace_back(opaque::forward<Args>(args)...);
+    return traits::make(size() - 1);
+  }
+  /// The index the next appended element will have
+  Id next_id() const { return traits::make(size()); }
+
+  void pop_back() { v.pop_back(); }
+  void clear() noexcept { v.clear(); }
+  void reserve(size_type n) { v.reserve(n); }
+  void resize(size_type n) { v.resize(n); }
+  void resize(size_type n, const T& value) { v.resize(n, value); }
+  void shrink_to_fit() { v.shrink_to_fit(); }
+
+  size_type size() const noexcept { return v.size(); }
+  size_type capacity() const noexcept { return v.capacity(); }
+  bool empty() const noexcept { return v.empty(); }
+  T * data() noexcept { return v.data(); }
+  const T * data() const noexcept { return v.data(); }
+
+  iterator begin() noexcept { return v.begin(); }
+  iterator end() noexcept { return v.end(); }
+  const_iterator begin() const noexcept { return v.begin(); }
+  const_iterator end() const noexcept { return v.end(); }
+  const_iterator cbegin() const noexcept { return v.cbegin(); }
+  const_iterator cend() const noexcept { return v.cend(); }
+
+  /// The valid indices
+  id_range<Id> ids() const noexcept { return id_range<Id>(0, size()); }
+  /// The elements with their indices
+  id_item_range<Id,T> items() noexcept {
+    return id_item_range<Id,T>(data(), size());
+  }
+  id_item_range<Id,const T> items() const noexcept {
+    return id_item_range<Id,const T>(data(), size());
+  }
+
+  /// View the elements
+  operator id_span<Id,T>() noexcept { return id_span<Id,T>(data(), size()); }
+  operator id_span<Id,const T>() const noexcept {
+    return id_span<Id,const T>(data(), size());
+  }
+
+  /// The underlying vector, indexed by position
+  const storage& values() const noexcept { return v; }
+  /// Release the underlying vector
+  storage release() noexcept {
+    storage r(opaque::move(v));
+    v.clear();
+    return r;
+  }
+
+  friend bool operator==(const id_vector& l, const id_vector& r) {
+    return l.v == r.v; }
+  friend bool operator!=(const id_vector& l, const id_vector& r) {
+    return l.v != r.v; }
+
+private:
+  storage v;
+};
+
+/// @}
+
+}
+
+#endif
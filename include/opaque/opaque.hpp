@@ -45,6 +45,23 @@ namespace opaque {
 ///
 namespace binop { }
 
+///
+/// Vector Operations
+///
+/// Lane-wise operations on contiguous values, using vector instructions
+/// where available.
+///
+namespace simd { }
+
+///
+/// Hash Policies
+///
+/// Function objects hashing opaque typedefs, or their underlying types,
+/// for use with OPAQUE_HASHABLE_WITH or directly as the hash of a
+/// container.  Types a policy does not handle are hashed with std::hash.
+///
+namespace hashing { }
+
 ///
 /// Experimental Opaque Typedefs
 ///
@@ -0,0 +1,320 @@
+#ifndef OPAQUE_OVERFLOW_HPP
+#define OPAQUE_OVERFLOW_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "constexpr14.hpp"
+#include "type_traits.hpp"
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined __GNUC__ || defined __clang__
+#define OPAQUE_OVERFLOW_BUILTINS
+#endif
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+#if defined OPAQUE_OVERFLOW_BUILTINS
+__attribute__((noinline, cold))
+#endif
+[[noreturn]] inline void throw_overflow() {
+  throw std::overflow_error("opaque: arithmetic overflow");
+}
+
+template <typename U>
+constexpr bool is_negative(U x, std::true_type) noexcept { return x < U(0); }
+template <typename U>
+constexpr bool is_negative(U  , std::false_type) noexcept { return false; }
+template <typename U>
+constexpr bool is_negative(U x) noexcept {
+  return is_negative(x, std::is_signed<U>());
+}
+
+//
+// Store the result of an operation in r, wrapped to the width of U, and
+// return whether the mathematical result did not fit.  Each is a single
+// flag test with the compiler builtins.
+//
+
+// Unsigned, and at least as wide as unsigned so that it does not promote
+template <typename U>
+using wrapping_t = typename std::common_type<
+  typename std::make_unsigned<U>::type, unsigned>::type;
+
+#if defined OPAQUE_OVERFLOW_BUILTINS
+
+template <typename U>
+constexpr14 bool add_overflow(U a, U b, U& r) noexcept {
+  return __builtin_add_overflow(a, b, &r);
+}
+template <typename U>
+constexpr14 bool sub_overflow(U a, U b, U& r) noexcept {
+  return __builtin_sub_overflow(a, b, &r);
+}
+template <typename U>
+constexpr14 bool mul_overflow(U a, U b, U& r) noexcept {
+  return __builtin_mul_overflow(a, b, &r);
+}
+
+#else
+
+template <typename U>
+constexpr14 bool add_overflow(U a, U b, U& r) noexcept {
+  using W = wrapping_t<U>;
+  using L = std::numeric_limits<U>;
+  r = static_cast<U>(static_cast<W>(static_cast<W>(a) + static_cast<W>(b)));
+  return is_negative(b) ? a < L::min() - b : a > L::max() - b;
+}
+template <typename U>
+constexpr14 bool sub_overflow(U a, U b, U& r) noexcept {
+  using W = wrapping_t<U>;
+  using L = std::numeric_limits<U>;
+  r = static_cast<U>(static_cast<W>(static_cast<W>(a) - static_cast<W>(b)));
+  return is_negative(b) ? a > L::max() + b : a < L::min() + b;
+}
+template <typename U>
+constexpr14 bool mul_overflow(U a, U b, U& r) noexcept {
+  using W = wrapping_t<U>;
+  using L = std::numeric_limits<U>;
+  r = static_cast<U>(static_cast<W>(static_cast<W>(a) * static_cast<W>(b)));
+  if (a == U(0) or b == U(0)) return false;
+  if (is_negative(a)) {
+    return is_negative(b) ? a < L::max() / b : b > L::min() / a;
+  }
+  return is_negative(b) ? b < L::min() / a : a > L::max() / b;
+}
+
+#endif
+
+// Division and remainder overflow only for the minimum of a signed type
+// divided by -1
+template <typename U>
+constexpr14 bool div_overflow(U a, U b, U& r, std::true_type) noexcept {
+  if (b == U(-1) and a == std::numeric_limits<U>::min()) {
+    r = a;
+    return true;
+  }
+  r = static_cast<U>(a / b);
+  return false;
+}
+template <typename U>
+constexpr14 bool div_overflow(U a, U b, U& r, std::false_type) noexcept {
+  r = static_cast<U>(a / b);
+  return false;
+}
+template <typename U>
+constexpr14 U checked_mod(U a, U b, std::true_type) noexcept {
+  return b == U(-1) ? U(0) : static_cast<U>(a % b);
+}
+template <typename U>
+constexpr14 U checked_mod(U a, U b, std::false_type) noexcept {
+  return static_cast<U>(a % b);
+}
+
+//
+// Branchless saturating arithmetic.  Types narrower than long long are
+// computed exactly in long long and clamped, which compiles to conditional
+// moves.  For wider types the overflow flag becomes a mask that selects
+// between the wrapped result and the limit.  Either way there is no branch
+// to mispredict, and loops over these remain straight-line code.
+//
+
+template <typename U>
+using is_narrow =
+  std::integral_constant<bool, sizeof(U) < sizeof(long long)>;
+
+template <typename U>
+constexpr U clamp_wide(long long w) noexcept {
+  return static_cast<U>(
+      w < std::numeric_limits<U>::min() ? std::numeric_limits<U>::min() :
+      w > std::numeric_limits<U>::max() ? std::numeric_limits<U>::max() : w);
+}
+
+template <typename U>
+constexpr14 U select(bool take, U if_true, U if_false) noexcept {
+  using W = wrapping_t<U>;
+  const W mask = static_cast<W>(W(0) - W(take));
+  return static_cast<U>((static_cast<W>(if_true) & mask) |
+                        (static_cast<W>(if_false) & static_cast<W>(~mask)));
+}
+
+// The maximum of U if positive, and otherwise the minimum, which is one
+// more than the maximum for a signed type and zero for an unsigned one
+template <typename U>
+constexpr U saturation(bool positive, std::true_type) noexcept {
+  return static_cast<U>(static_cast<wrapping_t<U>>(
+      static_cast<wrapping_t<U>>(std::numeric_limits<U>::max()) +
+      wrapping_t<U>(not positive)));
+}
+template <typename U>
+constexpr U saturation(bool positive, std::false_type) noexcept {
+  return static_cast<U>(wrapping_t<U>(0) - wrapping_t<U>(positive));
+}
+template <typename U>
+constexpr U saturation(bool positive) noexcept {
+  return saturation<U>(positive, std::is_signed<U>());
+}
+
+template <typename U>
+constexpr U saturate_add(U a, U b, std::true_type) noexcept {
+  return clamp_wide<U>(static_cast<long long>(a) + b);
+}
+template <typename U>
+constexpr14 U saturate_add(U a, U b, std::false_type) noexcept {
+  U r = U();
+  const bool o = add_overflow(a, b, r);
+  return select(o, saturation<U>(not is_negative(b)), r);
+}
+template <typename U>
+constexpr14 U saturate_add(U a, U b) noexcept {
+  return saturate_add(a, b, is_narrow<U>());
+}
+
+template <typename U>
+constexpr U saturate_sub(U a, U b, std::true_type) noexcept {
+  return clamp_wide<U>(static_cast<long long>(a) - b);
+}
+template <typename U>
+constexpr14 U saturate_sub(U a, U b, std::false_type) noexcept {
+  U r = U();
+  const bool o = sub_overflow(a, b, r);
+  return select(o, saturation<U>(is_negative(b)), r);
+}
+template <typename U>
+constexpr14 U saturate_sub(U a, U b) noexcept {
+  return saturate_sub(a, b, is_narrow<U>());
+}
+
+template <typename U>
+constexpr U saturate_mul(U a, U b, std::true_type) noexcept {
+  return clamp_wide<U>(static_cast<long long>(a) * b);
+}
+template <typename U>
+constexpr14 U saturate_mul(U a, U b, std::false_type) noexcept {
+  U r = U();
+  const bool o = mul_overflow(a, b, r);
+  return select(o, saturation<U>(is_negative(a) == is_negative(b)), r);
+}
+template <typename U>
+constexpr14 U saturate_mul(U a, U b) noexcept {
+  return saturate_mul(a, b, is_narrow<U>());
+}
+
+// The minimum of a signed type divided by -1 is the maximum, and the
+// remainder of that division is zero.  The divisor is replaced by one so
+// that the overflowing division is never executed.
+template <typename U>
+constexpr14 U saturate_div(U a, U b, std::true_type) noexcept {
+  const bool o = b == U(-1) and a == std::numeric_limits<U>::min();
+  return select(o, std::numeric_limits<U>::max(),
+                static_cast<U>(a / select(o, U(1), b)));
+}
+template <typename U>
+constexpr14 U saturate_div(U a, U b, std::false_type) noexcept {
+  return static_cast<U>(a / b);
+}
+template <typename U>
+constexpr14 U saturate_div(U a, U b) noexcept {
+  return saturate_div(a, b, std::is_signed<U>());
+}
+template <typename U>
+constexpr14 U saturate_mod(U a, U b, std::true_type) noexcept {
+  return static_cast<U>(a % select(b == U(-1), U(1), b));
+}
+template <typename U>
+constexpr14 U saturate_mod(U a, U b, std::false_type) noexcept {
+  return static_cast<U>(a % b);
+}
+template <typename U>
+constexpr14 U saturate_mod(U a, U b) noexcept {
+  return saturate_mod(a, b, std::is_signed<U>());
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+//
+// Overflow policies for checked_numeric_typedef, and the overflow_policy
+// of saturating_typedef
+//
+// A policy provides overflow(wrapped, positive), which is called when the
+// result of an operation does not fit in the underlying type.  The
+// arguments are the result wrapped to the width of the type, and whether
+// the mathematical result was too large rather than too small.  Its return
+// value is stored instead of the result.
+//
+
+/// Throw std::overflow_error
+struct throw_on_overflow {
+  template <typename U>
+  [[noreturn]] static U overflow(U, bool) { detail::throw_overflow(); }
+};
+
+/// Clamp the result to the limits of the underlying type
+struct saturate_on_overflow {
+  template <typename U>
+  static constexpr U overflow(U, bool positive) noexcept {
+    return positive ? std::numeric_limits<U>::max()
+                    : std::numeric_limits<U>::min();
+  }
+};
+
+/// Wrap the result modulo the width of the underlying type
+struct wrap_on_overflow {
+  template <typename U>
+  static constexpr U overflow(U wrapped, bool) noexcept { return wrapped; }
+};
+
+/// Terminate the program abnormally
+struct trap_on_overflow {
+  template <typename U>
+  [[noreturn]] static U overflow(U, bool) noexcept {
+#if defined OPAQUE_OVERFLOW_BUILTINS
+    __builtin_trap();
+#else
+    std::abort();
+#endif
+  }
+};
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,397 @@
+#ifndef OPAQUE_PARSE_HPP
+#define OPAQUE_PARSE_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "format.hpp"
+#include "span.hpp"
+#include <cctype>
+#include <cmath>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+#if __cplusplus >= 201703L && defined __has_include
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// The result of from_chars
+///
+/// As std::from_chars_result: ptr is one past the characters that make up
+/// the value, and ec is value-initialized on success.  When there is no
+/// value, ptr is the first character and ec is std::errc::invalid_argument;
+/// when the value does not fit, ptr is past it and ec is
+/// std::errc::result_out_of_range.  On failure the target is unchanged.
+///
+struct from_chars_result {
+  const char * ptr;
+  std::errc ec;
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+inline bool is_digit(char c) noexcept {
+  return static_cast<unsigned>(c - '0') < 10u;
+}
+
+#if defined __GNUC__ && defined __BYTE_ORDER__
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define OPAQUE_PARSE_SWAR
+#endif
+#endif
+
+#if defined OPAQUE_PARSE_SWAR
+
+//
+// Parse the leading digits of the eight bytes at p at once, returning
+// their number and setting their value.  A byte is a digit when its high
+// nibble is 3 both before and after adding 6; carries and borrows from a
+// byte that is not a digit only reach the bytes after it.  The digits are
+// shifted to the top, so that the bytes after them read as leading zeros,
+// and combined in pairs, fours and eights by multiplication.
+//
+inline unsigned parse_eight(const char * p, std::uint64_t& value) noexcept {
+  const std::uint64_t ones = 0x0101010101010101u;
+  std::uint64_t v;
+  std::memcpy(&v, p, sizeof v);
+  const std::uint64_t high = 0xf0f0f0f0f0f0f0f0u;
+  const std::uint64_t bad =
+    ((v & high) | (((v + 6 * ones) & high) >> 4)) ^ (0x33 * ones);
+  const unsigned n = bad ? static_cast<unsigned>(__builtin_ctzll(bad)) / 8
+                         : 8u;
+  value = 0;
+  if (n == 0) return 0;
+  std::uint64_t d = (v - 0x30 * ones) << (8 * (8 - n));
+  d = d * 10 + (d >> 8);
+  const std::uint64_t mask = 0x000000ff000000ffu;
+  value = ((d & mask) * (100 + (1000000ull << 32)) +
+           ((d >> 16) & mask) * (1 + (10000ull << 32))) >> 32;
+  return n;
+}
+
+#endif
+
+//
+// Parse a run of decimal digits into a 64-bit magnitude, setting overflow
+// when it does not fit.  Leading zeros do not count towards the nineteen
+// digits that always fit.
+//
+inline const char * parse_digits(const char * p, const char * last,
+                                 std::uint64_t& out, bool& overflow) noexcept {
+  while (p != last and *p == '0') ++p;
+  std::uint64_t acc = 0;
+  unsigned digits = 0;
+#if defined OPAQUE_PARSE_SWAR
+  static const std::uint64_t scales[] = { 1, 10, 100, 1000, 10000, 100000,
+                                          1000000, 10000000, 100000000 };
+  while (last - p >= 8 and digits <= 11) {
+    std::uint64_t chunk;
+    const unsigned n = parse_eight(p, chunk);
+    acc = acc * scales[n] + chunk;
+    digits += n;
+    p += n;
+    if (n != 8) break;
+  }
+#endif
+  for (; p != last and is_digit(*p); ++p) {
+    const unsigned d = static_cast<unsigned>(*p - '0');
+    if (digits < 19) {
+      acc = acc * 10 + d;
+    } else if (digits == 19 and
+               acc <= (std::numeric_limits<std::uint64_t>::max() - d) / 10) {
+      acc = acc * 10 + d;
+    } else {
+      overflow = true;
+    }
+    ++digits;
+  }
+  out = acc;
+  return p;
+}
+
+template <typename T>
+from_chars_result parse_integer(const char * first, const char * last,
+                                T& value) noexcept {
+  const char * p = first;
+  const bool negative = std::is_signed<T>::value and p != last and *p == '-';
+  if (negative) ++p;
+  if (p == last or not is_digit(*p)) {
+    return { first, std::errc::invalid_argument };
+  }
+  std::uint64_t m;
+  bool overflow = false;
+  p = parse_digits(p, last, m, overflow);
+  const std::uint64_t max =
+    static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+  if (overflow or m > max + (negative ? 1 : 0)) {
+    return { p, std::errc::result_out_of_range };
+  }
+  // Negate without overflow at the minimum value
+  value = negative ? (m ? static_cast<T>(-static_cast<T>(m - 1) - 1) : T(0))
+                   : static_cast<T>(m);
+  return { p, std::errc() };
+}
+
+inline from_chars_result parse_bool(const char * first, const char * last,
+                                    bool& value) noexcept {
+  const std::size_t n = static_cast<std::size_t>(last - first);
+  if (n >= 4 and std::memcmp(first, "true", 4) == 0) {
+    value = true;
+    return { first + 4, std::errc() };
+  }
+  if (n >= 5 and std::memcmp(first, "false", 5) == 0) {
+    value = false;
+    return { first + 5, std::errc() };
+  }
+  return { first, std::errc::invalid_argument };
+}
+
+#if defined __cpp_lib_to_chars
+
+template <typename T>
+from_chars_result parse_float(const char * first, const char * last,
+                              T& value) noexcept {
+  const std::from_chars_result r = std::from_chars(first, last, value);
+  return { r.ptr, r.ec };
+}
+
+#else
+
+inline void parse_strto(const char * s, char ** end, float& v) {
+  v = std::strtof(s, end);
+}
+inline void parse_strto(const char * s, char ** end, double& v) {
+  v = std::strtod(s, end);
+}
+inline void parse_strto(const char * s, char ** end, long double& v) {
+  v = std::strtold(s, end);
+}
+
+// Without std::from_chars for floating point, copy the characters that
+// std::from_chars would consider into a terminated buffer for strtod.
+// Leading whitespace, a plus sign and hexadecimal are not accepted.
+template <typename T>
+from_chars_result parse_float(const char * first, const char * last,
+                              T& value) {
+  char buffer[512];
+  std::size_t n = 0;
+  const char * p = first;
+  if (p != last and *p == '-') buffer[n++] = *p++;
+  const bool numeric = p != last and (is_digit(*p) or *p == '.');
+  for (; p != last and n + 1 < sizeof buffer; ++p) {
+    const char c = *p;
+    const bool keep = numeric
+      ? is_digit(c) or c == '.' or c == 'e' or c == 'E' or
+        ((c == '+' or c == '-') and (p[-1] == 'e' or p[-1] == 'E'))
+      : std::isalnum(static_cast<unsigned char>(c)) or c == '(' or
+        c == ')' or c == '_';
+    if (not keep) break;
+    buffer[n++] = c;
+  }
+  if (n == 0 or (buffer[0] == '-' and (n == 1 or buffer[1] == '+' or
+                                       buffer[1] == '-'))) {
+    return { first, std::errc::invalid_argument };
+  }
+  buffer[n] = '\0';
+  char * end;
+  T v;
+  const int saved = errno;
+  errno = 0;
+  parse_strto(buffer, &end, v);
+  // ERANGE is also set for subnormal results, which are representable
+  const int kind = std::fpclassify(v);
+  const bool range = errno == ERANGE and
+                     (kind == FP_ZERO or kind == FP_INFINITE);
+  errno = saved;
+  if (end == buffer) return { first, std::errc::invalid_argument };
+  const char * past = first + (end - buffer);
+  if (range) return { past, std::errc::result_out_of_range };
+  value = v;
+  return { past, std::errc() };
+}
+
+//
+// Most decimals that are read have few digits and no exponent.  When the
+// digits make an integer w of at most 2^53 and there are at most 22 of
+// them after the point, w and the power of ten are exact doubles, and one
+// division rounds as reading the decimal would.  This is Clinger's fast
+// path; other input returns false.
+//
+inline bool parse_decimal(const char * first, const char * last,
+                          double& value, const char *& end) noexcept {
+  static const double scales[] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7,
+                                   1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+                                   1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21,
+                                   1e22 };
+  const char * p = first;
+  const bool negative = p != last and *p == '-';
+  if (negative) ++p;
+  std::uint64_t w = 0;
+  unsigned digits = 0, places = 0;
+  bool any = false, point = false;
+  for (; p != last; ++p) {
+    if (*p == '.' and not point) {
+      point = true;
+      continue;
+    }
+    if (not is_digit(*p)) break;
+    any = true;
+    if (w or *p != '0') {
+      if (++digits > 19) return false;
+      w = w * 10 + static_cast<unsigned>(*p - '0');
+    }
+    if (point and ++places > 22) return false;
+  }
+  if (not any or (p != last and (*p == 'e' or *p == 'E')) or
+      w > (std::uint64_t(1) << 53)) {
+    return false;
+  }
+  const double v = static_cast<double>(w) / scales[places];
+  value = negative ? -v : v;
+  end = p;
+  return true;
+}
+
+inline from_chars_result parse_float(const char * first, const char * last,
+                                     double& value) {
+  const char * end;
+  if (parse_decimal(first, last, value, end)) return { end, std::errc() };
+  return parse_float<double>(first, last, value);
+}
+
+#endif
+
+template <typename T>
+typename std::enable_if<std::is_same<T,bool>::value, from_chars_result>::type
+parse_value(const char * first, const char * last, T& value) {
+  return parse_bool(first, last, value);
+}
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value and
+                        not std::is_same<T,bool>::value,
+                        from_chars_result>::type
+parse_value(const char * first, const char * last, T& value) {
+  return parse_integer(first, last, value);
+}
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value,
+                        from_chars_result>::type
+parse_value(const char * first, const char * last, T& value) {
+  return parse_float(first, last, value);
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Read the value of a numeric opaque type from characters
+///
+/// This accepts what to_chars writes and follows std::from_chars: an
+/// optional minus sign for signed and floating point types, decimal
+/// digits, and for floating point an exponent, inf or nan.  bool is read
+/// as true or false.  Leading whitespace and plus signs are not accepted.
+/// Long runs of integer digits are read eight at a time where the target
+/// is little-endian.
+///
+template <typename O>
+auto from_chars(const char * first, const char * last, O& o)
+  -> typename std::enable_if<detail::is_arithmetic_opaque<O>::value and
+                             not std::is_const<O>::value,
+                             from_chars_result>::type {
+  return detail::parse_value(first, last, o.value);
+}
+
+///
+/// The result of parse_column
+///
+/// count values were stored, and ptr is where reading stopped: the end of
+/// the input, the first field not read because the output was full, or
+/// the field that failed with the error ec.
+///
+struct parse_column_result {
+  std::size_t count;
+  const char * ptr;
+  std::errc ec;
+};
+
+///
+/// Read delimited values into a span of numeric opaque values
+///
+/// Each field runs up to the next delimiter, and must consist of exactly
+/// one value as read by from_chars; a delimiter at the end of the input
+/// is allowed.  Reading stops at the first field in error, which gives
+/// std::errc::invalid_argument when it is empty or has characters left
+/// over, so nothing is thrown.  A full output is not an error, and the
+/// rest of the input can be read from ptr into another span.
+///
+template <typename O>
+auto parse_column(const char * first, const char * last, char delimiter,
+                  span<O> out)
+  -> typename std::enable_if<detail::is_arithmetic_opaque<O>::value and
+                             not std::is_const<O>::value,
+                             parse_column_result>::type {
+  std::size_t count = 0;
+  const char * p = first;
+  while (p != last and count != out.size()) {
+    const from_chars_result r = from_chars(p, last, out[count]);
+    if (r.ec != std::errc()) return { count, p, r.ec };
+    if (r.ptr != last and *r.ptr != delimiter) {
+      return { count, p, std::errc::invalid_argument };
+    }
+    ++count;
+    p = r.ptr == last ? last : r.ptr + 1;
+  }
+  return { count, p, std::errc() };
+}
+
+/// @}
+
+}
+
+#endif
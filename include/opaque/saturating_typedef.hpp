@@ -0,0 +1,141 @@
+#ifndef OPAQUE_SATURATING_TYPEDEF_HPP
+#define OPAQUE_SATURATING_TYPEDEF_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "numeric_typedef.hpp"
+#include "overflow.hpp"
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup typedefs
+/// @{
+
+///
+/// Saturating numeric opaque typedef
+///
+/// Same as numeric_typedef, except that the arithmetic operations clamp
+/// their result to the limits of the underlying type instead of wrapping
+/// or overflowing.  This suits quantities such as signal samples and
+/// limits, where the nearest representable value is the right answer.
+///
+/// The saturating operations are +, -, *, /, %, their compound
+/// assignments, increment, decrement and negation.  They are branchless:
+/// types narrower than 64 bits are clamped with conditional moves, and 64
+/// bit types select the limit with a mask made from the overflow flag.
+/// Signed division of the minimum by -1 gives the maximum, and the
+/// remainder of that division is zero.  Division by zero remains
+/// undefined, and bitwise operations and shifts are those of
+/// numeric_typedef.
+///
+/// Batch operations over ranges (binop::apply and binop::transform_assign)
+/// use the saturating lane operations.  Addition and subtraction of 8 and
+/// 16 bit lanes are single instructions (padds and psubs), and
+/// multiplication of signed 16 bit lanes is a short fixed sequence that
+/// widens the products and packs them with saturation.  Mixed-type
+/// operations are declared with the binop:: mixins as for numeric_typedef.
+///
+/// Template arguments for saturating_typedef:
+///  -# U : The underlying type holding the value, which must be integral
+///  -# O : The opaque type, your subclass
+///  -# S : The right-hand operand type for shift operations
+///
+template <typename U, typename O, typename S = unsigned>
+struct saturating_typedef : numeric_typedef<U,O,S> {
+private:
+  using base = numeric_typedef<U,O,S>;
+public:
+  using typename base::underlying_type;
+  using typename base::opaque_type;
+  typedef saturate_on_overflow overflow_policy;
+  using base::value;
+
+  static_assert(std::is_integral<U>::value and
+                not std::is_same<U, bool>::value,
+                "saturating_typedef requires an integral type");
+
+  constexpr14 opaque_type& operator*=(const opaque_type& peer) & noexcept {
+    value = detail::saturate_mul(value, peer.value);
+    return downcast(); }
+
+  constexpr14 opaque_type& operator/=(const opaque_type& peer) & noexcept {
+    value = detail::saturate_div(value, peer.value);
+    return downcast(); }
+
+  constexpr14 opaque_type& operator%=(const opaque_type& peer) & noexcept {
+    value = detail::saturate_mod(value, peer.value);
+    return downcast(); }
+
+  constexpr14 opaque_type& operator+=(const opaque_type& peer) & noexcept {
+    value = detail::saturate_add(value, peer.value);
+    return downcast(); }
+
+  constexpr14 opaque_type& operator-=(const opaque_type& peer) & noexcept {
+    value = detail::saturate_sub(value, peer.value);
+    return downcast(); }
+
+
+  constexpr14 opaque_type& operator++() & noexcept {
+    value = detail::saturate_add(value, U(1));
+    return downcast(); }
+
+  constexpr14 opaque_type& operator--() & noexcept {
+    value = detail::saturate_sub(value, U(1));
+    return downcast(); }
+
+  constexpr14 opaque_type operator++(int) & noexcept {
+    opaque_type r(value); operator++(); return r; }
+
+  constexpr14 opaque_type operator--(int) & noexcept {
+    opaque_type r(value); operator--(); return r; }
+
+
+  constexpr14 opaque_type operator-() const & noexcept {
+    return opaque_type(detail::saturate_sub(U(0), value)); }
+
+  constexpr14 opaque_type operator-()       && noexcept {
+    return opaque_type(detail::saturate_sub(U(0), value)); }
+
+
+  using base::base;
+  explicit saturating_typedef() = default;
+  saturating_typedef(const saturating_typedef& ) = default;
+  saturating_typedef(      saturating_typedef&&) = default;
+  saturating_typedef& operator=(const saturating_typedef& ) & = default;
+  saturating_typedef& operator=(      saturating_typedef&&) & = default;
+protected:
+  ~saturating_typedef() = default;
+  using base::downcast;
+};
+
+/// @}
+
+}
+
+#endif
@@ -0,0 +1,385 @@
+#ifndef OPAQUE_SEARCH_HPP
+#define OPAQUE_SEARCH_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include <cstddef>
+#include <cstring>
+#if (defined __GNUC__ || defined __clang__) && \
+    (defined __x86_64__ || defined __i386__)
+#define OPAQUE_SEARCH_DISPATCH
+#include <immintrin.h>
+#endif
+
+namespace opaque {
+namespace search {
+
+/// \addtogroup internal
+/// @{
+
+//
+// Byte string search with kernels selected at run time.  Builds target a
+// baseline instruction set, so the vector kernels are compiled for their
+// own instruction set and chosen once, on first use, by asking the CPU
+// what it supports.  Every kernel returns what the scalar one would.
+//
+
+///
+/// A set of bytes, laid out for the vector kernels
+///
+/// Bit h of lo[l] is set when the byte with high nibble h and low nibble l
+/// is in the set, for h < 8; hi[l] holds the same for h >= 8.  A vector
+/// kernel looks up sixteen or thirty-two bytes at once by shuffling these
+/// tables with the low nibbles of its input.
+///
+struct byte_set {
+  unsigned char lo[16];
+  unsigned char hi[16];
+
+  byte_set(const char * s, std::size_t n) noexcept : lo(), hi() {
+    for (std::size_t i = 0; i != n; ++i) {
+      const unsigned c = static_cast<unsigned char>(s[i]);
+      unsigned char * row = c < 0x80 ? lo : hi;
+      row[c & 0xf] = static_cast<unsigned char>(row[c & 0xf] |
+                                                1u << (c >> 4 & 7));
+    }
+  }
+
+  bool contains(char b) const noexcept {
+    const unsigned c = static_cast<unsigned char>(b);
+    return ((c < 0x80 ? lo : hi)[c & 0xf] >> (c >> 4 & 7) & 1) != 0;
+  }
+};
+
+//
+// Kernels.  scan returns the index of the first byte whose membership in
+// the set equals member, and find the index of the first occurrence of a
+// needle of at least two bytes; both return n when there is none.
+//
+
+using scan_fn = std::size_t (*)(const char * p, std::size_t n,
+                                const byte_set& set, bool member);
+using find_fn = std::size_t (*)(const char * p, std::size_t n,
+                                const char * s, std::size_t m);
+
+inline std::size_t scan_scalar(const char * p, std::size_t n,
+                               const byte_set& set, bool member) noexcept {
+  for (std::size_t i = 0; i != n; ++i) {
+    if (set.contains(p[i]) == member) return i;
+  }
+  return n;
+}
+
+inline std::size_t find_scalar(const char * p, std::size_t n,
+                               const char * s, std::size_t m) noexcept {
+  if (m > n) return n;
+  const char * const last = p + (n - m);
+  for (const char * q = p; q <= last; ++q) {
+    q = static_cast<const char *>(
+        std::memchr(q, s[0], static_cast<std::size_t>(last - q) + 1));
+    if (not q) break;
+    if (std::memcmp(q + 1, s + 1, m - 1) == 0) {
+      return static_cast<std::size_t>(q - p);
+    }
+  }
+  return n;
+}
+
+#if defined OPAQUE_SEARCH_DISPATCH
+
+//
+// Set membership: shuffle the rows of both tables by the low nibbles,
+// keep the row named by the high bit of each byte, and test the bit named
+// by the remaining three bits of its high nibble.  Substring search: find
+// the positions where both the first and the last byte of the needle
+// match, and compare the bytes between them only there.
+//
+
+__attribute__((target("sse4.2")))
+inline std::size_t scan_sse42(const char * p, std::size_t n,
+                              const byte_set& set, bool member) noexcept {
+  const __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lo));
+  const __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.hi));
+  const __m128i bit = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                    1, 2, 4, 8, 16, 32, 64, -128);
+  const __m128i nibble = _mm_set1_epi8(0xf);
+  const unsigned flip = member ? 0xffffu : 0u;
+  std::size_t i = 0;
+  for (; i + 16 <= n; i += 16) {
+    const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const __m128i l = _mm_and_si128(x, nibble);
+    const __m128i h = _mm_and_si128(_mm_srli_epi16(x, 4), nibble);
+    const __m128i row = _mm_blendv_epi8(_mm_shuffle_epi8(lo, l),
+                                        _mm_shuffle_epi8(hi, l), x);
+    const __m128i out = _mm_cmpeq_epi8(
+        _mm_and_si128(row, _mm_shuffle_epi8(bit, h)), _mm_setzero_si128());
+    const unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(out)) ^ flip;
+    if (mask) return i + static_cast<unsigned>(__builtin_ctz(mask));
+  }
+  return i + scan_scalar(p + i, n - i, set, member);
+}
+
+__attribute__((target("avx2")))
+inline std::size_t scan_avx2(const char * p, std::size_t n,
+                             const byte_set& set, bool member) noexcept {
+  const __m256i lo = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.lo)));
+  const __m256i hi = _mm256_broadcastsi128_si256(
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(set.hi)));
+  const __m256i bit = _mm256_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+                                       1, 2, 4, 8, 16, 32, 64, -128,
+                                       1, 2, 4, 8, 16, 32, 64, -128,
+                                       1, 2, 4, 8, 16, 32, 64, -128);
+  const __m256i nibble = _mm256_set1_epi8(0xf);
+  const unsigned flip = member ? ~0u : 0u;
+  std::size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    const __m256i x =
+      _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    const __m256i l = _mm256_and_si256(x, nibble);
+    const __m256i h = _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble);
+    const __m256i row = _mm256_blendv_epi8(_mm256_shuffle_epi8(lo, l),
+                                           _mm256_shuffle_epi8(hi, l), x);
+    const __m256i out = _mm256_cmpeq_epi8(
+        _mm256_and_si256(row, _mm256_shuffle_epi8(bit, h)),
+        _mm256_setzero_si256());
+    const unsigned mask =
+      static_cast<unsigned>(_mm256_movemask_epi8(out)) ^ flip;
+    if (mask) return i + static_cast<unsigned>(__builtin_ctz(mask));
+  }
+  return i + scan_sse42(p + i, n - i, set, member);
+}
+
+__attribute__((target("sse4.2")))
+inline std::size_t find_sse42(const char * p, std::size_t n,
+                              const char * s, std::size_t m) noexcept {
+  if (m > n) return n;
+  const __m128i first = _mm_set1_epi8(s[0]);
+  const __m128i last = _mm_set1_epi8(s[m - 1]);
+  std::size_t i = 0;
+  for (; i + m - 1 + 16 <= n; i += 16) {
+    const __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    const __m128i b =
+      _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i + m - 1));
+    unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+        _mm_and_si128(_mm_cmpeq_epi8(f, first), _mm_cmpeq_epi8(b, last))));
+    for (; mask; mask &= mask - 1) {
+      const std::size_t at = i + static_cast<unsigned>(__builtin_ctz(mask));
+      if (std::memcmp(p + at + 1, s + 1, m - 2) == 0) return at;
+    }
+  }
+  const std::size_t r = find_scalar(p + i, n - i, s, m);
+  return r == n - i ? n : i + r;
+}
+
+__attribute__((target("avx2")))
+inline unsigned find_avx2_mask(const char * p, std::size_t m,
+                               __m256i first, __m256i last) noexcept {
+  const __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+  const __m256i b =
+    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + m - 1));
+  return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_and_si256(
+      _mm256_cmpeq_epi8(f, first), _mm256_cmpeq_epi8(b, last))));
+}
+
+__attribute__((target("avx2")))
+inline std::size_t find_avx2(const char * p, std::size_t n,
+                             const char * s, std::size_t m) noexcept {
+  if (m > n) return n;
+  const __m256i first = _mm256_set1_epi8(s[0]);
+  const __m256i last = _mm256_set1_epi8(s[m - 1]);
+  std::size_t i = 0;
+  for (; i + m - 1 + 128 <= n; i += 128) {
+    // Candidates are rare in most text, so test four registers at once
+    const __m256i * q = reinterpret_cast<const __m256i*>(p + i);
+    const __m256i * r = reinterpret_cast<const __m256i*>(p + i + m - 1);
+    const __m256i any = _mm256_or_si256(
+        _mm256_or_si256(
+          _mm256_and_si256(_mm256_cmpeq_epi8(_mm256_loadu_si256(q), first),
+                           _mm256_cmpeq_epi8(_mm256_loadu_si256(r), last)),
+          _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(q + 1), first),
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(r + 1), last))),
+        _mm256_or_si256(
+          _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(q + 2), first),
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(r + 2), last)),
+          _mm256_and_si256(
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(q + 3), first),
+            _mm256_cmpeq_epi8(_mm256_loadu_si256(r + 3), last))));
+    if (_mm256_testz_si256(any, any)) continue;
+    for (std::size_t j = i; j != i + 128; j += 32) {
+      unsigned mask = find_avx2_mask(p + j, m, first, last);
+      for (; mask; mask &= mask - 1) {
+        const std::size_t at = j + static_cast<unsigned>(__builtin_ctz(mask));
+        if (std::memcmp(p + at + 1, s + 1, m - 2) == 0) return at;
+      }
+    }
+  }
+  for (; i + m - 1 + 32 <= n; i += 32) {
+    unsigned mask = find_avx2_mask(p + i, m, first, last);
+    for (; mask; mask &= mask - 1) {
+      const std::size_t at = i + static_cast<unsigned>(__builtin_ctz(mask));
+      if (std::memcmp(p + at + 1, s + 1, m - 2) == 0) return at;
+    }
+  }
+  const std::size_t r = find_sse42(p + i, n - i, s, m);
+  return r == n - i ? n : i + r;
+}
+
+#endif
+
+///
+/// Run a substring kernel only where the first byte of the needle occurs
+///
+/// memchr skips stretches without the first byte faster than comparing
+/// two bytes per position can; where that byte is common it stops early,
+/// and the kernel takes over for a block.
+///
+template <find_fn F>
+std::size_t find_skipping(const char * p, std::size_t n,
+                          const char * s, std::size_t m) noexcept {
+  constexpr std::size_t block = 4096;
+  std::size_t i = 0;
+  while (m <= n - i) {
+    const void * q = std::memchr(p + i, s[0], n - i - m + 1);
+    if (not q) break;
+    i = static_cast<std::size_t>(static_cast<const char *>(q) - p);
+    const std::size_t len = n - i < block + m - 1 ? n - i : block + m - 1;
+    const std::size_t r = F(p + i, len, s, m);
+    if (r != len) return i + r;
+    i += len - m + 1;
+  }
+  return n;
+}
+
+///
+/// Instruction sets with kernels, in increasing order of preference
+///
+enum class isa_level { scalar, sse42, avx2 };
+
+struct kernels {
+  scan_fn scan;
+  find_fn find;
+};
+
+///
+/// The kernels for an instruction set level
+///
+/// The caller must make sure the CPU supports the level.
+///
+inline kernels kernels_for(isa_level level) noexcept {
+  switch (level) {
+#if defined OPAQUE_SEARCH_DISPATCH
+    case isa_level::avx2:
+      return { scan_avx2, find_skipping<find_avx2> };
+    case isa_level::sse42:
+      return { scan_sse42, find_skipping<find_sse42> };
+#else
+    case isa_level::avx2:
+    case isa_level::sse42:
+#endif
+    case isa_level::scalar: return { scan_scalar, find_scalar };
+    default:                return { scan_scalar, find_scalar };
+  }
+}
+
+///
+/// The best instruction set level supported by this CPU
+///
+inline isa_level supported_level() noexcept {
+#if defined OPAQUE_SEARCH_DISPATCH
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) return isa_level::avx2;
+  if (__builtin_cpu_supports("sse4.2")) return isa_level::sse42;
+#endif
+  return isa_level::scalar;
+}
+
+///
+/// The kernels in use, selected on first use
+///
+inline const kernels& selected() noexcept {
+  static const kernels k = kernels_for(supported_level());
+  return k;
+}
+
+//
+// Searches with the semantics of the basic_string members of the same
+// names, over the n bytes at p.  Inputs too short to fill a vector
+// register stay with the scalar kernels.
+//
+
+constexpr std::size_t npos = static_cast<std::size_t>(-1);
+constexpr std::size_t dispatch_threshold = 16;
+
+inline std::size_t find(const char * p, std::size_t n,
+                        const char * s, std::size_t pos,
+                        std::size_t m) noexcept {
+  if (pos > n or m > n - pos) return npos;
+  if (m == 0) return pos;
+  if (m == 1) {
+    const void * q = std::memchr(p + pos, s[0], n - pos);
+    return q ? static_cast<std::size_t>(static_cast<const char *>(q) - p)
+             : npos;
+  }
+  const find_fn f =
+    n - pos < dispatch_threshold ? find_scalar : selected().find;
+  const std::size_t r = f(p + pos, n - pos, s, m);
+  return r == n - pos ? npos : pos + r;
+}
+
+inline std::size_t scan(const char * p, std::size_t n, std::size_t pos,
+                        const byte_set& set, bool member) noexcept {
+  const scan_fn f =
+    n - pos < dispatch_threshold ? scan_scalar : selected().scan;
+  const std::size_t r = f(p + pos, n - pos, set, member);
+  return r == n - pos ? npos : pos + r;
+}
+
+inline std::size_t find_first_of(const char * p, std::size_t n,
+                                 const char * s, std::size_t pos,
+                                 std::size_t m) noexcept {
+  if (pos >= n or m == 0) return npos;
+  if (m == 1) return find(p, n, s, pos, 1);
+  return scan(p, n, pos, byte_set(s, m), true);
+}
+
+inline std::size_t find_first_not_of(const char * p, std::size_t n,
+                                     const char * s, std::size_t pos,
+                                     std::size_t m) noexcept {
+  if (pos >= n) return npos;
+  return scan(p, n, pos, byte_set(s, m), false);
+}
+
+/// @}
+
+}
+}
+
+#endif
@@ -0,0 +1,185 @@
+#ifndef OPAQUE_SHARDED_COUNTER_HPP
+#define OPAQUE_SHARDED_COUNTER_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "atomic_typedef.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <memory>
+#include <thread>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+// Shards are padded to this size so that no two share a cache line
+constexpr std::size_t shard_size = 64;
+
+// A number for the calling thread, assigned round-robin on first use, so
+// that up to n threads get distinct shards of a counter with n shards.
+// Zero means unassigned, which keeps the thread_local constant-initialized
+// and free of a guard.
+inline std::size_t thread_shard() noexcept {
+  static std::atomic<std::size_t> next(1);
+  static thread_local std::size_t shard = 0;
+  if (shard == 0) shard = next.fetch_add(1, std::memory_order_relaxed);
+  return shard;
+}
+
+// The smallest power of two not less than n
+inline std::size_t ceil_pow2(std::size_t n) noexcept {
+  std::size_t p = 1;
+  while (p < n) p <<= 1;
+  return p;
+}
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// A counter of an opaque type for many concurrent writers
+///
+/// The count is split across shards, each on its own cache line, and
+/// each thread adds to its own shard so that threads do not contend.
+/// add and sub are wait-free: each is a single relaxed atomic instruction.
+/// load sums the shards, so it is the expensive operation and is meant to
+/// be occasional.  It is not a snapshot: adds that happen concurrently
+/// with it may or may not be counted.
+///
+/// The opaque type must have native arithmetic on an integral underlying
+/// type (see is_native_arithmetic).  add and sub exist only for operands
+/// that the opaque type accepts in += and -=, so a position_typedef
+/// counter takes its Distance type.  Arithmetic wraps as for
+/// std::atomic.
+///
+template <typename O>
+class sharded_counter {
+public:
+  typedef O value_type;
+  typedef typename O::underlying_type underlying_type;
+
+  static_assert(std::is_integral<underlying_type>::value and
+                not std::is_same<underlying_type, bool>::value and
+                is_native_arithmetic<O>::value,
+                "sharded_counter requires native integral arithmetic");
+  static_assert(detail::atomic_lock_free<underlying_type>::value,
+                "Atomics of the underlying type must be lock-free");
+
+  /// The default number of shards: the hardware concurrency, rounded up
+  /// to a power of two
+  static std::size_t default_shards() noexcept {
+    return detail::ceil_pow2(std::thread::hardware_concurrency());
+  }
+
+  /// Construct a counter with an initial value, and a number of shards
+  /// that is rounded up to a power of two
+  explicit sharded_counter(const O& initial = O(),
+                           std::size_t shards = default_shards())
+    : mask(detail::ceil_pow2(shards) - 1)
+    , storage(new char[(mask + 1) * sizeof(padded) + alignof(padded) - 1])
+    , shard(align(storage.get()))
+    , base(static_cast<count_type>(initial.value)) {
+    for (std::size_t i = 0; i <= mask; ++i) {
+      ::new (static_cast<void*>(shard + i)) padded();
+      shard[i].value.store(0, std::memory_order_relaxed);
+    }
+  }
+  sharded_counter(const sharded_counter&) = delete;
+  sharded_counter& operator=(const sharded_counter&) = delete;
+
+  std::size_t shards() const noexcept { return mask + 1; }
+
+  template <typename D, typename = detail::add_assign_t<O,D>,
+            typename = typename std::enable_if<
+              detail::atomic_native<O,D>::value>::type>
+  void add(const D& d) noexcept {
+    local().fetch_add(static_cast<count_type>(d.value),
+                      std::memory_order_relaxed);
+  }
+  template <typename D, typename = detail::sub_assign_t<O,D>,
+            typename = typename std::enable_if<
+              detail::atomic_native<O,D>::value>::type>
+  void sub(const D& d) noexcept {
+    local().fetch_sub(static_cast<count_type>(d.value),
+                      std::memory_order_relaxed);
+  }
+
+  /// The initial value with every shard added
+  O load() const noexcept {
+    count_type sum = base;
+    for (std::size_t i = 0; i <= mask; ++i) {
+      sum = static_cast<count_type>(
+          sum + shard[i].value.load(std::memory_order_relaxed));
+    }
+    return O(static_cast<underlying_type>(sum));
+  }
+
+private:
+  // Shards count in the unsigned type so that the sum wraps
+  typedef typename std::make_unsigned<underlying_type>::type count_type;
+
+  struct alignas(detail::shard_size) padded {
+    std::atomic<count_type> value;
+  };
+  static_assert(std::is_trivially_destructible<padded>::value,
+                "Shards are never destroyed");
+
+  // new ignores over-alignment before C++17, so the shards are placed at
+  // the first cache line boundary of storage
+  static padded* align(char* p) noexcept {
+    const std::uintptr_t a = reinterpret_cast<std::uintptr_t>(p);
+    const std::uintptr_t m = alignof(padded) - 1;
+    return reinterpret_cast<padded*>((a + m) & ~m);
+  }
+
+  std::size_t mask;
+  std::unique_ptr<char[]> storage;
+  padded* shard;
+  count_type base;
+
+  std::atomic<count_type>& local() noexcept {
+    return shard[detail::thread_shard() & mask].value;
+  }
+};
+
+/// @}
+
+}
+
+#endif
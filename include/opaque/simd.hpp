@@ -0,0 +1,586 @@
+#ifndef OPAQUE_SIMD_HPP
+#define OPAQUE_SIMD_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "constexpr14.hpp"
+#include "overflow.hpp"
+#include "type_traits.hpp"
+#include <cstddef>
+#include <type_traits>
+#if defined __AVX2__
+#include <immintrin.h>
+#elif defined __SSE4_1__
+#include <smmintrin.h>
+#elif defined __SSE2__
+#include <emmintrin.h>
+#endif
+
+namespace opaque {
+namespace simd {
+
+/// \addtogroup internal
+/// @{
+
+///
+/// Alignment of N lanes of U: the largest power of two dividing their size,
+/// up to the width of the widest vector register
+///
+template <typename U, std::size_t N>
+constexpr std::size_t lanes_alignment(std::size_t a = 32) noexcept {
+  return a <= alignof(U) ? alignof(U) :
+    (sizeof(U) * N) % a == 0 ? a : lanes_alignment<U,N>(a / 2);
+}
+
+///
+/// Storage for N lanes of U
+///
+template <typename U, std::size_t N>
+struct alignas(lanes_alignment<U,N>()) lanes {
+  static_assert(N > 0, "At least one lane is required");
+  U lane[N];
+  constexpr std::size_t size() const noexcept { return N; }
+  constexpr14 U& operator[](std::size_t i) noexcept { return lane[i]; }
+  constexpr const U& operator[](std::size_t i) const noexcept {
+    return lane[i]; }
+  constexpr14 U* begin() noexcept { return lane; }
+  constexpr14 U* end() noexcept { return lane + N; }
+  constexpr const U* begin() const noexcept { return lane; }
+  constexpr const U* end() const noexcept { return lane + N; }
+};
+
+//
+// Lane-wise operations.  Each has a scalar form, which is the portable
+// fallback, and the vector kernels below provide vector forms where the
+// instruction set has them.
+//
+
+struct add_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l += r; }
+};
+struct sub_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l -= r; }
+};
+struct mul_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l *= r; }
+};
+struct div_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l /= r; }
+};
+struct mod_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l %= r; }
+};
+struct and_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l &= r; }
+};
+struct or_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l |= r; }
+};
+struct xor_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l ^= r; }
+};
+struct shl_t {
+  template <typename T, typename S>
+  static void scalar(T& l, const S& r) noexcept { l <<= r; }
+};
+struct shr_t {
+  template <typename T, typename S>
+  static void scalar(T& l, const S& r) noexcept { l >>= r; }
+};
+
+//
+// Saturating lane-wise operations on integral lanes, which clamp to the
+// limits of the lane type instead of wrapping.  Their scalar forms are
+// branchless.
+//
+
+struct adds_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l = opaque::detail::saturate_add(l, r); }
+};
+struct subs_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l = opaque::detail::saturate_sub(l, r); }
+};
+struct muls_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l = opaque::detail::saturate_mul(l, r); }
+};
+struct divs_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l = opaque::detail::saturate_div(l, r); }
+};
+struct mods_t {
+  template <typename T> static void scalar(T& l, const T& r) noexcept {
+    l = opaque::detail::saturate_mod(l, r); }
+};
+
+//
+// Vector kernels.  isa<U,W> describes a register of W bytes holding lanes
+// of U, providing load, store and an op() overload for each operation that
+// has a vector form.  The primary template has none.
+//
+
+template <typename U, std::size_t W, typename = void>
+struct isa { };
+
+#if defined __SSE2__
+
+template <typename U>
+using if_integer_t = typename std::enable_if<
+  std::is_integral<U>::value and not std::is_same<U,bool>::value>::type;
+
+template <std::size_t size, bool is_signed> struct epi128;
+
+template <bool is_signed> struct epi128<1,is_signed> {
+  static __m128i add(__m128i a, __m128i b) noexcept {
+    return _mm_add_epi8(a, b); }
+  static __m128i sub(__m128i a, __m128i b) noexcept {
+    return _mm_sub_epi8(a, b); }
+  static __m128i adds(__m128i a, __m128i b) noexcept {
+    return is_signed ? _mm_adds_epi8(a, b) : _mm_adds_epu8(a, b); }
+  static __m128i subs(__m128i a, __m128i b) noexcept {
+    return is_signed ? _mm_subs_epi8(a, b) : _mm_subs_epu8(a, b); }
+};
+template <bool is_signed> struct epi128<2,is_signed> {
+  static __m128i add(__m128i a, __m128i b) noexcept {
+    return _mm_add_epi16(a, b); }
+  static __m128i sub(__m128i a, __m128i b) noexcept {
+    return _mm_sub_epi16(a, b); }
+  static __m128i mul(__m128i a, __m128i b) noexcept {
+    return _mm_mullo_epi16(a, b); }
+  static __m128i adds(__m128i a, __m128i b) noexcept {
+    return is_signed ? _mm_adds_epi16(a, b) : _mm_adds_epu16(a, b); }
+  static __m128i subs(__m128i a, __m128i b) noexcept {
+    return is_signed ? _mm_subs_epi16(a, b) : _mm_subs_epu16(a, b); }
+  // The full signed products, packed back with signed saturation
+  template <bool S = is_signed, typename = typename std::enable_if<S>::type>
+  static __m128i muls(__m128i a, __m128i b) noexcept {
+    const __m128i lo = _mm_mullo_epi16(a, b);
+    const __m128i hi = _mm_mulhi_epi16(a, b);
+    return _mm_packs_epi32(_mm_unpacklo_epi16(lo, hi),
+                           _mm_unpackhi_epi16(lo, hi)); }
+  static __m128i shl(__m128i a, __m128i c) noexcept {
+    return _mm_sll_epi16(a, c); }
+  static __m128i shr(__m128i a, __m128i c) noexcept {
+    return is_signed ? _mm_sra_epi16(a, c) : _mm_srl_epi16(a, c); }
+};
+template <bool is_signed> struct epi128<4,is_signed> {
+  static __m128i add(__m128i a, __m128i b) noexcept {
+    return _mm_add_epi32(a, b); }
+  static __m128i sub(__m128i a, __m128i b) noexcept {
+    return _mm_sub_epi32(a, b); }
+#if defined __SSE4_1__
+  static __m128i mul(__m128i a, __m128i b) noexcept {
+    return _mm_mullo_epi32(a, b); }
+#endif
+  static __m128i shl(__m128i a, __m128i c) noexcept {
+    return _mm_sll_epi32(a, c); }
+  static __m128i shr(__m128i a, __m128i c) noexcept {
+    return is_signed ? _mm_sra_epi32(a, c) : _mm_srl_epi32(a, c); }
+};
+template <> struct epi128<8,false> {
+  static __m128i add(__m128i a, __m128i b) noexcept {
+    return _mm_add_epi64(a, b); }
+  static __m128i sub(__m128i a, __m128i b) noexcept {
+    return _mm_sub_epi64(a, b); }
+  static __m128i shl(__m128i a, __m128i c) noexcept {
+    return _mm_sll_epi64(a, c); }
+  static __m128i shr(__m128i a, __m128i c) noexcept {
+    return _mm_srl_epi64(a, c); }
+};
+template <> struct epi128<8,true> { // No arithmetic right shift
+  static __m128i add(__m128i a, __m128i b) noexcept {
+    return _mm_add_epi64(a, b); }
+  static __m128i sub(__m128i a, __m128i b) noexcept {
+    return _mm_sub_epi64(a, b); }
+  static __m128i shl(__m128i a, __m128i c) noexcept {
+    return _mm_sll_epi64(a, c); }
+};
+
+template <typename U>
+struct isa<U, 16, if_integer_t<U>> {
+  using reg = __m128i;
+  using epi = epi128<sizeof(U), std::is_signed<U>::value>;
+  static reg load(const U * p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const reg*>(p)); }
+  static void store(U * p, reg r) noexcept {
+    _mm_storeu_si128(reinterpret_cast<reg*>(p), r); }
+  static reg count(unsigned c) noexcept {
+    return _mm_cvtsi32_si128(static_cast<int>(c)); }
+  template <typename E=epi> static auto op(add_t, reg a, reg b) noexcept
+    -> decltype(E::add(a, b)) { return E::add(a, b); }
+  template <typename E=epi> static auto op(sub_t, reg a, reg b) noexcept
+    -> decltype(E::sub(a, b)) { return E::sub(a, b); }
+  template <typename E=epi> static auto op(mul_t, reg a, reg b) noexcept
+    -> decltype(E::mul(a, b)) { return E::mul(a, b); }
+  template <typename E=epi> static auto op(adds_t, reg a, reg b) noexcept
+    -> decltype(E::adds(a, b)) { return E::adds(a, b); }
+  template <typename E=epi> static auto op(subs_t, reg a, reg b) noexcept
+    -> decltype(E::subs(a, b)) { return E::subs(a, b); }
+  template <typename E=epi> static auto op(muls_t, reg a, reg b) noexcept
+    -> decltype(E::muls(a, b)) { return E::muls(a, b); }
+  template <typename E=epi> static auto op(shl_t, reg a, reg c) noexcept
+    -> decltype(E::shl(a, c)) { return E::shl(a, c); }
+  template <typename E=epi> static auto op(shr_t, reg a, reg c) noexcept
+    -> decltype(E::shr(a, c)) { return E::shr(a, c); }
+  static reg op(and_t, reg a, reg b) noexcept { return _mm_and_si128(a, b); }
+  static reg op( or_t, reg a, reg b) noexcept { return _mm_or_si128 (a, b); }
+  static reg op(xor_t, reg a, reg b) noexcept { return _mm_xor_si128(a, b); }
+};
+
+template <>
+struct isa<float, 16> {
+  using reg = __m128;
+  static reg load(const float * p) noexcept { return _mm_loadu_ps(p); }
+  static void store(float * p, reg r) noexcept { _mm_storeu_ps(p, r); }
+  static reg op(add_t, reg a, reg b) noexcept { return _mm_add_ps(a, b); }
+  static reg op(sub_t, reg a, reg b) noexcept { return _mm_sub_ps(a, b); }
+  static reg op(mul_t, reg a, reg b) noexcept { return _mm_mul_ps(a, b); }
+  static reg op(div_t, reg a, reg b) noexcept { return _mm_div_ps(a, b); }
+};
+
+template <>
+struct isa<double, 16> {
+  using reg = __m128d;
+  static reg load(const double * p) noexcept { return _mm_loadu_pd(p); }
+  static void store(double * p, reg r) noexcept { _mm_storeu_pd(p, r); }
+  static reg op(add_t, reg a, reg b) noexcept { return _mm_add_pd(a, b); }
+  static reg op(sub_t, reg a, reg b) noexcept { return _mm_sub_pd(a, b); }
+  static reg op(mul_t, reg a, reg b) noexcept { return _mm_mul_pd(a, b); }
+  static reg op(div_t, reg a, reg b) noexcept { return _mm_div_pd(a, b); }
+};
+
+#endif
+
+#if defined __AVX2__
+
+template <std::size_t size, bool is_signed> struct epi256;
+
+template <bool is_signed> struct epi256<1,is_signed> {
+  static __m256i add(__m256i a, __m256i b) noexcept {
+    return _mm256_add_epi8(a, b); }
+  static __m256i sub(__m256i a, __m256i b) noexcept {
+    return _mm256_sub_epi8(a, b); }
+  static __m256i adds(__m256i a, __m256i b) noexcept {
+    return is_signed ? _mm256_adds_epi8(a, b) : _mm256_adds_epu8(a, b); }
+  static __m256i subs(__m256i a, __m256i b) noexcept {
+    return is_signed ? _mm256_subs_epi8(a, b) : _mm256_subs_epu8(a, b); }
+};
+template <bool is_signed> struct epi256<2,is_signed> {
+  static __m256i add(__m256i a, __m256i b) noexcept {
+    return _mm256_add_epi16(a, b); }
+  static __m256i sub(__m256i a, __m256i b) noexcept {
+    return _mm256_sub_epi16(a, b); }
+  static __m256i mul(__m256i a, __m256i b) noexcept {
+    return _mm256_mullo_epi16(a, b); }
+  static __m256i adds(__m256i a, __m256i b) noexcept {
+    return is_signed ? _mm256_adds_epi16(a, b) : _mm256_adds_epu16(a, b); }
+  static __m256i subs(__m256i a, __m256i b) noexcept {
+    return is_signed ? _mm256_subs_epi16(a, b) : _mm256_subs_epu16(a, b); }
+  // Unpacking and packing both work within 128-bit halves, so the lanes
+  // stay in order
+  template <bool S = is_signed, typename = typename std::enable_if<S>::type>
+  static __m256i muls(__m256i a, __m256i b) noexcept {
+    const __m256i lo = _mm256_mullo_epi16(a, b);
+    const __m256i hi = _mm256_mulhi_epi16(a, b);
+    return _mm256_packs_epi32(_mm256_unpacklo_epi16(lo, hi),
+                              _mm256_unpackhi_epi16(lo, hi)); }
+  static __m256i shl(__m256i a, __m128i c) noexcept {
+    return _mm256_sll_epi16(a, c); }
+  static __m256i shr(__m256i a, __m128i c) noexcept {
+    return is_signed ? _mm256_sra_epi16(a, c) : _mm256_srl_epi16(a, c); }
+};
+template <bool is_signed> struct epi256<4,is_signed> {
+  static __m256i add(__m256i a, __m256i b) noexcept {
+    return _mm256_add_epi32(a, b); }
+  static __m256i sub(__m256i a, __m256i b) noexcept {
+    return _mm256_sub_epi32(a, b); }
+  static __m256i mul(__m256i a, __m256i b) noexcept {
+    return _mm256_mullo_epi32(a, b); }
+  static __m256i shl(__m256i a, __m128i c) noexcept {
+    return _mm256_sll_epi32(a, c); }
+  static __m256i shr(__m256i a, __m128i c) noexcept {
+    return is_signed ? _mm256_sra_epi32(a, c) : _mm256_srl_epi32(a, c); }
+};
+template <> struct epi256<8,false> {
+  static __m256i add(__m256i a, __m256i b) noexcept {
+    return _mm256_add_epi64(a, b); }
+  static __m256i sub(__m256i a, __m256i b) noexcept {
+    return _mm256_sub_epi64(a, b); }
+  static __m256i shl(__m256i a, __m128i c) noexcept {
+    return _mm256_sll_epi64(a, c); }
+  static __m256i shr(__m256i a, __m128i c) noexcept {
+    return _mm256_srl_epi64(a, c); }
+};
+template <> struct epi256<8,true> { // No arithmetic right shift
+  static __m256i add(__m256i a, __m256i b) noexcept {
+    return _mm256_add_epi64(a, b); }
+  static __m256i sub(__m256i a, __m256i b) noexcept {
+    return _mm256_sub_epi64(a, b); }
+  static __m256i shl(__m256i a, __m128i c) noexcept {
+    return _mm256_sll_epi64(a, c); }
+};
+
+template <typename U>
+struct isa<U, 32, if_integer_t<U>> {
+  using reg = __m256i;
+  using epi = epi256<sizeof(U), std::is_signed<U>::value>;
+  static reg load(const U * p) noexcept {
+    return _mm256_loadu_si256(reinterpret_cast<const reg*>(p)); }
+  static void store(U * p, reg r) noexcept {
+    _mm256_storeu_si256(reinterpret_cast<reg*>(p), r); }
+  static __m128i count(unsigned c) noexcept {
+    return _mm_cvtsi32_si128(static_cast<int>(c)); }
+  template <typename E=epi> static auto op(add_t, reg a, reg b) noexcept
+    -> decltype(E::add(a, b)) { return E::add(a, b); }
+  template <typename E=epi> static auto op(sub_t, reg a, reg b) noexcept
+    -> decltype(E::sub(a, b)) { return E::sub(a, b); }
+  template <typename E=epi> static auto op(mul_t, reg a, reg b) noexcept
+    -> decltype(E::mul(a, b)) { return E::mul(a, b); }
+  template <typename E=epi> static auto op(adds_t, reg a, reg b) noexcept
+    -> decltype(E::adds(a, b)) { return E::adds(a, b); }
+  template <typename E=epi> static auto op(subs_t, reg a, reg b) noexcept
+    -> decltype(E::subs(a, b)) { return E::subs(a, b); }
+  template <typename E=epi> static auto op(muls_t, reg a, reg b) noexcept
+    -> decltype(E::muls(a, b)) { return E::muls(a, b); }
+  template <typename E=epi> static auto op(shl_t, reg a, __m128i c) noexcept
+    -> decltype(E::shl(a, c)) { return E::shl(a, c); }
+  template <typename E=epi> static auto op(shr_t, reg a, __m128i c) noexcept
+    -> decltype(E::shr(a, c)) { return E::shr(a, c); }
+  static reg op(and_t, reg a, reg b) noexcept {
+    return _mm256_and_si256(a, b); }
+  static reg op( or_t, reg a, reg b) noexcept {
+    return _mm256_or_si256 (a, b); }
+  static reg op(xor_t, reg a, reg b) noexcept {
+    return _mm256_xor_si256(a, b); }
+};
+
+template <>
+struct isa<float, 32> {
+  using reg = __m256;
+  static reg load(const float * p) noexcept { return _mm256_loadu_ps(p); }
+  static void store(float * p, reg r) noexcept { _mm256_storeu_ps(p, r); }
+  static reg op(add_t, reg a, reg b) noexcept { return _mm256_add_ps(a, b); }
+  static reg op(sub_t, reg a, reg b) noexcept { return _mm256_sub_ps(a, b); }
+  static reg op(mul_t, reg a, reg b) noexcept { return _mm256_mul_ps(a, b); }
+  static reg op(div_t, reg a, reg b) noexcept { return _mm256_div_ps(a, b); }
+};
+
+template <>
+struct isa<double, 32> {
+  using reg = __m256d;
+  static reg load(const double * p) noexcept { return _mm256_loadu_pd(p); }
+  static void store(double * p, reg r) noexcept { _mm256_storeu_pd(p, r); }
+  static reg op(add_t, reg a, reg b) noexcept { return _mm256_add_pd(a, b); }
+  static reg op(sub_t, reg a, reg b) noexcept { return _mm256_sub_pd(a, b); }
+  static reg op(mul_t, reg a, reg b) noexcept { return _mm256_mul_pd(a, b); }
+  static reg op(div_t, reg a, reg b) noexcept { return _mm256_div_pd(a, b); }
+};
+
+#endif
+
+namespace detail {
+
+template <typename ISA, typename OP, typename = void>
+struct has_vector_op : std::false_type { };
+template <typename ISA, typename OP>
+struct has_vector_op<ISA, OP, void_t<decltype(ISA::op(OP{},
+    ISA::load(nullptr), ISA::load(nullptr)), void())>> : std::true_type { };
+
+template <typename ISA, typename OP, typename = void>
+struct has_vector_shift : std::false_type { };
+template <typename ISA, typename OP>
+struct has_vector_shift<ISA, OP, void_t<decltype(ISA::op(OP{},
+    ISA::load(nullptr), ISA::count(0)), void())>> : std::true_type { };
+
+// Apply the operation to whole registers from index i, returning the index
+// of the first lane not processed
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<    has_vector_op<isa<U,W>,OP>::value,
+std::size_t>::type step(U * o, const U * l, const U * r,
+                        std::size_t i, std::size_t n) noexcept {
+  using I = isa<U,W>;
+  constexpr std::size_t width = W / sizeof(U);
+  const std::size_t end = i + (n - i) / width * width;
+  for (; i != end; i += width) {
+    I::store(o + i, I::op(OP{}, I::load(l + i), I::load(r + i)));
+  }
+  return end;
+}
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<not has_vector_op<isa<U,W>,OP>::value,
+std::size_t>::type step(U *, const U *, const U *,
+                        std::size_t i, std::size_t) noexcept {
+  return i;
+}
+
+// Combine whole registers from index i into acc, returning the index of
+// the first lane not processed.  Four accumulators hide operation latency.
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<    has_vector_op<isa<U,W>,OP>::value,
+std::size_t>::type fold(const U * p, std::size_t i, std::size_t n, U& acc)
+noexcept {
+  using I = isa<U,W>;
+  constexpr std::size_t width = W / sizeof(U);
+  constexpr std::size_t block = 4 * width;
+  const std::size_t end = i + (n - i) / block * block;
+  if (i == end) return i;
+  auto a0 = I::load(p + i            );
+  auto a1 = I::load(p + i +     width);
+  auto a2 = I::load(p + i + 2 * width);
+  auto a3 = I::load(p + i + 3 * width);
+  for (i += block; i != end; i += block) {
+    a0 = I::op(OP{}, a0, I::load(p + i            ));
+    a1 = I::op(OP{}, a1, I::load(p + i +     width));
+    a2 = I::op(OP{}, a2, I::load(p + i + 2 * width));
+    a3 = I::op(OP{}, a3, I::load(p + i + 3 * width));
+  }
+  U l[width];
+  I::store(l, I::op(OP{}, I::op(OP{}, a0, a1), I::op(OP{}, a2, a3)));
+  for (std::size_t j = 0; j != width; ++j) OP::scalar(acc, l[j]);
+  return end;
+}
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<not has_vector_op<isa<U,W>,OP>::value,
+std::size_t>::type fold(const U *, std::size_t i, std::size_t, U&) noexcept {
+  return i;
+}
+
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<    has_vector_shift<isa<U,W>,OP>::value,
+std::size_t>::type step_shift(U * l, unsigned c, std::size_t i, std::size_t n)
+noexcept {
+  using I = isa<U,W>;
+  constexpr std::size_t width = W / sizeof(U);
+  const auto count = I::count(c);
+  const std::size_t end = i + (n - i) / width * width;
+  for (; i != end; i += width) {
+    I::store(l + i, I::op(OP{}, I::load(l + i), count));
+  }
+  return end;
+}
+template <std::size_t W, typename OP, typename U>
+typename std::enable_if<not has_vector_shift<isa<U,W>,OP>::value,
+std::size_t>::type step_shift(U *, unsigned, std::size_t i, std::size_t)
+noexcept {
+  return i;
+}
+
+}
+
+///
+/// Determine whether an operation on lanes of U has a vector kernel
+///
+template <typename OP, typename U>
+struct is_vectorized : std::integral_constant<bool,
+  detail::has_vector_op<isa<U,16>,OP>::value or
+  detail::has_vector_op<isa<U,32>,OP>::value> { };
+
+///
+/// Apply an operation lane-wise: l[i] op= r[i] for i in [0, n)
+///
+/// The widest available vector kernel processes as many lanes as it can,
+/// and the scalar form processes the rest.
+///
+template <typename OP, typename U>
+inline void apply(U * l, const U * r, std::size_t n) noexcept {
+  std::size_t i = 0;
+  i = detail::step<32,OP>(l, l, r, i, n);
+  i = detail::step<16,OP>(l, l, r, i, n);
+  for (; i < n; ++i) OP::scalar(l[i], r[i]);
+}
+
+///
+/// Apply an operation lane-wise: o[i] = l[i] op r[i] for i in [0, n)
+///
+/// The output may be the same array as either input, but must not
+/// otherwise overlap them.
+///
+template <typename OP, typename U>
+inline void apply(U * o, const U * l, const U * r, std::size_t n) noexcept {
+  std::size_t i = 0;
+  i = detail::step<32,OP>(o, l, r, i, n);
+  i = detail::step<16,OP>(o, l, r, i, n);
+  for (; i < n; ++i) {
+    U t = l[i];
+    OP::scalar(t, r[i]);
+    o[i] = t;
+  }
+}
+
+///
+/// Combine lanes with an operation: init op p[0] op ... op p[n-1]
+///
+/// The vector kernels combine lanes in a different order than the scalar
+/// form, so the operation must be associative and commutative for the
+/// result to be exact.  (For floating-point lanes it is not, and the
+/// result may differ in rounding.)
+///
+template <typename OP, typename U>
+inline U reduce(const U * p, std::size_t n, U init) noexcept {
+  std::size_t i = 0;
+  i = detail::fold<32,OP>(p, i, n, init);
+  i = detail::fold<16,OP>(p, i, n, init);
+  for (; i < n; ++i) OP::scalar(init, p[i]);
+  return init;
+}
+
+///
+/// Shift lanes by a common count: l[i] op= c for i in [0, n)
+///
+template <typename OP, typename U, typename S>
+inline typename std::enable_if<    std::is_integral<S>::value>::type
+apply_shift(U * l, const S& c, std::size_t n) noexcept {
+  std::size_t i = 0;
+  const unsigned count = static_cast<unsigned>(c);
+  i = detail::step_shift<32,OP>(l, count, i, n);
+  i = detail::step_shift<16,OP>(l, count, i, n);
+  for (; i < n; ++i) OP::scalar(l[i], c);
+}
+
+template <typename OP, typename U, typename S>
+inline typename std::enable_if<not std::is_integral<S>::value>::type
+apply_shift(U * l, const S& c, std::size_t n) noexcept {
+  for (std::size_t i = 0; i < n; ++i) OP::scalar(l[i], c);
+}
+
+/// @}
+
+}
+}
+
+#endif
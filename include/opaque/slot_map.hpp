@@ -0,0 +1,229 @@
+#ifndef OPAQUE_SLOT_MAP_HPP
+#define OPAQUE_SLOT_MAP_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "span.hpp"
+#include "utility.hpp"
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace opaque {
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Container of values addressed by generational handles
+///
+/// Insertion returns a Handle, normally a subclass of
+/// opaque::experimental::handle_typedef, which stays valid until its
+/// element is erased.  Insertion, erasure and lookup are O(1).
+///
+/// The values are stored densely, in a contiguous array that the iterators
+/// visit, so iteration is as fast as over a std::vector.  Erasure moves the
+/// last value into the hole, so it invalidates pointers to that value and
+/// changes the iteration order, but never invalidates handles.
+///
+/// Each handle refers to a slot, which records where its value is and the
+/// generation of that value.  Erasing a value bumps the generation of its
+/// slot and puts the slot on a free-list for reuse, so that handles to the
+/// erased value no longer match: lookups with them find nothing, rather
+/// than a newer value in the same slot.  Generation zero is never used, so
+/// a value-initialized handle never matches.  A slot whose generation is
+/// exhausted is retired rather than reused.
+///
+template <typename Handle, typename T>
+class slot_map {
+  using handle_index = typename Handle::underlying_type;
+
+  struct slot {
+    handle_index position;    // of the value, or of the next free slot
+    handle_index generation;  // of the current or next value
+  };
+
+  static constexpr handle_index no_slot = ~handle_index(0);
+
+public:
+  typedef Handle handle_type;
+  typedef T value_type;
+  typedef std::size_t size_type;
+  typedef T& reference;
+  typedef const T& const_reference;
+  typedef typename std::vector<T>::iterator iterator;
+  typedef typename std::vector<T>::const_iterator const_iterator;
+
+  slot_map() = default;
+
+  /// Insert a value, returning its handle
+  Handle insert(const T& value) { return emplace(value); }
+  Handle insert(T&& value) { return emplace(opaque::move(value)); }
+
+  /// Construct a value in place, returning its handle
+  template <typename... Args>
+  Handle emplace(Args&&... args) {
+    handle_index s = free_head;
+    if (s == no_slot) {
+      if (slots.size() > Handle::max_index) {
+        throw std::length_error("slot_map::emplace");
+      }
+      slots.reserve(slots.size() + 1);
+      s = static_cast<handle_index>(slots.size());
+    }
+    values.emplace_back(opaque::forward<Args>(args)...);
+    try {
+      owners.push_back(s);
+    } catch (...) {
+      values.pop_back();
+      throw;
+    }
+    if (s == free_head) {
+      free_head = slots[s].position;
+    } else {
+      slots.push_back(slot{ 0, 1 });
+    }
+    slots[s].position = static_cast<handle_index>(values.size() - 1);
+    return Handle::make(s, slots[s].generation);
+  }
+
+  /// Erase the value of a handle, if it is still present
+  bool erase(const Handle& h) {
+    if (not contains(h)) return false;
+    const handle_index s = h.index();
+    const handle_index p = slots[s].position;
+    const handle_index last = static_cast<handle_index>(values.size() - 1);
+    if (p != last) {
+      values[p] = opaque::move(values[last]);
+      owners[p] = owners[last];
+      slots[owners[p]].position = p;
+    }
+    values.pop_back();
+    owners.pop_back();
+    release(s);
+    return true;
+  }
+
+  /// Check whether the value of a handle is present
+  bool contains(const Handle& h) const noexcept {
+    return h.generation() != 0 and h.index() < slots.size() and
+      slots[h.index()].generation == h.generation();
+  }
+
+  /// The value of a handle, or nullptr if it has been erased
+  T * find(const Handle& h) noexcept {
+    return contains(h) ? &values[slots[h.index()].position] : nullptr;
+  }
+  const T * find(const Handle& h) const noexcept {
+    return contains(h) ? &values[slots[h.index()].position] : nullptr;
+  }
+
+  /// The value of a handle, which must be present
+  reference operator[](const Handle& h) noexcept {
+    assert(contains(h));
+    return values[slots[h.index()].position];
+  }
+  const_reference operator[](const Handle& h) const noexcept {
+    assert(contains(h));
+    return values[slots[h.index()].position];
+  }
+  reference at(const Handle& h) {
+    if (not contains(h)) throw std::out_of_range("slot_map::at");
+    return values[slots[h.index()].position];
+  }
+  const_reference at(const Handle& h) const {
+    if (not contains(h)) throw std::out_of_range("slot_map::at");
+    return values[slots[h.index()].position];
+  }
+
+  /// The handle of the value at a position in iteration order
+  Handle handle_at(size_type position) const noexcept {
+    assert(position < size());
+    const handle_index s = owners[position];
+    return Handle::make(s, slots[s].generation);
+  }
+
+  /// Erase all values, invalidating every handle
+  void clear() noexcept {
+    for (handle_index s : owners) release(s);
+    values.clear();
+    owners.clear();
+  }
+
+  void reserve(size_type n) {
+    values.reserve(n);
+    owners.reserve(n);
+    slots.reserve(n);
+  }
+
+  size_type size() const noexcept { return values.size(); }
+  bool empty() const noexcept { return values.empty(); }
+  T * data() noexcept { return values.data(); }
+  const T * data() const noexcept { return values.data(); }
+
+  iterator begin() noexcept { return values.begin(); }
+  iterator end() noexcept { return values.end(); }
+  const_iterator begin() const noexcept { return values.begin(); }
+  const_iterator end() const noexcept { return values.end(); }
+  const_iterator cbegin() const noexcept { return values.cbegin(); }
+  const_iterator cend() const noexcept { return values.cend(); }
+
+  /// View the dense values
+  operator span<T>() noexcept { return span<T>(data(), size()); }
+  operator span<const T>() const noexcept {
+    return span<const T>(data(), size());
+  }
+
+private:
+  void release(handle_index s) noexcept {
+    slot& e = slots[s];
+    if (e.generation == Handle::max_generation) {
+      e.generation = 0;  // retired: matches no handle, never reused
+      return;
+    }
+    ++e.generation;
+    e.position = free_head;
+    free_head = s;
+  }
+
+  std::vector<T> values;
+  std::vector<handle_index> owners;  // slot of each value
+  std::vector<slot> slots;
+  handle_index free_head = no_slot;
+};
+
+template <typename Handle, typename T>
+constexpr typename slot_map<Handle,T>::handle_index slot_map<Handle,T>::no_slot;
+
+/// @}
+
+}
+
+#endif
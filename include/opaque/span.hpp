@@ -0,0 +1,255 @@
+#ifndef OPAQUE_SPAN_HPP
+#define OPAQUE_SPAN_HPP
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "data.hpp"
+#include <cstddef>
+#include <type_traits>
+
+namespace opaque {
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename C>
+using container_element = typename std::remove_pointer<
+  decltype(std::declval<C&>().data())>::type;
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// Determine whether a buffer of U may be viewed as a buffer of O
+///
+/// This holds when O is an opaque typedef over U that adds nothing to the
+/// representation of U: both are standard-layout and trivially copyable,
+/// and they have the same size and alignment.  The value member of a
+/// standard-layout class shares its address with the object, so a U is
+/// then an O in everything but name.
+///
+template <typename O, typename U = typename O::underlying_type>
+struct is_layout_compatible : std::integral_constant<bool,
+  std::is_base_of<data<U,O>, O>::value and
+  std::is_standard_layout<O>::value and
+  std::is_standard_layout<U>::value and
+  std::is_trivially_copyable<O>::value and
+  std::is_trivially_copyable<U>::value and
+  sizeof(O) == sizeof(U) and
+  alignof(O) == alignof(U)> { };
+
+///
+/// Non-owning view of a contiguous sequence of T
+///
+/// This is a C++11 subset of std::span with a dynamic extent.  Use
+/// as_opaque and as_underlying to view the same memory with a different
+/// element type.
+///
+template <typename T>
+class span {
+  template <typename E>
+  using compatible = std::is_convertible<E(*)[], T(*)[]>;
+
+public:
+  typedef T element_type;
+  typedef typename std::remove_cv<T>::type value_type;
+  typedef std::size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef T* pointer;
+  typedef T& reference;
+  typedef T* iterator;
+
+  constexpr span() noexcept : ptr(nullptr), len(0) { }
+  constexpr span(pointer p, size_type n) noexcept : ptr(p), len(n) { }
+  constexpr span(pointer first, pointer last) noexcept
+    : ptr(first), len(static_cast<size_type>(last - first)) { }
+
+  template <std::size_t N>
+  constexpr span(element_type (&a)[N]) noexcept : ptr(a), len(N) { }
+
+  /// View a container with contiguous storage, such as std::vector
+  template <typename C, typename = typename std::enable_if<
+    compatible<detail::container_element<C>>::value>::type>
+  constexpr span(C& c) noexcept(noexcept(c.data()) and noexcept(c.size()))
+    : ptr(c.data()), len(c.size()) { }
+
+  /// Add const to the element type
+  template <typename E, typename = typename std::enable_if<
+    compatible<E>::value>::type>
+  constexpr span(const span<E>& s) noexcept : ptr(s.data()), len(s.size()) { }
+
+  span(const span&) = default;
+  span& operator=(const span&) = default;
+
+  constexpr pointer   data()       const noexcept { return ptr; }
+  constexpr size_type size()       const noexcept { return len; }
+  constexpr size_type size_bytes() const noexcept { return len * sizeof(T); }
+  constexpr bool      empty()      const noexcept { return len == 0; }
+
+  constexpr iterator begin() const noexcept { return ptr; }
+  constexpr iterator end()   const noexcept { return ptr + len; }
+
+  constexpr reference operator[](size_type i) const noexcept { return ptr[i]; }
+  constexpr reference front() const noexcept { return ptr[0]; }
+  constexpr reference back()  const noexcept { return ptr[len - 1]; }
+
+  constexpr span first(size_type n) const noexcept { return span(ptr, n); }
+  constexpr span last(size_type n) const noexcept {
+    return span(ptr + (len - n), n);
+  }
+  constexpr span subspan(size_type offset) const noexcept {
+    return span(ptr + offset, len - offset);
+  }
+  constexpr span subspan(size_type offset, size_type n) const noexcept {
+    return span(ptr + offset, n);
+  }
+
+private:
+  pointer ptr;
+  size_type len;
+};
+
+/// @}
+
+/// \addtogroup internal
+/// @{
+
+namespace detail {
+
+template <typename From, typename To>
+struct copy_cv {
+  using c = typename std::conditional<
+    std::is_const<From>::value, const To, To>::type;
+  using type = typename std::conditional<
+    std::is_volatile<From>::value, volatile c, c>::type;
+};
+
+template <typename From, typename To>
+using copy_cv_t = typename copy_cv<From,To>::type;
+
+template <typename T>
+using underlying_element = copy_cv_t<T,
+  typename std::remove_cv<T>::type::underlying_type>;
+
+template <typename O, typename U>
+struct check_layout {
+  static_assert(std::is_base_of<data<U,O>, O>::value,
+      "Not an opaque typedef of this underlying type");
+  static_assert(std::is_standard_layout<O>::value,
+      "Opaque type is not standard-layout");
+  static_assert(std::is_standard_layout<U>::value,
+      "Underlying type is not standard-layout");
+  static_assert(std::is_trivially_copyable<O>::value,
+      "Opaque type is not trivially copyable");
+  static_assert(std::is_trivially_copyable<U>::value,
+      "Underlying type is not trivially copyable");
+  static_assert(sizeof(O) == sizeof(U),
+      "Opaque type and underlying type differ in size");
+  static_assert(alignof(O) == alignof(U),
+      "Opaque type and underlying type differ in alignment");
+  static constexpr bool value = is_layout_compatible<O,U>::value;
+};
+
+}
+
+/// @}
+
+/// \addtogroup miscellaneous
+/// @{
+
+///
+/// View a buffer of underlying_type as a buffer of the opaque type O
+///
+/// No elements are copied or converted.  The const and volatile
+/// qualification of the elements is preserved.  Compilation fails unless
+/// is_layout_compatible<O> holds.
+///
+template <typename O, typename T>
+span<detail::copy_cv_t<T,O>> as_opaque(span<T> s) noexcept {
+  using U = typename O::underlying_type;
+  using R = detail::copy_cv_t<T,O>;
+  static_assert(std::is_same<typename std::remove_cv<T>::type, U>::value,
+      "Element type is not the underlying type");
+  static_assert(detail::check_layout<O,U>::value, "Layout mismatch");
+  return span<R>(reinterpret_cast<R*>(s.data()), s.size());
+}
+
+/// View n elements of underlying_type at p as the opaque type O
+template <typename O, typename T>
+span<detail::copy_cv_t<T,O>> as_opaque(T* p, std::size_t n) noexcept {
+  return as_opaque<O>(span<T>(p, n));
+}
+
+/// View a container of underlying_type as the opaque type O
+template <typename O, typename C>
+span<detail::copy_cv_t<detail::container_element<C>,O>> as_opaque(C& c)
+  noexcept {
+  return as_opaque<O>(span<detail::container_element<C>>(c));
+}
+
+///
+/// View a buffer of an opaque type as a buffer of its underlying_type
+///
+/// No elements are copied or converted.  The const and volatile
+/// qualification of the elements is preserved.  Compilation fails unless
+/// is_layout_compatible holds for the opaque type.
+///
+template <typename T>
+span<detail::underlying_element<T>> as_underlying(span<T> s) noexcept {
+  using O = typename std::remove_cv<T>::type;
+  using U = typename O::underlying_type;
+  using R = detail::underlying_element<T>;
+  static_assert(detail::check_layout<O,U>::value, "Layout mismatch");
+  return span<R>(reinterpret_cast<R*>(s.data()), s.size());
+}
+
+/// View n elements of an opaque type at p as its underlying_type
+template <typename T>
+span<detail::underlying_element<T>> as_underlying(T* p, std::size_t n)
+  noexcept {
+  return as_underlying(span<T>(p, n));
+}
+
+/// View a container of an opaque type as its underlying_type
+template <typename C>
+span<detail::underlying_element<detail::container_element<C>>>
+as_underlying(C& c) noexcept {
+  return as_underlying(span<detail::container_element<C>>(c));
+}
+
+/// @}
+
+}
+
+#endif
@@ -57,6 +57,22 @@ struct functor_well_formed<F, void_t<functor_result_t<F,Args...>>, Args...>
   using result_type = functor_result_t<F,Args...>;
 };
 
+// Types whose arithmetic does more than the underlying operators declare
+// what they do on overflow
+template <typename O, typename = void>
+struct has_overflow_policy : std::false_type { };
+template <typename O>
+struct has_overflow_policy<O, void_t<typename O::overflow_policy>>
+  : std::true_type { };
+
+// Fixed-point opaque types declare the number of fractional bits of their
+// underlying value
+template <typename O, typename = void>
+struct is_fixed_point_opaque : std::false_type { };
+template <typename O>
+struct is_fixed_point_opaque<O, void_t<typename O::underlying_type,
+  std::integral_constant<unsigned, O::frac_bits>>> : std::true_type { };
+
 }
 
 template <typename F, typename... Args>
@@ -55,6 +55,14 @@ constexpr typename std::remove_reference<T>::type&& move(T&& t) noexcept {
 }
 #endif
 
+///
+/// Treat an rvalue as an lvalue until the end of the full-expression
+///
+template <typename T>
+constexpr T& as_lvalue(T&& t) noexcept {
+  return t;
+}
+
 /// @}
 
 }
@@ -72,13 +72,18 @@ DIR_REMOVE   = rm -rf
 
 DOXYGEN ?= doxygen
 
+#
+# Maximum acceptable ratio of opaque to underlying run time in benchmarks
+#
+BENCH_THRESHOLD = 1.25
+
 #
 # Remove default suffix rules and CXXFLAGS
 #
 .SUFFIXES:
 CXXFLAGS=
 
-.PHONY: all lib test clean distclean check
+.PHONY: all lib test clean distclean check asmcheck bench
 
 all:   normal/bin
 lib:   normal/lib
@@ -97,14 +102,63 @@ check: test
 	normal/convert
 	normal/binop_function
 	normal/binop_overload
+	normal/binop_audit
 	normal/binop_inherit
 	normal/ostream
+	normal/format
+	normal/parse
 	normal/numeric_typedef
+	normal/expr_numeric_typedef
+	normal/atomic_typedef
+	normal/sharded_counter
+	normal/checked_numeric_typedef
+	normal/saturating_typedef
+	normal/fixed_point_typedef
+	normal/simd_typedef
+	normal/span
+	normal/binop_batch
+	normal/algorithm
+	normal/flat_map
+	normal/id_vector
+	normal/slot_map
 	normal/inconvertibool
+	normal/search
 	normal/safer_string_typedef
+	normal/fixed_string_typedef
+	normal/interned_string_typedef
 	normal/string_typedef
+	normal/string_view_typedef
+	normal/concat
 	normal/hash
 
+#
+# Verify that opaque typedefs generate no more instructions than the builtin
+# types they wrap
+#
+asmcheck: normal/${DIR_SENTINEL}
+	sh asmcheck/asmcheck.sh normal/asmcheck-O2.s \
+	  ${CXX} ${COMMON} -O2 ${CPPFLAGS} ${CXXFLAGS} asmcheck/asmcheck.cpp
+	sh asmcheck/asmcheck.sh normal/asmcheck-O3.s \
+	  ${CXX} ${COMMON} -O3 ${CPPFLAGS} ${CXXFLAGS} asmcheck/asmcheck.cpp
+
+bench: normal/bin
+	normal/bench_numeric_typedef ${BENCH_THRESHOLD}
+	normal/bench_binop ${BENCH_THRESHOLD}
+	normal/bench_checked_numeric_typedef ${BENCH_THRESHOLD}
+	normal/bench_saturating_typedef ${BENCH_THRESHOLD}
+	normal/bench_fixed_point_typedef ${BENCH_THRESHOLD}
+	normal/bench_convert ${BENCH_THRESHOLD}
+	normal/bench_format ${BENCH_THRESHOLD}
+	normal/bench_parse ${BENCH_THRESHOLD}
+	normal/bench_hash ${BENCH_THRESHOLD}
+	normal/bench_hash_policy ${BENCH_THRESHOLD}
+	normal/bench_atomic_typedef ${BENCH_THRESHOLD}
+	normal/bench_sharded_counter ${BENCH_THRESHOLD}
+	normal/bench_flat_map ${BENCH_THRESHOLD}
+	normal/bench_safer_string_typedef ${BENCH_THRESHOLD}
+	normal/bench_string_arena ${BENCH_THRESHOLD}
+	normal/bench_interned_string_typedef ${BENCH_THRESHOLD}
+
 everything: doc
 
 doc: include/opaque/* include/opaque/binop/* include/arrtest/*
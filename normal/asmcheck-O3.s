@@ -0,0 +1,4790 @@
+	.file	"asmcheck.cpp"
+	.text
+	.section	.rodata._ZN6opaque6detail14throw_overflowEv.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"opaque: arithmetic overflow"
+	.section	.text.unlikely._ZN6opaque6detail14throw_overflowEv,"axG",@progbits,_ZN6opaque6detail14throw_overflowEv,comdat
+	.weak	_ZN6opaque6detail14throw_overflowEv
+	.type	_ZN6opaque6detail14throw_overflowEv, @function
+_ZN6opaque6detail14throw_overflowEv:
+.LFB1386:
+	.cfi_startproc
+	.cfi_personality 0x9b,DW.ref.__gxx_personality_v0
+	.cfi_lsda 0x1b,.LLSDA1386
+	pushq	%rbp
+	.cfi_def_cfa_offset 16
+	.cfi_offset 6, -16
+	movl	$16, %edi
+	pushq	%rbx
+	.cfi_def_cfa_offset 24
+	.cfi_offset 3, -24
+	pushq	%rax
+	.cfi_def_cfa_offset 32
+	call	__cxa_allocate_exception@PLT
+	leaq	.LC0(%rip), %rsi
+	movq	%rax, %rdi
+	movq	%rax, %rbx
+.LEHB0:
+	call	_ZNSt14overflow_errorC1EPKc@PLT
+.LEHE0:
+	movq	_ZNSt14overflow_errorD1Ev@GOTPCREL(%rip), %rdx
+	leaq	_ZTISt14overflow_error(%rip), %rsi
+	movq	%rbx, %rdi
+.LEHB1:
+	call	__cxa_throw@PLT
+.L3:
+	movq	%rax, %rbp
+.L2:
+	movq	%rbx, %rdi
+	call	__cxa_free_exception@PLT
+	movq	%rbp, %rdi
+	call	_Unwind_Resume@PLT
+.LEHE1:
+	.cfi_endproc
+.LFE1386:
+	.globl	__gxx_personality_v0
+	.section	.gcc_except_table._ZN6opaque6detail14throw_overflowEv,"aG",@progbits,_ZN6opaque6detail14throw_overflowEv,comdat
+.LLSDA1386:
+	.byte	0xff
+	.byte	0xff
+	.byte	0x1
+	.uleb128 .LLSDACSE1386-.LLSDACSB1386
+.LLSDACSB1386:
+	.uleb128 .LEHB0-.LFB1386
+	.uleb128 .LEHE0-.LEHB0
+	.uleb128 .L3-.LFB1386
+	.uleb128 0
+	.uleb128 .LEHB1-.LFB1386
+	.uleb128 .LEHE1-.LEHB1
+	.uleb128 0
+	.uleb128 0
+.LLSDACSE1386:
+	.section	.text.unlikely._ZN6opaque6detail14throw_overflowEv,"axG",@progbits,_ZN6opaque6detail14throw_overflowEv,comdat
+	.size	_ZN6opaque6detail14throw_overflowEv, .-_ZN6opaque6detail14throw_overflowEv
+	.text
+	.p2align 4
+	.globl	asm_builtin_mul_i32
+	.type	asm_builtin_mul_i32, @function
+asm_builtin_mul_i32:
+.LFB1438:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1438:
+	.size	asm_builtin_mul_i32, .-asm_builtin_mul_i32
+	.p2align 4
+	.globl	asm_opaque_mul_i32
+	.type	asm_opaque_mul_i32, @function
+asm_opaque_mul_i32:
+.LFB1439:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1439:
+	.size	asm_opaque_mul_i32, .-asm_opaque_mul_i32
+	.p2align 4
+	.globl	asm_builtin_div_i32
+	.type	asm_builtin_div_i32, @function
+asm_builtin_div_i32:
+.LFB1472:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	ret
+	.cfi_endproc
+.LFE1472:
+	.size	asm_builtin_div_i32, .-asm_builtin_div_i32
+	.p2align 4
+	.globl	asm_opaque_div_i32
+	.type	asm_opaque_div_i32, @function
+asm_opaque_div_i32:
+.LFB1473:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	ret
+	.cfi_endproc
+.LFE1473:
+	.size	asm_opaque_div_i32, .-asm_opaque_div_i32
+	.p2align 4
+	.globl	asm_builtin_add_i32
+	.type	asm_builtin_add_i32, @function
+asm_builtin_add_i32:
+.LFB1474:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1474:
+	.size	asm_builtin_add_i32, .-asm_builtin_add_i32
+	.p2align 4
+	.globl	asm_opaque_add_i32
+	.type	asm_opaque_add_i32, @function
+asm_opaque_add_i32:
+.LFB1475:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1475:
+	.size	asm_opaque_add_i32, .-asm_opaque_add_i32
+	.p2align 4
+	.globl	asm_builtin_sub_i32
+	.type	asm_builtin_sub_i32, @function
+asm_builtin_sub_i32:
+.LFB1484:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1484:
+	.size	asm_builtin_sub_i32, .-asm_builtin_sub_i32
+	.p2align 4
+	.globl	asm_opaque_sub_i32
+	.type	asm_opaque_sub_i32, @function
+asm_opaque_sub_i32:
+.LFB1485:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1485:
+	.size	asm_opaque_sub_i32, .-asm_opaque_sub_i32
+	.p2align 4
+	.globl	asm_builtin_mul_eq_i32
+	.type	asm_builtin_mul_eq_i32, @function
+asm_builtin_mul_eq_i32:
+.LFB1486:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1486:
+	.size	asm_builtin_mul_eq_i32, .-asm_builtin_mul_eq_i32
+	.p2align 4
+	.globl	asm_opaque_mul_eq_i32
+	.type	asm_opaque_mul_eq_i32, @function
+asm_opaque_mul_eq_i32:
+.LFB1487:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1487:
+	.size	asm_opaque_mul_eq_i32, .-asm_opaque_mul_eq_i32
+	.p2align 4
+	.globl	asm_builtin_div_eq_i32
+	.type	asm_builtin_div_eq_i32, @function
+asm_builtin_div_eq_i32:
+.LFB1488:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	ret
+	.cfi_endproc
+.LFE1488:
+	.size	asm_builtin_div_eq_i32, .-asm_builtin_div_eq_i32
+	.p2align 4
+	.globl	asm_opaque_div_eq_i32
+	.type	asm_opaque_div_eq_i32, @function
+asm_opaque_div_eq_i32:
+.LFB1489:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	ret
+	.cfi_endproc
+.LFE1489:
+	.size	asm_opaque_div_eq_i32, .-asm_opaque_div_eq_i32
+	.p2align 4
+	.globl	asm_builtin_add_eq_i32
+	.type	asm_builtin_add_eq_i32, @function
+asm_builtin_add_eq_i32:
+.LFB1490:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1490:
+	.size	asm_builtin_add_eq_i32, .-asm_builtin_add_eq_i32
+	.p2align 4
+	.globl	asm_opaque_add_eq_i32
+	.type	asm_opaque_add_eq_i32, @function
+asm_opaque_add_eq_i32:
+.LFB1491:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1491:
+	.size	asm_opaque_add_eq_i32, .-asm_opaque_add_eq_i32
+	.p2align 4
+	.globl	asm_builtin_sub_eq_i32
+	.type	asm_builtin_sub_eq_i32, @function
+asm_builtin_sub_eq_i32:
+.LFB1492:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1492:
+	.size	asm_builtin_sub_eq_i32, .-asm_builtin_sub_eq_i32
+	.p2align 4
+	.globl	asm_opaque_sub_eq_i32
+	.type	asm_opaque_sub_eq_i32, @function
+asm_opaque_sub_eq_i32:
+.LFB1493:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1493:
+	.size	asm_opaque_sub_eq_i32, .-asm_opaque_sub_eq_i32
+	.p2align 4
+	.globl	asm_builtin_pos_i32
+	.type	asm_builtin_pos_i32, @function
+asm_builtin_pos_i32:
+.LFB1494:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1494:
+	.size	asm_builtin_pos_i32, .-asm_builtin_pos_i32
+	.p2align 4
+	.globl	asm_opaque_pos_i32
+	.type	asm_opaque_pos_i32, @function
+asm_opaque_pos_i32:
+.LFB1495:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1495:
+	.size	asm_opaque_pos_i32, .-asm_opaque_pos_i32
+	.p2align 4
+	.globl	asm_builtin_neg_i32
+	.type	asm_builtin_neg_i32, @function
+asm_builtin_neg_i32:
+.LFB1496:
+	.cfi_startproc
+	movl	%edi, %eax
+	negl	%eax
+	ret
+	.cfi_endproc
+.LFE1496:
+	.size	asm_builtin_neg_i32, .-asm_builtin_neg_i32
+	.p2align 4
+	.globl	asm_opaque_neg_i32
+	.type	asm_opaque_neg_i32, @function
+asm_opaque_neg_i32:
+.LFB1497:
+	.cfi_startproc
+	movl	%edi, %eax
+	negl	%eax
+	ret
+	.cfi_endproc
+.LFE1497:
+	.size	asm_opaque_neg_i32, .-asm_opaque_neg_i32
+	.p2align 4
+	.globl	asm_builtin_preinc_i32
+	.type	asm_builtin_preinc_i32, @function
+asm_builtin_preinc_i32:
+.LFB1498:
+	.cfi_startproc
+	leal	1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1498:
+	.size	asm_builtin_preinc_i32, .-asm_builtin_preinc_i32
+	.p2align 4
+	.globl	asm_opaque_preinc_i32
+	.type	asm_opaque_preinc_i32, @function
+asm_opaque_preinc_i32:
+.LFB1499:
+	.cfi_startproc
+	leal	1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1499:
+	.size	asm_opaque_preinc_i32, .-asm_opaque_preinc_i32
+	.p2align 4
+	.globl	asm_builtin_predec_i32
+	.type	asm_builtin_predec_i32, @function
+asm_builtin_predec_i32:
+.LFB1500:
+	.cfi_startproc
+	leal	-1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1500:
+	.size	asm_builtin_predec_i32, .-asm_builtin_predec_i32
+	.p2align 4
+	.globl	asm_opaque_predec_i32
+	.type	asm_opaque_predec_i32, @function
+asm_opaque_predec_i32:
+.LFB1501:
+	.cfi_startproc
+	leal	-1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1501:
+	.size	asm_opaque_predec_i32, .-asm_opaque_predec_i32
+	.p2align 4
+	.globl	asm_builtin_postinc_i32
+	.type	asm_builtin_postinc_i32, @function
+asm_builtin_postinc_i32:
+.LFB1502:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1502:
+	.size	asm_builtin_postinc_i32, .-asm_builtin_postinc_i32
+	.p2align 4
+	.globl	asm_opaque_postinc_i32
+	.type	asm_opaque_postinc_i32, @function
+asm_opaque_postinc_i32:
+.LFB1503:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1503:
+	.size	asm_opaque_postinc_i32, .-asm_opaque_postinc_i32
+	.p2align 4
+	.globl	asm_builtin_postdec_i32
+	.type	asm_builtin_postdec_i32, @function
+asm_builtin_postdec_i32:
+.LFB1505:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1505:
+	.size	asm_builtin_postdec_i32, .-asm_builtin_postdec_i32
+	.p2align 4
+	.globl	asm_opaque_postdec_i32
+	.type	asm_opaque_postdec_i32, @function
+asm_opaque_postdec_i32:
+.LFB1506:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1506:
+	.size	asm_opaque_postdec_i32, .-asm_opaque_postdec_i32
+	.p2align 4
+	.globl	asm_builtin_eq_i32
+	.type	asm_builtin_eq_i32, @function
+asm_builtin_eq_i32:
+.LFB1507:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1507:
+	.size	asm_builtin_eq_i32, .-asm_builtin_eq_i32
+	.p2align 4
+	.globl	asm_opaque_eq_i32
+	.type	asm_opaque_eq_i32, @function
+asm_opaque_eq_i32:
+.LFB1508:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1508:
+	.size	asm_opaque_eq_i32, .-asm_opaque_eq_i32
+	.p2align 4
+	.globl	asm_builtin_ne_i32
+	.type	asm_builtin_ne_i32, @function
+asm_builtin_ne_i32:
+.LFB1509:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1509:
+	.size	asm_builtin_ne_i32, .-asm_builtin_ne_i32
+	.p2align 4
+	.globl	asm_opaque_ne_i32
+	.type	asm_opaque_ne_i32, @function
+asm_opaque_ne_i32:
+.LFB1510:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1510:
+	.size	asm_opaque_ne_i32, .-asm_opaque_ne_i32
+	.p2align 4
+	.globl	asm_builtin_lt_i32
+	.type	asm_builtin_lt_i32, @function
+asm_builtin_lt_i32:
+.LFB1511:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setl	%al
+	ret
+	.cfi_endproc
+.LFE1511:
+	.size	asm_builtin_lt_i32, .-asm_builtin_lt_i32
+	.p2align 4
+	.globl	asm_opaque_lt_i32
+	.type	asm_opaque_lt_i32, @function
+asm_opaque_lt_i32:
+.LFB1512:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setg	%al
+	ret
+	.cfi_endproc
+.LFE1512:
+	.size	asm_opaque_lt_i32, .-asm_opaque_lt_i32
+	.p2align 4
+	.globl	asm_builtin_gt_i32
+	.type	asm_builtin_gt_i32, @function
+asm_builtin_gt_i32:
+.LFB1513:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setg	%al
+	ret
+	.cfi_endproc
+.LFE1513:
+	.size	asm_builtin_gt_i32, .-asm_builtin_gt_i32
+	.p2align 4
+	.globl	asm_opaque_gt_i32
+	.type	asm_opaque_gt_i32, @function
+asm_opaque_gt_i32:
+.LFB1514:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setl	%al
+	ret
+	.cfi_endproc
+.LFE1514:
+	.size	asm_opaque_gt_i32, .-asm_opaque_gt_i32
+	.p2align 4
+	.globl	asm_builtin_le_i32
+	.type	asm_builtin_le_i32, @function
+asm_builtin_le_i32:
+.LFB1515:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setle	%al
+	ret
+	.cfi_endproc
+.LFE1515:
+	.size	asm_builtin_le_i32, .-asm_builtin_le_i32
+	.p2align 4
+	.globl	asm_opaque_le_i32
+	.type	asm_opaque_le_i32, @function
+asm_opaque_le_i32:
+.LFB1516:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setge	%al
+	ret
+	.cfi_endproc
+.LFE1516:
+	.size	asm_opaque_le_i32, .-asm_opaque_le_i32
+	.p2align 4
+	.globl	asm_builtin_ge_i32
+	.type	asm_builtin_ge_i32, @function
+asm_builtin_ge_i32:
+.LFB1517:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setge	%al
+	ret
+	.cfi_endproc
+.LFE1517:
+	.size	asm_builtin_ge_i32, .-asm_builtin_ge_i32
+	.p2align 4
+	.globl	asm_opaque_ge_i32
+	.type	asm_opaque_ge_i32, @function
+asm_opaque_ge_i32:
+.LFB1518:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setle	%al
+	ret
+	.cfi_endproc
+.LFE1518:
+	.size	asm_opaque_ge_i32, .-asm_opaque_ge_i32
+	.p2align 4
+	.globl	asm_builtin_not_i32
+	.type	asm_builtin_not_i32, @function
+asm_builtin_not_i32:
+.LFB1519:
+	.cfi_startproc
+	testl	%edi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1519:
+	.size	asm_builtin_not_i32, .-asm_builtin_not_i32
+	.p2align 4
+	.globl	asm_opaque_not_i32
+	.type	asm_opaque_not_i32, @function
+asm_opaque_not_i32:
+.LFB1520:
+	.cfi_startproc
+	testl	%edi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1520:
+	.size	asm_opaque_not_i32, .-asm_opaque_not_i32
+	.p2align 4
+	.globl	asm_builtin_bool_i32
+	.type	asm_builtin_bool_i32, @function
+asm_builtin_bool_i32:
+.LFB1521:
+	.cfi_startproc
+	testl	%edi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1521:
+	.size	asm_builtin_bool_i32, .-asm_builtin_bool_i32
+	.p2align 4
+	.globl	asm_opaque_bool_i32
+	.type	asm_opaque_bool_i32, @function
+asm_opaque_bool_i32:
+.LFB1522:
+	.cfi_startproc
+	testl	%edi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1522:
+	.size	asm_opaque_bool_i32, .-asm_opaque_bool_i32
+	.p2align 4
+	.globl	asm_builtin_pos_add_dist_i32
+	.type	asm_builtin_pos_add_dist_i32, @function
+asm_builtin_pos_add_dist_i32:
+.LFB1523:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1523:
+	.size	asm_builtin_pos_add_dist_i32, .-asm_builtin_pos_add_dist_i32
+	.p2align 4
+	.globl	asm_opaque_pos_add_dist_i32
+	.type	asm_opaque_pos_add_dist_i32, @function
+asm_opaque_pos_add_dist_i32:
+.LFB1524:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1524:
+	.size	asm_opaque_pos_add_dist_i32, .-asm_opaque_pos_add_dist_i32
+	.p2align 4
+	.globl	asm_builtin_dist_add_pos_i32
+	.type	asm_builtin_dist_add_pos_i32, @function
+asm_builtin_dist_add_pos_i32:
+.LFB1546:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1546:
+	.size	asm_builtin_dist_add_pos_i32, .-asm_builtin_dist_add_pos_i32
+	.p2align 4
+	.globl	asm_opaque_dist_add_pos_i32
+	.type	asm_opaque_dist_add_pos_i32, @function
+asm_opaque_dist_add_pos_i32:
+.LFB1547:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1547:
+	.size	asm_opaque_dist_add_pos_i32, .-asm_opaque_dist_add_pos_i32
+	.p2align 4
+	.globl	asm_builtin_pos_sub_dist_i32
+	.type	asm_builtin_pos_sub_dist_i32, @function
+asm_builtin_pos_sub_dist_i32:
+.LFB1551:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1551:
+	.size	asm_builtin_pos_sub_dist_i32, .-asm_builtin_pos_sub_dist_i32
+	.p2align 4
+	.globl	asm_opaque_pos_sub_dist_i32
+	.type	asm_opaque_pos_sub_dist_i32, @function
+asm_opaque_pos_sub_dist_i32:
+.LFB1552:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1552:
+	.size	asm_opaque_pos_sub_dist_i32, .-asm_opaque_pos_sub_dist_i32
+	.p2align 4
+	.globl	asm_builtin_pos_sub_pos_i32
+	.type	asm_builtin_pos_sub_pos_i32, @function
+asm_builtin_pos_sub_pos_i32:
+.LFB1553:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1553:
+	.size	asm_builtin_pos_sub_pos_i32, .-asm_builtin_pos_sub_pos_i32
+	.p2align 4
+	.globl	asm_opaque_pos_sub_pos_i32
+	.type	asm_opaque_pos_sub_pos_i32, @function
+asm_opaque_pos_sub_pos_i32:
+.LFB1554:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1554:
+	.size	asm_opaque_pos_sub_pos_i32, .-asm_opaque_pos_sub_pos_i32
+	.p2align 4
+	.globl	asm_builtin_addr_add_off_i32
+	.type	asm_builtin_addr_add_off_i32, @function
+asm_builtin_addr_add_off_i32:
+.LFB1555:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1555:
+	.size	asm_builtin_addr_add_off_i32, .-asm_builtin_addr_add_off_i32
+	.p2align 4
+	.globl	asm_opaque_addr_add_off_i32
+	.type	asm_opaque_addr_add_off_i32, @function
+asm_opaque_addr_add_off_i32:
+.LFB1556:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1556:
+	.size	asm_opaque_addr_add_off_i32, .-asm_opaque_addr_add_off_i32
+	.p2align 4
+	.globl	asm_builtin_addr_sub_addr_i32
+	.type	asm_builtin_addr_sub_addr_i32, @function
+asm_builtin_addr_sub_addr_i32:
+.LFB1575:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1575:
+	.size	asm_builtin_addr_sub_addr_i32, .-asm_builtin_addr_sub_addr_i32
+	.p2align 4
+	.globl	asm_opaque_addr_sub_addr_i32
+	.type	asm_opaque_addr_sub_addr_i32, @function
+asm_opaque_addr_sub_addr_i32:
+.LFB1576:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1576:
+	.size	asm_opaque_addr_sub_addr_i32, .-asm_opaque_addr_sub_addr_i32
+	.p2align 4
+	.globl	asm_builtin_chk_add_throw_i32
+	.type	asm_builtin_chk_add_throw_i32, @function
+asm_builtin_chk_add_throw_i32:
+.LFB1577:
+	.cfi_startproc
+	movl	%edi, %eax
+	addl	%esi, %eax
+	jo	.L70
+	ret
+.L70:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1577:
+	.size	asm_builtin_chk_add_throw_i32, .-asm_builtin_chk_add_throw_i32
+	.p2align 4
+	.globl	asm_opaque_chk_add_throw_i32
+	.type	asm_opaque_chk_add_throw_i32, @function
+asm_opaque_chk_add_throw_i32:
+.LFB1578:
+	.cfi_startproc
+	movl	%esi, %eax
+	addl	%edi, %eax
+	jo	.L79
+	ret
+.L79:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1578:
+	.size	asm_opaque_chk_add_throw_i32, .-asm_opaque_chk_add_throw_i32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_throw_i32
+	.type	asm_builtin_chk_sub_throw_i32, @function
+asm_builtin_chk_sub_throw_i32:
+.LFB1611:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jo	.L88
+	ret
+.L88:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1611:
+	.size	asm_builtin_chk_sub_throw_i32, .-asm_builtin_chk_sub_throw_i32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_throw_i32
+	.type	asm_opaque_chk_sub_throw_i32, @function
+asm_opaque_chk_sub_throw_i32:
+.LFB1612:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jo	.L97
+	ret
+.L97:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1612:
+	.size	asm_opaque_chk_sub_throw_i32, .-asm_opaque_chk_sub_throw_i32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_throw_i32
+	.type	asm_builtin_chk_mul_throw_i32, @function
+asm_builtin_chk_mul_throw_i32:
+.LFB1613:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	jo	.L106
+	ret
+.L106:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1613:
+	.size	asm_builtin_chk_mul_throw_i32, .-asm_builtin_chk_mul_throw_i32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_throw_i32
+	.type	asm_opaque_chk_mul_throw_i32, @function
+asm_opaque_chk_mul_throw_i32:
+.LFB1614:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	jo	.L115
+	ret
+.L115:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1614:
+	.size	asm_opaque_chk_mul_throw_i32, .-asm_opaque_chk_mul_throw_i32
+	.p2align 4
+	.globl	asm_builtin_chk_add_saturate_i32
+	.type	asm_builtin_chk_add_saturate_i32, @function
+asm_builtin_chk_add_saturate_i32:
+.LFB1623:
+	.cfi_startproc
+	addl	%esi, %edi
+	jo	.L118
+	movl	%edi, %eax
+	ret
+.L118:
+	movl	%esi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1623:
+	.size	asm_builtin_chk_add_saturate_i32, .-asm_builtin_chk_add_saturate_i32
+	.p2align 4
+	.globl	asm_opaque_chk_add_saturate_i32
+	.type	asm_opaque_chk_add_saturate_i32, @function
+asm_opaque_chk_add_saturate_i32:
+.LFB1624:
+	.cfi_startproc
+	addl	%esi, %edi
+	jo	.L124
+	movl	%edi, %eax
+	ret
+.L124:
+	movl	%esi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1624:
+	.size	asm_opaque_chk_add_saturate_i32, .-asm_opaque_chk_add_saturate_i32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_saturate_i32
+	.type	asm_builtin_chk_sub_saturate_i32, @function
+asm_builtin_chk_sub_saturate_i32:
+.LFB1657:
+	.cfi_startproc
+	subl	%esi, %edi
+	jo	.L130
+	movl	%edi, %eax
+	ret
+.L130:
+	notl	%esi
+	movl	%esi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1657:
+	.size	asm_builtin_chk_sub_saturate_i32, .-asm_builtin_chk_sub_saturate_i32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_saturate_i32
+	.type	asm_opaque_chk_sub_saturate_i32, @function
+asm_opaque_chk_sub_saturate_i32:
+.LFB1658:
+	.cfi_startproc
+	subl	%esi, %edi
+	jo	.L136
+	movl	%edi, %eax
+	ret
+.L136:
+	notl	%esi
+	movl	%esi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1658:
+	.size	asm_opaque_chk_sub_saturate_i32, .-asm_opaque_chk_sub_saturate_i32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_saturate_i32
+	.type	asm_builtin_chk_mul_saturate_i32, @function
+asm_builtin_chk_mul_saturate_i32:
+.LFB1659:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	jo	.L146
+	ret
+.L146:
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1659:
+	.size	asm_builtin_chk_mul_saturate_i32, .-asm_builtin_chk_mul_saturate_i32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_saturate_i32
+	.type	asm_opaque_chk_mul_saturate_i32, @function
+asm_opaque_chk_mul_saturate_i32:
+.LFB1660:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	jo	.L153
+	ret
+.L153:
+	movl	%esi, %eax
+	xorl	%edi, %eax
+	shrl	$31, %eax
+	addl	$2147483647, %eax
+	ret
+	.cfi_endproc
+.LFE1660:
+	.size	asm_opaque_chk_mul_saturate_i32, .-asm_opaque_chk_mul_saturate_i32
+	.p2align 4
+	.globl	asm_builtin_chk_add_wrap_i32
+	.type	asm_builtin_chk_add_wrap_i32, @function
+asm_builtin_chk_add_wrap_i32:
+.LFB1669:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1669:
+	.size	asm_builtin_chk_add_wrap_i32, .-asm_builtin_chk_add_wrap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_add_wrap_i32
+	.type	asm_opaque_chk_add_wrap_i32, @function
+asm_opaque_chk_add_wrap_i32:
+.LFB1670:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1670:
+	.size	asm_opaque_chk_add_wrap_i32, .-asm_opaque_chk_add_wrap_i32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_wrap_i32
+	.type	asm_builtin_chk_sub_wrap_i32, @function
+asm_builtin_chk_sub_wrap_i32:
+.LFB1703:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1703:
+	.size	asm_builtin_chk_sub_wrap_i32, .-asm_builtin_chk_sub_wrap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_wrap_i32
+	.type	asm_opaque_chk_sub_wrap_i32, @function
+asm_opaque_chk_sub_wrap_i32:
+.LFB1704:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1704:
+	.size	asm_opaque_chk_sub_wrap_i32, .-asm_opaque_chk_sub_wrap_i32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_wrap_i32
+	.type	asm_builtin_chk_mul_wrap_i32, @function
+asm_builtin_chk_mul_wrap_i32:
+.LFB1705:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1705:
+	.size	asm_builtin_chk_mul_wrap_i32, .-asm_builtin_chk_mul_wrap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_wrap_i32
+	.type	asm_opaque_chk_mul_wrap_i32, @function
+asm_opaque_chk_mul_wrap_i32:
+.LFB1706:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1706:
+	.size	asm_opaque_chk_mul_wrap_i32, .-asm_opaque_chk_mul_wrap_i32
+	.p2align 4
+	.globl	asm_builtin_chk_add_trap_i32
+	.type	asm_builtin_chk_add_trap_i32, @function
+asm_builtin_chk_add_trap_i32:
+.LFB1715:
+	.cfi_startproc
+	movl	%edi, %eax
+	addl	%esi, %eax
+	jo	.L165
+	ret
+.L165:
+	ud2
+	.cfi_endproc
+.LFE1715:
+	.size	asm_builtin_chk_add_trap_i32, .-asm_builtin_chk_add_trap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_add_trap_i32
+	.type	asm_opaque_chk_add_trap_i32, @function
+asm_opaque_chk_add_trap_i32:
+.LFB1716:
+	.cfi_startproc
+	movl	%esi, %eax
+	addl	%edi, %eax
+	jo	.L171
+	ret
+.L171:
+	ud2
+	.cfi_endproc
+.LFE1716:
+	.size	asm_opaque_chk_add_trap_i32, .-asm_opaque_chk_add_trap_i32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_trap_i32
+	.type	asm_builtin_chk_sub_trap_i32, @function
+asm_builtin_chk_sub_trap_i32:
+.LFB1749:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jo	.L177
+	ret
+.L177:
+	ud2
+	.cfi_endproc
+.LFE1749:
+	.size	asm_builtin_chk_sub_trap_i32, .-asm_builtin_chk_sub_trap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_trap_i32
+	.type	asm_opaque_chk_sub_trap_i32, @function
+asm_opaque_chk_sub_trap_i32:
+.LFB1750:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jo	.L183
+	ret
+.L183:
+	ud2
+	.cfi_endproc
+.LFE1750:
+	.size	asm_opaque_chk_sub_trap_i32, .-asm_opaque_chk_sub_trap_i32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_trap_i32
+	.type	asm_builtin_chk_mul_trap_i32, @function
+asm_builtin_chk_mul_trap_i32:
+.LFB1751:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	jo	.L189
+	ret
+.L189:
+	ud2
+	.cfi_endproc
+.LFE1751:
+	.size	asm_builtin_chk_mul_trap_i32, .-asm_builtin_chk_mul_trap_i32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_trap_i32
+	.type	asm_opaque_chk_mul_trap_i32, @function
+asm_opaque_chk_mul_trap_i32:
+.LFB1752:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	jo	.L195
+	ret
+.L195:
+	ud2
+	.cfi_endproc
+.LFE1752:
+	.size	asm_opaque_chk_mul_trap_i32, .-asm_opaque_chk_mul_trap_i32
+	.p2align 4
+	.globl	asm_builtin_mod_i32
+	.type	asm_builtin_mod_i32, @function
+asm_builtin_mod_i32:
+.LFB1761:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE1761:
+	.size	asm_builtin_mod_i32, .-asm_builtin_mod_i32
+	.p2align 4
+	.globl	asm_opaque_mod_i32
+	.type	asm_opaque_mod_i32, @function
+asm_opaque_mod_i32:
+.LFB1762:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE1762:
+	.size	asm_opaque_mod_i32, .-asm_opaque_mod_i32
+	.p2align 4
+	.globl	asm_builtin_and_i32
+	.type	asm_builtin_and_i32, @function
+asm_builtin_and_i32:
+.LFB1763:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1763:
+	.size	asm_builtin_and_i32, .-asm_builtin_and_i32
+	.p2align 4
+	.globl	asm_opaque_and_i32
+	.type	asm_opaque_and_i32, @function
+asm_opaque_and_i32:
+.LFB1764:
+	.cfi_startproc
+	movl	%esi, %eax
+	andl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1764:
+	.size	asm_opaque_and_i32, .-asm_opaque_and_i32
+	.p2align 4
+	.globl	asm_builtin_xor_i32
+	.type	asm_builtin_xor_i32, @function
+asm_builtin_xor_i32:
+.LFB1773:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1773:
+	.size	asm_builtin_xor_i32, .-asm_builtin_xor_i32
+	.p2align 4
+	.globl	asm_opaque_xor_i32
+	.type	asm_opaque_xor_i32, @function
+asm_opaque_xor_i32:
+.LFB1774:
+	.cfi_startproc
+	movl	%esi, %eax
+	xorl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1774:
+	.size	asm_opaque_xor_i32, .-asm_opaque_xor_i32
+	.p2align 4
+	.globl	asm_builtin_or_i32
+	.type	asm_builtin_or_i32, @function
+asm_builtin_or_i32:
+.LFB1783:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1783:
+	.size	asm_builtin_or_i32, .-asm_builtin_or_i32
+	.p2align 4
+	.globl	asm_opaque_or_i32
+	.type	asm_opaque_or_i32, @function
+asm_opaque_or_i32:
+.LFB1784:
+	.cfi_startproc
+	movl	%esi, %eax
+	orl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1784:
+	.size	asm_opaque_or_i32, .-asm_opaque_or_i32
+	.p2align 4
+	.globl	asm_builtin_mod_eq_i32
+	.type	asm_builtin_mod_eq_i32, @function
+asm_builtin_mod_eq_i32:
+.LFB1793:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE1793:
+	.size	asm_builtin_mod_eq_i32, .-asm_builtin_mod_eq_i32
+	.p2align 4
+	.globl	asm_opaque_mod_eq_i32
+	.type	asm_opaque_mod_eq_i32, @function
+asm_opaque_mod_eq_i32:
+.LFB1794:
+	.cfi_startproc
+	movl	%edi, %eax
+	cltd
+	idivl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE1794:
+	.size	asm_opaque_mod_eq_i32, .-asm_opaque_mod_eq_i32
+	.p2align 4
+	.globl	asm_builtin_and_eq_i32
+	.type	asm_builtin_and_eq_i32, @function
+asm_builtin_and_eq_i32:
+.LFB1795:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1795:
+	.size	asm_builtin_and_eq_i32, .-asm_builtin_and_eq_i32
+	.p2align 4
+	.globl	asm_opaque_and_eq_i32
+	.type	asm_opaque_and_eq_i32, @function
+asm_opaque_and_eq_i32:
+.LFB1796:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1796:
+	.size	asm_opaque_and_eq_i32, .-asm_opaque_and_eq_i32
+	.p2align 4
+	.globl	asm_builtin_xor_eq_i32
+	.type	asm_builtin_xor_eq_i32, @function
+asm_builtin_xor_eq_i32:
+.LFB1797:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1797:
+	.size	asm_builtin_xor_eq_i32, .-asm_builtin_xor_eq_i32
+	.p2align 4
+	.globl	asm_opaque_xor_eq_i32
+	.type	asm_opaque_xor_eq_i32, @function
+asm_opaque_xor_eq_i32:
+.LFB1798:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1798:
+	.size	asm_opaque_xor_eq_i32, .-asm_opaque_xor_eq_i32
+	.p2align 4
+	.globl	asm_builtin_or_eq_i32
+	.type	asm_builtin_or_eq_i32, @function
+asm_builtin_or_eq_i32:
+.LFB1799:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1799:
+	.size	asm_builtin_or_eq_i32, .-asm_builtin_or_eq_i32
+	.p2align 4
+	.globl	asm_opaque_or_eq_i32
+	.type	asm_opaque_or_eq_i32, @function
+asm_opaque_or_eq_i32:
+.LFB1800:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1800:
+	.size	asm_opaque_or_eq_i32, .-asm_opaque_or_eq_i32
+	.p2align 4
+	.globl	asm_builtin_shl_i32
+	.type	asm_builtin_shl_i32, @function
+asm_builtin_shl_i32:
+.LFB1801:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1801:
+	.size	asm_builtin_shl_i32, .-asm_builtin_shl_i32
+	.p2align 4
+	.globl	asm_opaque_shl_i32
+	.type	asm_opaque_shl_i32, @function
+asm_opaque_shl_i32:
+.LFB1802:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1802:
+	.size	asm_opaque_shl_i32, .-asm_opaque_shl_i32
+	.p2align 4
+	.globl	asm_builtin_shr_i32
+	.type	asm_builtin_shr_i32, @function
+asm_builtin_shr_i32:
+.LFB1803:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sarl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1803:
+	.size	asm_builtin_shr_i32, .-asm_builtin_shr_i32
+	.p2align 4
+	.globl	asm_opaque_shr_i32
+	.type	asm_opaque_shr_i32, @function
+asm_opaque_shr_i32:
+.LFB1804:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sarl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1804:
+	.size	asm_opaque_shr_i32, .-asm_opaque_shr_i32
+	.p2align 4
+	.globl	asm_builtin_shl_eq_i32
+	.type	asm_builtin_shl_eq_i32, @function
+asm_builtin_shl_eq_i32:
+.LFB1805:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1805:
+	.size	asm_builtin_shl_eq_i32, .-asm_builtin_shl_eq_i32
+	.p2align 4
+	.globl	asm_opaque_shl_eq_i32
+	.type	asm_opaque_shl_eq_i32, @function
+asm_opaque_shl_eq_i32:
+.LFB1806:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1806:
+	.size	asm_opaque_shl_eq_i32, .-asm_opaque_shl_eq_i32
+	.p2align 4
+	.globl	asm_builtin_shr_eq_i32
+	.type	asm_builtin_shr_eq_i32, @function
+asm_builtin_shr_eq_i32:
+.LFB1807:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sarl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1807:
+	.size	asm_builtin_shr_eq_i32, .-asm_builtin_shr_eq_i32
+	.p2align 4
+	.globl	asm_opaque_shr_eq_i32
+	.type	asm_opaque_shr_eq_i32, @function
+asm_opaque_shr_eq_i32:
+.LFB1808:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sarl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE1808:
+	.size	asm_opaque_shr_eq_i32, .-asm_opaque_shr_eq_i32
+	.p2align 4
+	.globl	asm_builtin_compl_i32
+	.type	asm_builtin_compl_i32, @function
+asm_builtin_compl_i32:
+.LFB1809:
+	.cfi_startproc
+	movl	%edi, %eax
+	notl	%eax
+	ret
+	.cfi_endproc
+.LFE1809:
+	.size	asm_builtin_compl_i32, .-asm_builtin_compl_i32
+	.p2align 4
+	.globl	asm_opaque_compl_i32
+	.type	asm_opaque_compl_i32, @function
+asm_opaque_compl_i32:
+.LFB1810:
+	.cfi_startproc
+	movl	%edi, %eax
+	notl	%eax
+	ret
+	.cfi_endproc
+.LFE1810:
+	.size	asm_opaque_compl_i32, .-asm_opaque_compl_i32
+	.p2align 4
+	.globl	asm_builtin_mul_u32
+	.type	asm_builtin_mul_u32, @function
+asm_builtin_mul_u32:
+.LFB1811:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1811:
+	.size	asm_builtin_mul_u32, .-asm_builtin_mul_u32
+	.p2align 4
+	.globl	asm_opaque_mul_u32
+	.type	asm_opaque_mul_u32, @function
+asm_opaque_mul_u32:
+.LFB1812:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1812:
+	.size	asm_opaque_mul_u32, .-asm_opaque_mul_u32
+	.p2align 4
+	.globl	asm_builtin_div_u32
+	.type	asm_builtin_div_u32, @function
+asm_builtin_div_u32:
+.LFB1844:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	ret
+	.cfi_endproc
+.LFE1844:
+	.size	asm_builtin_div_u32, .-asm_builtin_div_u32
+	.p2align 4
+	.globl	asm_opaque_div_u32
+	.type	asm_opaque_div_u32, @function
+asm_opaque_div_u32:
+.LFB1845:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	ret
+	.cfi_endproc
+.LFE1845:
+	.size	asm_opaque_div_u32, .-asm_opaque_div_u32
+	.p2align 4
+	.globl	asm_builtin_add_u32
+	.type	asm_builtin_add_u32, @function
+asm_builtin_add_u32:
+.LFB1846:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1846:
+	.size	asm_builtin_add_u32, .-asm_builtin_add_u32
+	.p2align 4
+	.globl	asm_opaque_add_u32
+	.type	asm_opaque_add_u32, @function
+asm_opaque_add_u32:
+.LFB1847:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1847:
+	.size	asm_opaque_add_u32, .-asm_opaque_add_u32
+	.p2align 4
+	.globl	asm_builtin_sub_u32
+	.type	asm_builtin_sub_u32, @function
+asm_builtin_sub_u32:
+.LFB1856:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1856:
+	.size	asm_builtin_sub_u32, .-asm_builtin_sub_u32
+	.p2align 4
+	.globl	asm_opaque_sub_u32
+	.type	asm_opaque_sub_u32, @function
+asm_opaque_sub_u32:
+.LFB1857:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1857:
+	.size	asm_opaque_sub_u32, .-asm_opaque_sub_u32
+	.p2align 4
+	.globl	asm_builtin_mul_eq_u32
+	.type	asm_builtin_mul_eq_u32, @function
+asm_builtin_mul_eq_u32:
+.LFB1858:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1858:
+	.size	asm_builtin_mul_eq_u32, .-asm_builtin_mul_eq_u32
+	.p2align 4
+	.globl	asm_opaque_mul_eq_u32
+	.type	asm_opaque_mul_eq_u32, @function
+asm_opaque_mul_eq_u32:
+.LFB1859:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1859:
+	.size	asm_opaque_mul_eq_u32, .-asm_opaque_mul_eq_u32
+	.p2align 4
+	.globl	asm_builtin_div_eq_u32
+	.type	asm_builtin_div_eq_u32, @function
+asm_builtin_div_eq_u32:
+.LFB1860:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	ret
+	.cfi_endproc
+.LFE1860:
+	.size	asm_builtin_div_eq_u32, .-asm_builtin_div_eq_u32
+	.p2align 4
+	.globl	asm_opaque_div_eq_u32
+	.type	asm_opaque_div_eq_u32, @function
+asm_opaque_div_eq_u32:
+.LFB1861:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	ret
+	.cfi_endproc
+.LFE1861:
+	.size	asm_opaque_div_eq_u32, .-asm_opaque_div_eq_u32
+	.p2align 4
+	.globl	asm_builtin_add_eq_u32
+	.type	asm_builtin_add_eq_u32, @function
+asm_builtin_add_eq_u32:
+.LFB1862:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1862:
+	.size	asm_builtin_add_eq_u32, .-asm_builtin_add_eq_u32
+	.p2align 4
+	.globl	asm_opaque_add_eq_u32
+	.type	asm_opaque_add_eq_u32, @function
+asm_opaque_add_eq_u32:
+.LFB1863:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1863:
+	.size	asm_opaque_add_eq_u32, .-asm_opaque_add_eq_u32
+	.p2align 4
+	.globl	asm_builtin_sub_eq_u32
+	.type	asm_builtin_sub_eq_u32, @function
+asm_builtin_sub_eq_u32:
+.LFB1864:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1864:
+	.size	asm_builtin_sub_eq_u32, .-asm_builtin_sub_eq_u32
+	.p2align 4
+	.globl	asm_opaque_sub_eq_u32
+	.type	asm_opaque_sub_eq_u32, @function
+asm_opaque_sub_eq_u32:
+.LFB1865:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1865:
+	.size	asm_opaque_sub_eq_u32, .-asm_opaque_sub_eq_u32
+	.p2align 4
+	.globl	asm_builtin_pos_u32
+	.type	asm_builtin_pos_u32, @function
+asm_builtin_pos_u32:
+.LFB1866:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1866:
+	.size	asm_builtin_pos_u32, .-asm_builtin_pos_u32
+	.p2align 4
+	.globl	asm_opaque_pos_u32
+	.type	asm_opaque_pos_u32, @function
+asm_opaque_pos_u32:
+.LFB1867:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1867:
+	.size	asm_opaque_pos_u32, .-asm_opaque_pos_u32
+	.p2align 4
+	.globl	asm_builtin_neg_u32
+	.type	asm_builtin_neg_u32, @function
+asm_builtin_neg_u32:
+.LFB1868:
+	.cfi_startproc
+	movl	%edi, %eax
+	negl	%eax
+	ret
+	.cfi_endproc
+.LFE1868:
+	.size	asm_builtin_neg_u32, .-asm_builtin_neg_u32
+	.p2align 4
+	.globl	asm_opaque_neg_u32
+	.type	asm_opaque_neg_u32, @function
+asm_opaque_neg_u32:
+.LFB1869:
+	.cfi_startproc
+	movl	%edi, %eax
+	negl	%eax
+	ret
+	.cfi_endproc
+.LFE1869:
+	.size	asm_opaque_neg_u32, .-asm_opaque_neg_u32
+	.p2align 4
+	.globl	asm_builtin_preinc_u32
+	.type	asm_builtin_preinc_u32, @function
+asm_builtin_preinc_u32:
+.LFB1870:
+	.cfi_startproc
+	leal	1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1870:
+	.size	asm_builtin_preinc_u32, .-asm_builtin_preinc_u32
+	.p2align 4
+	.globl	asm_opaque_preinc_u32
+	.type	asm_opaque_preinc_u32, @function
+asm_opaque_preinc_u32:
+.LFB1871:
+	.cfi_startproc
+	leal	1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1871:
+	.size	asm_opaque_preinc_u32, .-asm_opaque_preinc_u32
+	.p2align 4
+	.globl	asm_builtin_predec_u32
+	.type	asm_builtin_predec_u32, @function
+asm_builtin_predec_u32:
+.LFB1872:
+	.cfi_startproc
+	leal	-1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1872:
+	.size	asm_builtin_predec_u32, .-asm_builtin_predec_u32
+	.p2align 4
+	.globl	asm_opaque_predec_u32
+	.type	asm_opaque_predec_u32, @function
+asm_opaque_predec_u32:
+.LFB1873:
+	.cfi_startproc
+	leal	-1(%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1873:
+	.size	asm_opaque_predec_u32, .-asm_opaque_predec_u32
+	.p2align 4
+	.globl	asm_builtin_postinc_u32
+	.type	asm_builtin_postinc_u32, @function
+asm_builtin_postinc_u32:
+.LFB1874:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1874:
+	.size	asm_builtin_postinc_u32, .-asm_builtin_postinc_u32
+	.p2align 4
+	.globl	asm_opaque_postinc_u32
+	.type	asm_opaque_postinc_u32, @function
+asm_opaque_postinc_u32:
+.LFB1875:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1875:
+	.size	asm_opaque_postinc_u32, .-asm_opaque_postinc_u32
+	.p2align 4
+	.globl	asm_builtin_postdec_u32
+	.type	asm_builtin_postdec_u32, @function
+asm_builtin_postdec_u32:
+.LFB1877:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1877:
+	.size	asm_builtin_postdec_u32, .-asm_builtin_postdec_u32
+	.p2align 4
+	.globl	asm_opaque_postdec_u32
+	.type	asm_opaque_postdec_u32, @function
+asm_opaque_postdec_u32:
+.LFB1878:
+	.cfi_startproc
+	movl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE1878:
+	.size	asm_opaque_postdec_u32, .-asm_opaque_postdec_u32
+	.p2align 4
+	.globl	asm_builtin_eq_u32
+	.type	asm_builtin_eq_u32, @function
+asm_builtin_eq_u32:
+.LFB1879:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1879:
+	.size	asm_builtin_eq_u32, .-asm_builtin_eq_u32
+	.p2align 4
+	.globl	asm_opaque_eq_u32
+	.type	asm_opaque_eq_u32, @function
+asm_opaque_eq_u32:
+.LFB1880:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1880:
+	.size	asm_opaque_eq_u32, .-asm_opaque_eq_u32
+	.p2align 4
+	.globl	asm_builtin_ne_u32
+	.type	asm_builtin_ne_u32, @function
+asm_builtin_ne_u32:
+.LFB1881:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1881:
+	.size	asm_builtin_ne_u32, .-asm_builtin_ne_u32
+	.p2align 4
+	.globl	asm_opaque_ne_u32
+	.type	asm_opaque_ne_u32, @function
+asm_opaque_ne_u32:
+.LFB1882:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1882:
+	.size	asm_opaque_ne_u32, .-asm_opaque_ne_u32
+	.p2align 4
+	.globl	asm_builtin_lt_u32
+	.type	asm_builtin_lt_u32, @function
+asm_builtin_lt_u32:
+.LFB1883:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setb	%al
+	ret
+	.cfi_endproc
+.LFE1883:
+	.size	asm_builtin_lt_u32, .-asm_builtin_lt_u32
+	.p2align 4
+	.globl	asm_opaque_lt_u32
+	.type	asm_opaque_lt_u32, @function
+asm_opaque_lt_u32:
+.LFB1884:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setb	%al
+	ret
+	.cfi_endproc
+.LFE1884:
+	.size	asm_opaque_lt_u32, .-asm_opaque_lt_u32
+	.p2align 4
+	.globl	asm_builtin_gt_u32
+	.type	asm_builtin_gt_u32, @function
+asm_builtin_gt_u32:
+.LFB1885:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setb	%al
+	ret
+	.cfi_endproc
+.LFE1885:
+	.size	asm_builtin_gt_u32, .-asm_builtin_gt_u32
+	.p2align 4
+	.globl	asm_opaque_gt_u32
+	.type	asm_opaque_gt_u32, @function
+asm_opaque_gt_u32:
+.LFB1886:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setb	%al
+	ret
+	.cfi_endproc
+.LFE1886:
+	.size	asm_opaque_gt_u32, .-asm_opaque_gt_u32
+	.p2align 4
+	.globl	asm_builtin_le_u32
+	.type	asm_builtin_le_u32, @function
+asm_builtin_le_u32:
+.LFB1887:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE1887:
+	.size	asm_builtin_le_u32, .-asm_builtin_le_u32
+	.p2align 4
+	.globl	asm_opaque_le_u32
+	.type	asm_opaque_le_u32, @function
+asm_opaque_le_u32:
+.LFB1888:
+	.cfi_startproc
+	cmpl	%edi, %esi
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE1888:
+	.size	asm_opaque_le_u32, .-asm_opaque_le_u32
+	.p2align 4
+	.globl	asm_builtin_ge_u32
+	.type	asm_builtin_ge_u32, @function
+asm_builtin_ge_u32:
+.LFB1889:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE1889:
+	.size	asm_builtin_ge_u32, .-asm_builtin_ge_u32
+	.p2align 4
+	.globl	asm_opaque_ge_u32
+	.type	asm_opaque_ge_u32, @function
+asm_opaque_ge_u32:
+.LFB1890:
+	.cfi_startproc
+	cmpl	%esi, %edi
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE1890:
+	.size	asm_opaque_ge_u32, .-asm_opaque_ge_u32
+	.p2align 4
+	.globl	asm_builtin_not_u32
+	.type	asm_builtin_not_u32, @function
+asm_builtin_not_u32:
+.LFB1891:
+	.cfi_startproc
+	testl	%edi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1891:
+	.size	asm_builtin_not_u32, .-asm_builtin_not_u32
+	.p2align 4
+	.globl	asm_opaque_not_u32
+	.type	asm_opaque_not_u32, @function
+asm_opaque_not_u32:
+.LFB1892:
+	.cfi_startproc
+	testl	%edi, %edi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE1892:
+	.size	asm_opaque_not_u32, .-asm_opaque_not_u32
+	.p2align 4
+	.globl	asm_builtin_bool_u32
+	.type	asm_builtin_bool_u32, @function
+asm_builtin_bool_u32:
+.LFB1893:
+	.cfi_startproc
+	testl	%edi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1893:
+	.size	asm_builtin_bool_u32, .-asm_builtin_bool_u32
+	.p2align 4
+	.globl	asm_opaque_bool_u32
+	.type	asm_opaque_bool_u32, @function
+asm_opaque_bool_u32:
+.LFB1894:
+	.cfi_startproc
+	testl	%edi, %edi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE1894:
+	.size	asm_opaque_bool_u32, .-asm_opaque_bool_u32
+	.p2align 4
+	.globl	asm_builtin_pos_add_dist_u32
+	.type	asm_builtin_pos_add_dist_u32, @function
+asm_builtin_pos_add_dist_u32:
+.LFB1895:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1895:
+	.size	asm_builtin_pos_add_dist_u32, .-asm_builtin_pos_add_dist_u32
+	.p2align 4
+	.globl	asm_opaque_pos_add_dist_u32
+	.type	asm_opaque_pos_add_dist_u32, @function
+asm_opaque_pos_add_dist_u32:
+.LFB1896:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1896:
+	.size	asm_opaque_pos_add_dist_u32, .-asm_opaque_pos_add_dist_u32
+	.p2align 4
+	.globl	asm_builtin_dist_add_pos_u32
+	.type	asm_builtin_dist_add_pos_u32, @function
+asm_builtin_dist_add_pos_u32:
+.LFB1918:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1918:
+	.size	asm_builtin_dist_add_pos_u32, .-asm_builtin_dist_add_pos_u32
+	.p2align 4
+	.globl	asm_opaque_dist_add_pos_u32
+	.type	asm_opaque_dist_add_pos_u32, @function
+asm_opaque_dist_add_pos_u32:
+.LFB1919:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1919:
+	.size	asm_opaque_dist_add_pos_u32, .-asm_opaque_dist_add_pos_u32
+	.p2align 4
+	.globl	asm_builtin_pos_sub_dist_u32
+	.type	asm_builtin_pos_sub_dist_u32, @function
+asm_builtin_pos_sub_dist_u32:
+.LFB1923:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1923:
+	.size	asm_builtin_pos_sub_dist_u32, .-asm_builtin_pos_sub_dist_u32
+	.p2align 4
+	.globl	asm_opaque_pos_sub_dist_u32
+	.type	asm_opaque_pos_sub_dist_u32, @function
+asm_opaque_pos_sub_dist_u32:
+.LFB1924:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1924:
+	.size	asm_opaque_pos_sub_dist_u32, .-asm_opaque_pos_sub_dist_u32
+	.p2align 4
+	.globl	asm_builtin_pos_sub_pos_u32
+	.type	asm_builtin_pos_sub_pos_u32, @function
+asm_builtin_pos_sub_pos_u32:
+.LFB1925:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1925:
+	.size	asm_builtin_pos_sub_pos_u32, .-asm_builtin_pos_sub_pos_u32
+	.p2align 4
+	.globl	asm_opaque_pos_sub_pos_u32
+	.type	asm_opaque_pos_sub_pos_u32, @function
+asm_opaque_pos_sub_pos_u32:
+.LFB1926:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1926:
+	.size	asm_opaque_pos_sub_pos_u32, .-asm_opaque_pos_sub_pos_u32
+	.p2align 4
+	.globl	asm_builtin_addr_add_off_u32
+	.type	asm_builtin_addr_add_off_u32, @function
+asm_builtin_addr_add_off_u32:
+.LFB1927:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE1927:
+	.size	asm_builtin_addr_add_off_u32, .-asm_builtin_addr_add_off_u32
+	.p2align 4
+	.globl	asm_opaque_addr_add_off_u32
+	.type	asm_opaque_addr_add_off_u32, @function
+asm_opaque_addr_add_off_u32:
+.LFB1928:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE1928:
+	.size	asm_opaque_addr_add_off_u32, .-asm_opaque_addr_add_off_u32
+	.p2align 4
+	.globl	asm_builtin_addr_sub_addr_u32
+	.type	asm_builtin_addr_sub_addr_u32, @function
+asm_builtin_addr_sub_addr_u32:
+.LFB1947:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1947:
+	.size	asm_builtin_addr_sub_addr_u32, .-asm_builtin_addr_sub_addr_u32
+	.p2align 4
+	.globl	asm_opaque_addr_sub_addr_u32
+	.type	asm_opaque_addr_sub_addr_u32, @function
+asm_opaque_addr_sub_addr_u32:
+.LFB1948:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE1948:
+	.size	asm_opaque_addr_sub_addr_u32, .-asm_opaque_addr_sub_addr_u32
+	.p2align 4
+	.globl	asm_builtin_chk_add_throw_u32
+	.type	asm_builtin_chk_add_throw_u32, @function
+asm_builtin_chk_add_throw_u32:
+.LFB1949:
+	.cfi_startproc
+	movl	%edi, %eax
+	addl	%esi, %eax
+	jc	.L286
+	ret
+.L286:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1949:
+	.size	asm_builtin_chk_add_throw_u32, .-asm_builtin_chk_add_throw_u32
+	.p2align 4
+	.globl	asm_opaque_chk_add_throw_u32
+	.type	asm_opaque_chk_add_throw_u32, @function
+asm_opaque_chk_add_throw_u32:
+.LFB1950:
+	.cfi_startproc
+	movl	%esi, %eax
+	addl	%edi, %eax
+	jc	.L295
+	ret
+.L295:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1950:
+	.size	asm_opaque_chk_add_throw_u32, .-asm_opaque_chk_add_throw_u32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_throw_u32
+	.type	asm_builtin_chk_sub_throw_u32, @function
+asm_builtin_chk_sub_throw_u32:
+.LFB1983:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jb	.L304
+	ret
+.L304:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1983:
+	.size	asm_builtin_chk_sub_throw_u32, .-asm_builtin_chk_sub_throw_u32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_throw_u32
+	.type	asm_opaque_chk_sub_throw_u32, @function
+asm_opaque_chk_sub_throw_u32:
+.LFB1984:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jb	.L313
+	ret
+.L313:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1984:
+	.size	asm_opaque_chk_sub_throw_u32, .-asm_opaque_chk_sub_throw_u32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_throw_u32
+	.type	asm_builtin_chk_mul_throw_u32, @function
+asm_builtin_chk_mul_throw_u32:
+.LFB1985:
+	.cfi_startproc
+	movl	%edi, %eax
+	mull	%esi
+	jo	.L322
+	ret
+.L322:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1985:
+	.size	asm_builtin_chk_mul_throw_u32, .-asm_builtin_chk_mul_throw_u32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_throw_u32
+	.type	asm_opaque_chk_mul_throw_u32, @function
+asm_opaque_chk_mul_throw_u32:
+.LFB1986:
+	.cfi_startproc
+	movl	%esi, %eax
+	mull	%edi
+	jo	.L331
+	ret
+.L331:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE1986:
+	.size	asm_opaque_chk_mul_throw_u32, .-asm_opaque_chk_mul_throw_u32
+	.p2align 4
+	.globl	asm_builtin_chk_add_saturate_u32
+	.type	asm_builtin_chk_add_saturate_u32, @function
+asm_builtin_chk_add_saturate_u32:
+.LFB1995:
+	.cfi_startproc
+	addl	%esi, %edi
+	jc	.L334
+	movl	%edi, %eax
+	ret
+.L334:
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE1995:
+	.size	asm_builtin_chk_add_saturate_u32, .-asm_builtin_chk_add_saturate_u32
+	.p2align 4
+	.globl	asm_opaque_chk_add_saturate_u32
+	.type	asm_opaque_chk_add_saturate_u32, @function
+asm_opaque_chk_add_saturate_u32:
+.LFB1996:
+	.cfi_startproc
+	addl	%edi, %esi
+	jc	.L339
+	movl	%esi, %eax
+	ret
+.L339:
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE1996:
+	.size	asm_opaque_chk_add_saturate_u32, .-asm_opaque_chk_add_saturate_u32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_saturate_u32
+	.type	asm_builtin_chk_sub_saturate_u32, @function
+asm_builtin_chk_sub_saturate_u32:
+.LFB2029:
+	.cfi_startproc
+	subl	%esi, %edi
+	movl	$0, %eax
+	cmovnb	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2029:
+	.size	asm_builtin_chk_sub_saturate_u32, .-asm_builtin_chk_sub_saturate_u32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_saturate_u32
+	.type	asm_opaque_chk_sub_saturate_u32, @function
+asm_opaque_chk_sub_saturate_u32:
+.LFB2030:
+	.cfi_startproc
+	subl	%esi, %edi
+	movl	$0, %eax
+	cmovnb	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2030:
+	.size	asm_opaque_chk_sub_saturate_u32, .-asm_opaque_chk_sub_saturate_u32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_saturate_u32
+	.type	asm_builtin_chk_mul_saturate_u32, @function
+asm_builtin_chk_mul_saturate_u32:
+.LFB2031:
+	.cfi_startproc
+	movl	%edi, %eax
+	mull	%esi
+	jo	.L357
+	ret
+.L357:
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE2031:
+	.size	asm_builtin_chk_mul_saturate_u32, .-asm_builtin_chk_mul_saturate_u32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_saturate_u32
+	.type	asm_opaque_chk_mul_saturate_u32, @function
+asm_opaque_chk_mul_saturate_u32:
+.LFB2032:
+	.cfi_startproc
+	movl	%esi, %eax
+	mull	%edi
+	jo	.L363
+	ret
+.L363:
+	orl	$-1, %eax
+	ret
+	.cfi_endproc
+.LFE2032:
+	.size	asm_opaque_chk_mul_saturate_u32, .-asm_opaque_chk_mul_saturate_u32
+	.p2align 4
+	.globl	asm_builtin_chk_add_wrap_u32
+	.type	asm_builtin_chk_add_wrap_u32, @function
+asm_builtin_chk_add_wrap_u32:
+.LFB2041:
+	.cfi_startproc
+	leal	(%rdi,%rsi), %eax
+	ret
+	.cfi_endproc
+.LFE2041:
+	.size	asm_builtin_chk_add_wrap_u32, .-asm_builtin_chk_add_wrap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_add_wrap_u32
+	.type	asm_opaque_chk_add_wrap_u32, @function
+asm_opaque_chk_add_wrap_u32:
+.LFB2042:
+	.cfi_startproc
+	leal	(%rsi,%rdi), %eax
+	ret
+	.cfi_endproc
+.LFE2042:
+	.size	asm_opaque_chk_add_wrap_u32, .-asm_opaque_chk_add_wrap_u32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_wrap_u32
+	.type	asm_builtin_chk_sub_wrap_u32, @function
+asm_builtin_chk_sub_wrap_u32:
+.LFB2075:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2075:
+	.size	asm_builtin_chk_sub_wrap_u32, .-asm_builtin_chk_sub_wrap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_wrap_u32
+	.type	asm_opaque_chk_sub_wrap_u32, @function
+asm_opaque_chk_sub_wrap_u32:
+.LFB2076:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2076:
+	.size	asm_opaque_chk_sub_wrap_u32, .-asm_opaque_chk_sub_wrap_u32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_wrap_u32
+	.type	asm_builtin_chk_mul_wrap_u32, @function
+asm_builtin_chk_mul_wrap_u32:
+.LFB2077:
+	.cfi_startproc
+	movl	%edi, %eax
+	imull	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2077:
+	.size	asm_builtin_chk_mul_wrap_u32, .-asm_builtin_chk_mul_wrap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_wrap_u32
+	.type	asm_opaque_chk_mul_wrap_u32, @function
+asm_opaque_chk_mul_wrap_u32:
+.LFB2078:
+	.cfi_startproc
+	movl	%esi, %eax
+	imull	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2078:
+	.size	asm_opaque_chk_mul_wrap_u32, .-asm_opaque_chk_mul_wrap_u32
+	.p2align 4
+	.globl	asm_builtin_chk_add_trap_u32
+	.type	asm_builtin_chk_add_trap_u32, @function
+asm_builtin_chk_add_trap_u32:
+.LFB2087:
+	.cfi_startproc
+	movl	%edi, %eax
+	addl	%esi, %eax
+	jc	.L375
+	ret
+.L375:
+	ud2
+	.cfi_endproc
+.LFE2087:
+	.size	asm_builtin_chk_add_trap_u32, .-asm_builtin_chk_add_trap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_add_trap_u32
+	.type	asm_opaque_chk_add_trap_u32, @function
+asm_opaque_chk_add_trap_u32:
+.LFB2088:
+	.cfi_startproc
+	movl	%esi, %eax
+	addl	%edi, %eax
+	jc	.L381
+	ret
+.L381:
+	ud2
+	.cfi_endproc
+.LFE2088:
+	.size	asm_opaque_chk_add_trap_u32, .-asm_opaque_chk_add_trap_u32
+	.p2align 4
+	.globl	asm_builtin_chk_sub_trap_u32
+	.type	asm_builtin_chk_sub_trap_u32, @function
+asm_builtin_chk_sub_trap_u32:
+.LFB2121:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jb	.L387
+	ret
+.L387:
+	ud2
+	.cfi_endproc
+.LFE2121:
+	.size	asm_builtin_chk_sub_trap_u32, .-asm_builtin_chk_sub_trap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_sub_trap_u32
+	.type	asm_opaque_chk_sub_trap_u32, @function
+asm_opaque_chk_sub_trap_u32:
+.LFB2122:
+	.cfi_startproc
+	movl	%edi, %eax
+	subl	%esi, %eax
+	jb	.L393
+	ret
+.L393:
+	ud2
+	.cfi_endproc
+.LFE2122:
+	.size	asm_opaque_chk_sub_trap_u32, .-asm_opaque_chk_sub_trap_u32
+	.p2align 4
+	.globl	asm_builtin_chk_mul_trap_u32
+	.type	asm_builtin_chk_mul_trap_u32, @function
+asm_builtin_chk_mul_trap_u32:
+.LFB2123:
+	.cfi_startproc
+	movl	%edi, %eax
+	mull	%esi
+	jo	.L399
+	ret
+.L399:
+	ud2
+	.cfi_endproc
+.LFE2123:
+	.size	asm_builtin_chk_mul_trap_u32, .-asm_builtin_chk_mul_trap_u32
+	.p2align 4
+	.globl	asm_opaque_chk_mul_trap_u32
+	.type	asm_opaque_chk_mul_trap_u32, @function
+asm_opaque_chk_mul_trap_u32:
+.LFB2124:
+	.cfi_startproc
+	movl	%esi, %eax
+	mull	%edi
+	jo	.L405
+	ret
+.L405:
+	ud2
+	.cfi_endproc
+.LFE2124:
+	.size	asm_opaque_chk_mul_trap_u32, .-asm_opaque_chk_mul_trap_u32
+	.p2align 4
+	.globl	asm_builtin_mod_u32
+	.type	asm_builtin_mod_u32, @function
+asm_builtin_mod_u32:
+.LFB2133:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2133:
+	.size	asm_builtin_mod_u32, .-asm_builtin_mod_u32
+	.p2align 4
+	.globl	asm_opaque_mod_u32
+	.type	asm_opaque_mod_u32, @function
+asm_opaque_mod_u32:
+.LFB2134:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2134:
+	.size	asm_opaque_mod_u32, .-asm_opaque_mod_u32
+	.p2align 4
+	.globl	asm_builtin_and_u32
+	.type	asm_builtin_and_u32, @function
+asm_builtin_and_u32:
+.LFB2135:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2135:
+	.size	asm_builtin_and_u32, .-asm_builtin_and_u32
+	.p2align 4
+	.globl	asm_opaque_and_u32
+	.type	asm_opaque_and_u32, @function
+asm_opaque_and_u32:
+.LFB2136:
+	.cfi_startproc
+	movl	%esi, %eax
+	andl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2136:
+	.size	asm_opaque_and_u32, .-asm_opaque_and_u32
+	.p2align 4
+	.globl	asm_builtin_xor_u32
+	.type	asm_builtin_xor_u32, @function
+asm_builtin_xor_u32:
+.LFB2145:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2145:
+	.size	asm_builtin_xor_u32, .-asm_builtin_xor_u32
+	.p2align 4
+	.globl	asm_opaque_xor_u32
+	.type	asm_opaque_xor_u32, @function
+asm_opaque_xor_u32:
+.LFB2146:
+	.cfi_startproc
+	movl	%esi, %eax
+	xorl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2146:
+	.size	asm_opaque_xor_u32, .-asm_opaque_xor_u32
+	.p2align 4
+	.globl	asm_builtin_or_u32
+	.type	asm_builtin_or_u32, @function
+asm_builtin_or_u32:
+.LFB2155:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2155:
+	.size	asm_builtin_or_u32, .-asm_builtin_or_u32
+	.p2align 4
+	.globl	asm_opaque_or_u32
+	.type	asm_opaque_or_u32, @function
+asm_opaque_or_u32:
+.LFB2156:
+	.cfi_startproc
+	movl	%esi, %eax
+	orl	%edi, %eax
+	ret
+	.cfi_endproc
+.LFE2156:
+	.size	asm_opaque_or_u32, .-asm_opaque_or_u32
+	.p2align 4
+	.globl	asm_builtin_mod_eq_u32
+	.type	asm_builtin_mod_eq_u32, @function
+asm_builtin_mod_eq_u32:
+.LFB2165:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2165:
+	.size	asm_builtin_mod_eq_u32, .-asm_builtin_mod_eq_u32
+	.p2align 4
+	.globl	asm_opaque_mod_eq_u32
+	.type	asm_opaque_mod_eq_u32, @function
+asm_opaque_mod_eq_u32:
+.LFB2166:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%edx, %edx
+	divl	%esi
+	movl	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2166:
+	.size	asm_opaque_mod_eq_u32, .-asm_opaque_mod_eq_u32
+	.p2align 4
+	.globl	asm_builtin_and_eq_u32
+	.type	asm_builtin_and_eq_u32, @function
+asm_builtin_and_eq_u32:
+.LFB2167:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2167:
+	.size	asm_builtin_and_eq_u32, .-asm_builtin_and_eq_u32
+	.p2align 4
+	.globl	asm_opaque_and_eq_u32
+	.type	asm_opaque_and_eq_u32, @function
+asm_opaque_and_eq_u32:
+.LFB2168:
+	.cfi_startproc
+	movl	%edi, %eax
+	andl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2168:
+	.size	asm_opaque_and_eq_u32, .-asm_opaque_and_eq_u32
+	.p2align 4
+	.globl	asm_builtin_xor_eq_u32
+	.type	asm_builtin_xor_eq_u32, @function
+asm_builtin_xor_eq_u32:
+.LFB2169:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2169:
+	.size	asm_builtin_xor_eq_u32, .-asm_builtin_xor_eq_u32
+	.p2align 4
+	.globl	asm_opaque_xor_eq_u32
+	.type	asm_opaque_xor_eq_u32, @function
+asm_opaque_xor_eq_u32:
+.LFB2170:
+	.cfi_startproc
+	movl	%edi, %eax
+	xorl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2170:
+	.size	asm_opaque_xor_eq_u32, .-asm_opaque_xor_eq_u32
+	.p2align 4
+	.globl	asm_builtin_or_eq_u32
+	.type	asm_builtin_or_eq_u32, @function
+asm_builtin_or_eq_u32:
+.LFB2171:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2171:
+	.size	asm_builtin_or_eq_u32, .-asm_builtin_or_eq_u32
+	.p2align 4
+	.globl	asm_opaque_or_eq_u32
+	.type	asm_opaque_or_eq_u32, @function
+asm_opaque_or_eq_u32:
+.LFB2172:
+	.cfi_startproc
+	movl	%edi, %eax
+	orl	%esi, %eax
+	ret
+	.cfi_endproc
+.LFE2172:
+	.size	asm_opaque_or_eq_u32, .-asm_opaque_or_eq_u32
+	.p2align 4
+	.globl	asm_builtin_shl_u32
+	.type	asm_builtin_shl_u32, @function
+asm_builtin_shl_u32:
+.LFB2173:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2173:
+	.size	asm_builtin_shl_u32, .-asm_builtin_shl_u32
+	.p2align 4
+	.globl	asm_opaque_shl_u32
+	.type	asm_opaque_shl_u32, @function
+asm_opaque_shl_u32:
+.LFB2174:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2174:
+	.size	asm_opaque_shl_u32, .-asm_opaque_shl_u32
+	.p2align 4
+	.globl	asm_builtin_shr_u32
+	.type	asm_builtin_shr_u32, @function
+asm_builtin_shr_u32:
+.LFB2175:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	shrl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2175:
+	.size	asm_builtin_shr_u32, .-asm_builtin_shr_u32
+	.p2align 4
+	.globl	asm_opaque_shr_u32
+	.type	asm_opaque_shr_u32, @function
+asm_opaque_shr_u32:
+.LFB2176:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	shrl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2176:
+	.size	asm_opaque_shr_u32, .-asm_opaque_shr_u32
+	.p2align 4
+	.globl	asm_builtin_shl_eq_u32
+	.type	asm_builtin_shl_eq_u32, @function
+asm_builtin_shl_eq_u32:
+.LFB2177:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2177:
+	.size	asm_builtin_shl_eq_u32, .-asm_builtin_shl_eq_u32
+	.p2align 4
+	.globl	asm_opaque_shl_eq_u32
+	.type	asm_opaque_shl_eq_u32, @function
+asm_opaque_shl_eq_u32:
+.LFB2178:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	sall	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2178:
+	.size	asm_opaque_shl_eq_u32, .-asm_opaque_shl_eq_u32
+	.p2align 4
+	.globl	asm_builtin_shr_eq_u32
+	.type	asm_builtin_shr_eq_u32, @function
+asm_builtin_shr_eq_u32:
+.LFB2179:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	shrl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2179:
+	.size	asm_builtin_shr_eq_u32, .-asm_builtin_shr_eq_u32
+	.p2align 4
+	.globl	asm_opaque_shr_eq_u32
+	.type	asm_opaque_shr_eq_u32, @function
+asm_opaque_shr_eq_u32:
+.LFB2180:
+	.cfi_startproc
+	movl	%edi, %eax
+	movl	%esi, %ecx
+	shrl	%cl, %eax
+	ret
+	.cfi_endproc
+.LFE2180:
+	.size	asm_opaque_shr_eq_u32, .-asm_opaque_shr_eq_u32
+	.p2align 4
+	.globl	asm_builtin_compl_u32
+	.type	asm_builtin_compl_u32, @function
+asm_builtin_compl_u32:
+.LFB2181:
+	.cfi_startproc
+	movl	%edi, %eax
+	notl	%eax
+	ret
+	.cfi_endproc
+.LFE2181:
+	.size	asm_builtin_compl_u32, .-asm_builtin_compl_u32
+	.p2align 4
+	.globl	asm_opaque_compl_u32
+	.type	asm_opaque_compl_u32, @function
+asm_opaque_compl_u32:
+.LFB2182:
+	.cfi_startproc
+	movl	%edi, %eax
+	notl	%eax
+	ret
+	.cfi_endproc
+.LFE2182:
+	.size	asm_opaque_compl_u32, .-asm_opaque_compl_u32
+	.p2align 4
+	.globl	asm_builtin_mul_i64
+	.type	asm_builtin_mul_i64, @function
+asm_builtin_mul_i64:
+.LFB2183:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2183:
+	.size	asm_builtin_mul_i64, .-asm_builtin_mul_i64
+	.p2align 4
+	.globl	asm_opaque_mul_i64
+	.type	asm_opaque_mul_i64, @function
+asm_opaque_mul_i64:
+.LFB2184:
+	.cfi_startproc
+	movq	%rsi, %rax
+	imulq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2184:
+	.size	asm_opaque_mul_i64, .-asm_opaque_mul_i64
+	.p2align 4
+	.globl	asm_builtin_div_i64
+	.type	asm_builtin_div_i64, @function
+asm_builtin_div_i64:
+.LFB2216:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	ret
+	.cfi_endproc
+.LFE2216:
+	.size	asm_builtin_div_i64, .-asm_builtin_div_i64
+	.p2align 4
+	.globl	asm_opaque_div_i64
+	.type	asm_opaque_div_i64, @function
+asm_opaque_div_i64:
+.LFB2217:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	ret
+	.cfi_endproc
+.LFE2217:
+	.size	asm_opaque_div_i64, .-asm_opaque_div_i64
+	.p2align 4
+	.globl	asm_builtin_add_i64
+	.type	asm_builtin_add_i64, @function
+asm_builtin_add_i64:
+.LFB2218:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2218:
+	.size	asm_builtin_add_i64, .-asm_builtin_add_i64
+	.p2align 4
+	.globl	asm_opaque_add_i64
+	.type	asm_opaque_add_i64, @function
+asm_opaque_add_i64:
+.LFB2219:
+	.cfi_startproc
+	leaq	(%rsi,%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2219:
+	.size	asm_opaque_add_i64, .-asm_opaque_add_i64
+	.p2align 4
+	.globl	asm_builtin_sub_i64
+	.type	asm_builtin_sub_i64, @function
+asm_builtin_sub_i64:
+.LFB2228:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2228:
+	.size	asm_builtin_sub_i64, .-asm_builtin_sub_i64
+	.p2align 4
+	.globl	asm_opaque_sub_i64
+	.type	asm_opaque_sub_i64, @function
+asm_opaque_sub_i64:
+.LFB2229:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2229:
+	.size	asm_opaque_sub_i64, .-asm_opaque_sub_i64
+	.p2align 4
+	.globl	asm_builtin_mul_eq_i64
+	.type	asm_builtin_mul_eq_i64, @function
+asm_builtin_mul_eq_i64:
+.LFB2230:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2230:
+	.size	asm_builtin_mul_eq_i64, .-asm_builtin_mul_eq_i64
+	.p2align 4
+	.globl	asm_opaque_mul_eq_i64
+	.type	asm_opaque_mul_eq_i64, @function
+asm_opaque_mul_eq_i64:
+.LFB2231:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2231:
+	.size	asm_opaque_mul_eq_i64, .-asm_opaque_mul_eq_i64
+	.p2align 4
+	.globl	asm_builtin_div_eq_i64
+	.type	asm_builtin_div_eq_i64, @function
+asm_builtin_div_eq_i64:
+.LFB2232:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	ret
+	.cfi_endproc
+.LFE2232:
+	.size	asm_builtin_div_eq_i64, .-asm_builtin_div_eq_i64
+	.p2align 4
+	.globl	asm_opaque_div_eq_i64
+	.type	asm_opaque_div_eq_i64, @function
+asm_opaque_div_eq_i64:
+.LFB2233:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	ret
+	.cfi_endproc
+.LFE2233:
+	.size	asm_opaque_div_eq_i64, .-asm_opaque_div_eq_i64
+	.p2align 4
+	.globl	asm_builtin_add_eq_i64
+	.type	asm_builtin_add_eq_i64, @function
+asm_builtin_add_eq_i64:
+.LFB2234:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2234:
+	.size	asm_builtin_add_eq_i64, .-asm_builtin_add_eq_i64
+	.p2align 4
+	.globl	asm_opaque_add_eq_i64
+	.type	asm_opaque_add_eq_i64, @function
+asm_opaque_add_eq_i64:
+.LFB2235:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2235:
+	.size	asm_opaque_add_eq_i64, .-asm_opaque_add_eq_i64
+	.p2align 4
+	.globl	asm_builtin_sub_eq_i64
+	.type	asm_builtin_sub_eq_i64, @function
+asm_builtin_sub_eq_i64:
+.LFB2236:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2236:
+	.size	asm_builtin_sub_eq_i64, .-asm_builtin_sub_eq_i64
+	.p2align 4
+	.globl	asm_opaque_sub_eq_i64
+	.type	asm_opaque_sub_eq_i64, @function
+asm_opaque_sub_eq_i64:
+.LFB2237:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2237:
+	.size	asm_opaque_sub_eq_i64, .-asm_opaque_sub_eq_i64
+	.p2align 4
+	.globl	asm_builtin_pos_i64
+	.type	asm_builtin_pos_i64, @function
+asm_builtin_pos_i64:
+.LFB2238:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2238:
+	.size	asm_builtin_pos_i64, .-asm_builtin_pos_i64
+	.p2align 4
+	.globl	asm_opaque_pos_i64
+	.type	asm_opaque_pos_i64, @function
+asm_opaque_pos_i64:
+.LFB2239:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2239:
+	.size	asm_opaque_pos_i64, .-asm_opaque_pos_i64
+	.p2align 4
+	.globl	asm_builtin_neg_i64
+	.type	asm_builtin_neg_i64, @function
+asm_builtin_neg_i64:
+.LFB2240:
+	.cfi_startproc
+	movq	%rdi, %rax
+	negq	%rax
+	ret
+	.cfi_endproc
+.LFE2240:
+	.size	asm_builtin_neg_i64, .-asm_builtin_neg_i64
+	.p2align 4
+	.globl	asm_opaque_neg_i64
+	.type	asm_opaque_neg_i64, @function
+asm_opaque_neg_i64:
+.LFB2241:
+	.cfi_startproc
+	movq	%rdi, %rax
+	negq	%rax
+	ret
+	.cfi_endproc
+.LFE2241:
+	.size	asm_opaque_neg_i64, .-asm_opaque_neg_i64
+	.p2align 4
+	.globl	asm_builtin_preinc_i64
+	.type	asm_builtin_preinc_i64, @function
+asm_builtin_preinc_i64:
+.LFB2242:
+	.cfi_startproc
+	leaq	1(%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2242:
+	.size	asm_builtin_preinc_i64, .-asm_builtin_preinc_i64
+	.p2align 4
+	.globl	asm_opaque_preinc_i64
+	.type	asm_opaque_preinc_i64, @function
+asm_opaque_preinc_i64:
+.LFB2243:
+	.cfi_startproc
+	leaq	1(%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2243:
+	.size	asm_opaque_preinc_i64, .-asm_opaque_preinc_i64
+	.p2align 4
+	.globl	asm_builtin_predec_i64
+	.type	asm_builtin_predec_i64, @function
+asm_builtin_predec_i64:
+.LFB2244:
+	.cfi_startproc
+	leaq	-1(%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2244:
+	.size	asm_builtin_predec_i64, .-asm_builtin_predec_i64
+	.p2align 4
+	.globl	asm_opaque_predec_i64
+	.type	asm_opaque_predec_i64, @function
+asm_opaque_predec_i64:
+.LFB2245:
+	.cfi_startproc
+	leaq	-1(%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2245:
+	.size	asm_opaque_predec_i64, .-asm_opaque_predec_i64
+	.p2align 4
+	.globl	asm_builtin_postinc_i64
+	.type	asm_builtin_postinc_i64, @function
+asm_builtin_postinc_i64:
+.LFB2246:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2246:
+	.size	asm_builtin_postinc_i64, .-asm_builtin_postinc_i64
+	.p2align 4
+	.globl	asm_opaque_postinc_i64
+	.type	asm_opaque_postinc_i64, @function
+asm_opaque_postinc_i64:
+.LFB2247:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2247:
+	.size	asm_opaque_postinc_i64, .-asm_opaque_postinc_i64
+	.p2align 4
+	.globl	asm_builtin_postdec_i64
+	.type	asm_builtin_postdec_i64, @function
+asm_builtin_postdec_i64:
+.LFB2249:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2249:
+	.size	asm_builtin_postdec_i64, .-asm_builtin_postdec_i64
+	.p2align 4
+	.globl	asm_opaque_postdec_i64
+	.type	asm_opaque_postdec_i64, @function
+asm_opaque_postdec_i64:
+.LFB2250:
+	.cfi_startproc
+	movq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2250:
+	.size	asm_opaque_postdec_i64, .-asm_opaque_postdec_i64
+	.p2align 4
+	.globl	asm_builtin_eq_i64
+	.type	asm_builtin_eq_i64, @function
+asm_builtin_eq_i64:
+.LFB2251:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE2251:
+	.size	asm_builtin_eq_i64, .-asm_builtin_eq_i64
+	.p2align 4
+	.globl	asm_opaque_eq_i64
+	.type	asm_opaque_eq_i64, @function
+asm_opaque_eq_i64:
+.LFB2252:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE2252:
+	.size	asm_opaque_eq_i64, .-asm_opaque_eq_i64
+	.p2align 4
+	.globl	asm_builtin_ne_i64
+	.type	asm_builtin_ne_i64, @function
+asm_builtin_ne_i64:
+.LFB2253:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE2253:
+	.size	asm_builtin_ne_i64, .-asm_builtin_ne_i64
+	.p2align 4
+	.globl	asm_opaque_ne_i64
+	.type	asm_opaque_ne_i64, @function
+asm_opaque_ne_i64:
+.LFB2254:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE2254:
+	.size	asm_opaque_ne_i64, .-asm_opaque_ne_i64
+	.p2align 4
+	.globl	asm_builtin_lt_i64
+	.type	asm_builtin_lt_i64, @function
+asm_builtin_lt_i64:
+.LFB2255:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	setl	%al
+	ret
+	.cfi_endproc
+.LFE2255:
+	.size	asm_builtin_lt_i64, .-asm_builtin_lt_i64
+	.p2align 4
+	.globl	asm_opaque_lt_i64
+	.type	asm_opaque_lt_i64, @function
+asm_opaque_lt_i64:
+.LFB2256:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	setg	%al
+	ret
+	.cfi_endproc
+.LFE2256:
+	.size	asm_opaque_lt_i64, .-asm_opaque_lt_i64
+	.p2align 4
+	.globl	asm_builtin_gt_i64
+	.type	asm_builtin_gt_i64, @function
+asm_builtin_gt_i64:
+.LFB2257:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	setg	%al
+	ret
+	.cfi_endproc
+.LFE2257:
+	.size	asm_builtin_gt_i64, .-asm_builtin_gt_i64
+	.p2align 4
+	.globl	asm_opaque_gt_i64
+	.type	asm_opaque_gt_i64, @function
+asm_opaque_gt_i64:
+.LFB2258:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	setl	%al
+	ret
+	.cfi_endproc
+.LFE2258:
+	.size	asm_opaque_gt_i64, .-asm_opaque_gt_i64
+	.p2align 4
+	.globl	asm_builtin_le_i64
+	.type	asm_builtin_le_i64, @function
+asm_builtin_le_i64:
+.LFB2259:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	setle	%al
+	ret
+	.cfi_endproc
+.LFE2259:
+	.size	asm_builtin_le_i64, .-asm_builtin_le_i64
+	.p2align 4
+	.globl	asm_opaque_le_i64
+	.type	asm_opaque_le_i64, @function
+asm_opaque_le_i64:
+.LFB2260:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	setge	%al
+	ret
+	.cfi_endproc
+.LFE2260:
+	.size	asm_opaque_le_i64, .-asm_opaque_le_i64
+	.p2align 4
+	.globl	asm_builtin_ge_i64
+	.type	asm_builtin_ge_i64, @function
+asm_builtin_ge_i64:
+.LFB2261:
+	.cfi_startproc
+	cmpq	%rsi, %rdi
+	setge	%al
+	ret
+	.cfi_endproc
+.LFE2261:
+	.size	asm_builtin_ge_i64, .-asm_builtin_ge_i64
+	.p2align 4
+	.globl	asm_opaque_ge_i64
+	.type	asm_opaque_ge_i64, @function
+asm_opaque_ge_i64:
+.LFB2262:
+	.cfi_startproc
+	cmpq	%rdi, %rsi
+	setle	%al
+	ret
+	.cfi_endproc
+.LFE2262:
+	.size	asm_opaque_ge_i64, .-asm_opaque_ge_i64
+	.p2align 4
+	.globl	asm_builtin_not_i64
+	.type	asm_builtin_not_i64, @function
+asm_builtin_not_i64:
+.LFB2263:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE2263:
+	.size	asm_builtin_not_i64, .-asm_builtin_not_i64
+	.p2align 4
+	.globl	asm_opaque_not_i64
+	.type	asm_opaque_not_i64, @function
+asm_opaque_not_i64:
+.LFB2264:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	sete	%al
+	ret
+	.cfi_endproc
+.LFE2264:
+	.size	asm_opaque_not_i64, .-asm_opaque_not_i64
+	.p2align 4
+	.globl	asm_builtin_bool_i64
+	.type	asm_builtin_bool_i64, @function
+asm_builtin_bool_i64:
+.LFB2265:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE2265:
+	.size	asm_builtin_bool_i64, .-asm_builtin_bool_i64
+	.p2align 4
+	.globl	asm_opaque_bool_i64
+	.type	asm_opaque_bool_i64, @function
+asm_opaque_bool_i64:
+.LFB2266:
+	.cfi_startproc
+	testq	%rdi, %rdi
+	setne	%al
+	ret
+	.cfi_endproc
+.LFE2266:
+	.size	asm_opaque_bool_i64, .-asm_opaque_bool_i64
+	.p2align 4
+	.globl	asm_builtin_pos_add_dist_i64
+	.type	asm_builtin_pos_add_dist_i64, @function
+asm_builtin_pos_add_dist_i64:
+.LFB2267:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2267:
+	.size	asm_builtin_pos_add_dist_i64, .-asm_builtin_pos_add_dist_i64
+	.p2align 4
+	.globl	asm_opaque_pos_add_dist_i64
+	.type	asm_opaque_pos_add_dist_i64, @function
+asm_opaque_pos_add_dist_i64:
+.LFB2268:
+	.cfi_startproc
+	leaq	(%rsi,%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2268:
+	.size	asm_opaque_pos_add_dist_i64, .-asm_opaque_pos_add_dist_i64
+	.p2align 4
+	.globl	asm_builtin_dist_add_pos_i64
+	.type	asm_builtin_dist_add_pos_i64, @function
+asm_builtin_dist_add_pos_i64:
+.LFB2290:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2290:
+	.size	asm_builtin_dist_add_pos_i64, .-asm_builtin_dist_add_pos_i64
+	.p2align 4
+	.globl	asm_opaque_dist_add_pos_i64
+	.type	asm_opaque_dist_add_pos_i64, @function
+asm_opaque_dist_add_pos_i64:
+.LFB2291:
+	.cfi_startproc
+	leaq	(%rsi,%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2291:
+	.size	asm_opaque_dist_add_pos_i64, .-asm_opaque_dist_add_pos_i64
+	.p2align 4
+	.globl	asm_builtin_pos_sub_dist_i64
+	.type	asm_builtin_pos_sub_dist_i64, @function
+asm_builtin_pos_sub_dist_i64:
+.LFB2295:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2295:
+	.size	asm_builtin_pos_sub_dist_i64, .-asm_builtin_pos_sub_dist_i64
+	.p2align 4
+	.globl	asm_opaque_pos_sub_dist_i64
+	.type	asm_opaque_pos_sub_dist_i64, @function
+asm_opaque_pos_sub_dist_i64:
+.LFB2296:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2296:
+	.size	asm_opaque_pos_sub_dist_i64, .-asm_opaque_pos_sub_dist_i64
+	.p2align 4
+	.globl	asm_builtin_pos_sub_pos_i64
+	.type	asm_builtin_pos_sub_pos_i64, @function
+asm_builtin_pos_sub_pos_i64:
+.LFB2297:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2297:
+	.size	asm_builtin_pos_sub_pos_i64, .-asm_builtin_pos_sub_pos_i64
+	.p2align 4
+	.globl	asm_opaque_pos_sub_pos_i64
+	.type	asm_opaque_pos_sub_pos_i64, @function
+asm_opaque_pos_sub_pos_i64:
+.LFB2298:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2298:
+	.size	asm_opaque_pos_sub_pos_i64, .-asm_opaque_pos_sub_pos_i64
+	.p2align 4
+	.globl	asm_builtin_addr_add_off_i64
+	.type	asm_builtin_addr_add_off_i64, @function
+asm_builtin_addr_add_off_i64:
+.LFB2299:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2299:
+	.size	asm_builtin_addr_add_off_i64, .-asm_builtin_addr_add_off_i64
+	.p2align 4
+	.globl	asm_opaque_addr_add_off_i64
+	.type	asm_opaque_addr_add_off_i64, @function
+asm_opaque_addr_add_off_i64:
+.LFB2300:
+	.cfi_startproc
+	leaq	(%rsi,%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2300:
+	.size	asm_opaque_addr_add_off_i64, .-asm_opaque_addr_add_off_i64
+	.p2align 4
+	.globl	asm_builtin_addr_sub_addr_i64
+	.type	asm_builtin_addr_sub_addr_i64, @function
+asm_builtin_addr_sub_addr_i64:
+.LFB2319:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2319:
+	.size	asm_builtin_addr_sub_addr_i64, .-asm_builtin_addr_sub_addr_i64
+	.p2align 4
+	.globl	asm_opaque_addr_sub_addr_i64
+	.type	asm_opaque_addr_sub_addr_i64, @function
+asm_opaque_addr_sub_addr_i64:
+.LFB2320:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2320:
+	.size	asm_opaque_addr_sub_addr_i64, .-asm_opaque_addr_sub_addr_i64
+	.p2align 4
+	.globl	asm_builtin_chk_add_throw_i64
+	.type	asm_builtin_chk_add_throw_i64, @function
+asm_builtin_chk_add_throw_i64:
+.LFB2321:
+	.cfi_startproc
+	movq	%rdi, %rax
+	addq	%rsi, %rax
+	jo	.L496
+	ret
+.L496:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2321:
+	.size	asm_builtin_chk_add_throw_i64, .-asm_builtin_chk_add_throw_i64
+	.p2align 4
+	.globl	asm_opaque_chk_add_throw_i64
+	.type	asm_opaque_chk_add_throw_i64, @function
+asm_opaque_chk_add_throw_i64:
+.LFB2322:
+	.cfi_startproc
+	movq	%rsi, %rax
+	addq	%rdi, %rax
+	jo	.L505
+	ret
+.L505:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2322:
+	.size	asm_opaque_chk_add_throw_i64, .-asm_opaque_chk_add_throw_i64
+	.p2align 4
+	.globl	asm_builtin_chk_sub_throw_i64
+	.type	asm_builtin_chk_sub_throw_i64, @function
+asm_builtin_chk_sub_throw_i64:
+.LFB2355:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	jo	.L514
+	ret
+.L514:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2355:
+	.size	asm_builtin_chk_sub_throw_i64, .-asm_builtin_chk_sub_throw_i64
+	.p2align 4
+	.globl	asm_opaque_chk_sub_throw_i64
+	.type	asm_opaque_chk_sub_throw_i64, @function
+asm_opaque_chk_sub_throw_i64:
+.LFB2356:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	jo	.L523
+	ret
+.L523:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2356:
+	.size	asm_opaque_chk_sub_throw_i64, .-asm_opaque_chk_sub_throw_i64
+	.p2align 4
+	.globl	asm_builtin_chk_mul_throw_i64
+	.type	asm_builtin_chk_mul_throw_i64, @function
+asm_builtin_chk_mul_throw_i64:
+.LFB2357:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	jo	.L532
+	ret
+.L532:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2357:
+	.size	asm_builtin_chk_mul_throw_i64, .-asm_builtin_chk_mul_throw_i64
+	.p2align 4
+	.globl	asm_opaque_chk_mul_throw_i64
+	.type	asm_opaque_chk_mul_throw_i64, @function
+asm_opaque_chk_mul_throw_i64:
+.LFB2358:
+	.cfi_startproc
+	movq	%rsi, %rax
+	imulq	%rdi, %rax
+	jo	.L541
+	ret
+.L541:
+	pushq	%rax
+	.cfi_def_cfa_offset 16
+	call	_ZN6opaque6detail14throw_overflowEv
+	.cfi_endproc
+.LFE2358:
+	.size	asm_opaque_chk_mul_throw_i64, .-asm_opaque_chk_mul_throw_i64
+	.p2align 4
+	.globl	asm_builtin_chk_add_saturate_i64
+	.type	asm_builtin_chk_add_saturate_i64, @function
+asm_builtin_chk_add_saturate_i64:
+.LFB2367:
+	.cfi_startproc
+	addq	%rsi, %rdi
+	jo	.L544
+	movq	%rdi, %rax
+	ret
+.L544:
+	movabsq	$9223372036854775807, %rdx
+	testq	%rsi, %rsi
+	movabsq	$-9223372036854775808, %rax
+	cmovns	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2367:
+	.size	asm_builtin_chk_add_saturate_i64, .-asm_builtin_chk_add_saturate_i64
+	.p2align 4
+	.globl	asm_opaque_chk_add_saturate_i64
+	.type	asm_opaque_chk_add_saturate_i64, @function
+asm_opaque_chk_add_saturate_i64:
+.LFB2368:
+	.cfi_startproc
+	addq	%rsi, %rdi
+	jo	.L550
+	movq	%rdi, %rax
+	ret
+.L550:
+	movabsq	$9223372036854775807, %rdx
+	testq	%rsi, %rsi
+	movabsq	$-9223372036854775808, %rax
+	cmovns	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2368:
+	.size	asm_opaque_chk_add_saturate_i64, .-asm_opaque_chk_add_saturate_i64
+	.p2align 4
+	.globl	asm_builtin_chk_sub_saturate_i64
+	.type	asm_builtin_chk_sub_saturate_i64, @function
+asm_builtin_chk_sub_saturate_i64:
+.LFB2401:
+	.cfi_startproc
+	subq	%rsi, %rdi
+	jo	.L556
+	movq	%rdi, %rax
+	ret
+.L556:
+	movabsq	$9223372036854775807, %rdx
+	testq	%rsi, %rsi
+	movabsq	$-9223372036854775808, %rax
+	cmovs	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2401:
+	.size	asm_builtin_chk_sub_saturate_i64, .-asm_builtin_chk_sub_saturate_i64
+	.p2align 4
+	.globl	asm_opaque_chk_sub_saturate_i64
+	.type	asm_opaque_chk_sub_saturate_i64, @function
+asm_opaque_chk_sub_saturate_i64:
+.LFB2402:
+	.cfi_startproc
+	subq	%rsi, %rdi
+	jo	.L562
+	movq	%rdi, %rax
+	ret
+.L562:
+	movabsq	$9223372036854775807, %rdx
+	testq	%rsi, %rsi
+	movabsq	$-9223372036854775808, %rax
+	cmovs	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2402:
+	.size	asm_opaque_chk_sub_saturate_i64, .-asm_opaque_chk_sub_saturate_i64
+	.p2align 4
+	.globl	asm_builtin_chk_mul_saturate_i64
+	.type	asm_builtin_chk_mul_saturate_i64, @function
+asm_builtin_chk_mul_saturate_i64:
+.LFB2403:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	jo	.L572
+	ret
+.L572:
+	movabsq	$9223372036854775807, %rdx
+	xorq	%rsi, %rdi
+	movabsq	$-9223372036854775808, %rax
+	cmovns	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2403:
+	.size	asm_builtin_chk_mul_saturate_i64, .-asm_builtin_chk_mul_saturate_i64
+	.p2align 4
+	.globl	asm_opaque_chk_mul_saturate_i64
+	.type	asm_opaque_chk_mul_saturate_i64, @function
+asm_opaque_chk_mul_saturate_i64:
+.LFB2404:
+	.cfi_startproc
+	movq	%rsi, %rax
+	imulq	%rdi, %rax
+	jo	.L579
+	ret
+.L579:
+	movabsq	$9223372036854775807, %rdx
+	xorq	%rdi, %rsi
+	movabsq	$-9223372036854775808, %rax
+	cmovns	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2404:
+	.size	asm_opaque_chk_mul_saturate_i64, .-asm_opaque_chk_mul_saturate_i64
+	.p2align 4
+	.globl	asm_builtin_chk_add_wrap_i64
+	.type	asm_builtin_chk_add_wrap_i64, @function
+asm_builtin_chk_add_wrap_i64:
+.LFB2413:
+	.cfi_startproc
+	leaq	(%rdi,%rsi), %rax
+	ret
+	.cfi_endproc
+.LFE2413:
+	.size	asm_builtin_chk_add_wrap_i64, .-asm_builtin_chk_add_wrap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_add_wrap_i64
+	.type	asm_opaque_chk_add_wrap_i64, @function
+asm_opaque_chk_add_wrap_i64:
+.LFB2414:
+	.cfi_startproc
+	leaq	(%rsi,%rdi), %rax
+	ret
+	.cfi_endproc
+.LFE2414:
+	.size	asm_opaque_chk_add_wrap_i64, .-asm_opaque_chk_add_wrap_i64
+	.p2align 4
+	.globl	asm_builtin_chk_sub_wrap_i64
+	.type	asm_builtin_chk_sub_wrap_i64, @function
+asm_builtin_chk_sub_wrap_i64:
+.LFB2447:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2447:
+	.size	asm_builtin_chk_sub_wrap_i64, .-asm_builtin_chk_sub_wrap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_sub_wrap_i64
+	.type	asm_opaque_chk_sub_wrap_i64, @function
+asm_opaque_chk_sub_wrap_i64:
+.LFB2448:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2448:
+	.size	asm_opaque_chk_sub_wrap_i64, .-asm_opaque_chk_sub_wrap_i64
+	.p2align 4
+	.globl	asm_builtin_chk_mul_wrap_i64
+	.type	asm_builtin_chk_mul_wrap_i64, @function
+asm_builtin_chk_mul_wrap_i64:
+.LFB2449:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2449:
+	.size	asm_builtin_chk_mul_wrap_i64, .-asm_builtin_chk_mul_wrap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_mul_wrap_i64
+	.type	asm_opaque_chk_mul_wrap_i64, @function
+asm_opaque_chk_mul_wrap_i64:
+.LFB2450:
+	.cfi_startproc
+	movq	%rsi, %rax
+	imulq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2450:
+	.size	asm_opaque_chk_mul_wrap_i64, .-asm_opaque_chk_mul_wrap_i64
+	.p2align 4
+	.globl	asm_builtin_chk_add_trap_i64
+	.type	asm_builtin_chk_add_trap_i64, @function
+asm_builtin_chk_add_trap_i64:
+.LFB2459:
+	.cfi_startproc
+	movq	%rdi, %rax
+	addq	%rsi, %rax
+	jo	.L591
+	ret
+.L591:
+	ud2
+	.cfi_endproc
+.LFE2459:
+	.size	asm_builtin_chk_add_trap_i64, .-asm_builtin_chk_add_trap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_add_trap_i64
+	.type	asm_opaque_chk_add_trap_i64, @function
+asm_opaque_chk_add_trap_i64:
+.LFB2460:
+	.cfi_startproc
+	movq	%rsi, %rax
+	addq	%rdi, %rax
+	jo	.L597
+	ret
+.L597:
+	ud2
+	.cfi_endproc
+.LFE2460:
+	.size	asm_opaque_chk_add_trap_i64, .-asm_opaque_chk_add_trap_i64
+	.p2align 4
+	.globl	asm_builtin_chk_sub_trap_i64
+	.type	asm_builtin_chk_sub_trap_i64, @function
+asm_builtin_chk_sub_trap_i64:
+.LFB2493:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	jo	.L603
+	ret
+.L603:
+	ud2
+	.cfi_endproc
+.LFE2493:
+	.size	asm_builtin_chk_sub_trap_i64, .-asm_builtin_chk_sub_trap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_sub_trap_i64
+	.type	asm_opaque_chk_sub_trap_i64, @function
+asm_opaque_chk_sub_trap_i64:
+.LFB2494:
+	.cfi_startproc
+	movq	%rdi, %rax
+	subq	%rsi, %rax
+	jo	.L609
+	ret
+.L609:
+	ud2
+	.cfi_endproc
+.LFE2494:
+	.size	asm_opaque_chk_sub_trap_i64, .-asm_opaque_chk_sub_trap_i64
+	.p2align 4
+	.globl	asm_builtin_chk_mul_trap_i64
+	.type	asm_builtin_chk_mul_trap_i64, @function
+asm_builtin_chk_mul_trap_i64:
+.LFB2495:
+	.cfi_startproc
+	movq	%rdi, %rax
+	imulq	%rsi, %rax
+	jo	.L615
+	ret
+.L615:
+	ud2
+	.cfi_endproc
+.LFE2495:
+	.size	asm_builtin_chk_mul_trap_i64, .-asm_builtin_chk_mul_trap_i64
+	.p2align 4
+	.globl	asm_opaque_chk_mul_trap_i64
+	.type	asm_opaque_chk_mul_trap_i64, @function
+asm_opaque_chk_mul_trap_i64:
+.LFB2496:
+	.cfi_startproc
+	movq	%rsi, %rax
+	imulq	%rdi, %rax
+	jo	.L621
+	ret
+.L621:
+	ud2
+	.cfi_endproc
+.LFE2496:
+	.size	asm_opaque_chk_mul_trap_i64, .-asm_opaque_chk_mul_trap_i64
+	.p2align 4
+	.globl	asm_builtin_mod_i64
+	.type	asm_builtin_mod_i64, @function
+asm_builtin_mod_i64:
+.LFB2505:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2505:
+	.size	asm_builtin_mod_i64, .-asm_builtin_mod_i64
+	.p2align 4
+	.globl	asm_opaque_mod_i64
+	.type	asm_opaque_mod_i64, @function
+asm_opaque_mod_i64:
+.LFB2506:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2506:
+	.size	asm_opaque_mod_i64, .-asm_opaque_mod_i64
+	.p2align 4
+	.globl	asm_builtin_and_i64
+	.type	asm_builtin_and_i64, @function
+asm_builtin_and_i64:
+.LFB2507:
+	.cfi_startproc
+	movq	%rdi, %rax
+	andq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2507:
+	.size	asm_builtin_and_i64, .-asm_builtin_and_i64
+	.p2align 4
+	.globl	asm_opaque_and_i64
+	.type	asm_opaque_and_i64, @function
+asm_opaque_and_i64:
+.LFB2508:
+	.cfi_startproc
+	movq	%rsi, %rax
+	andq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2508:
+	.size	asm_opaque_and_i64, .-asm_opaque_and_i64
+	.p2align 4
+	.globl	asm_builtin_xor_i64
+	.type	asm_builtin_xor_i64, @function
+asm_builtin_xor_i64:
+.LFB2517:
+	.cfi_startproc
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2517:
+	.size	asm_builtin_xor_i64, .-asm_builtin_xor_i64
+	.p2align 4
+	.globl	asm_opaque_xor_i64
+	.type	asm_opaque_xor_i64, @function
+asm_opaque_xor_i64:
+.LFB2518:
+	.cfi_startproc
+	movq	%rsi, %rax
+	xorq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2518:
+	.size	asm_opaque_xor_i64, .-asm_opaque_xor_i64
+	.p2align 4
+	.globl	asm_builtin_or_i64
+	.type	asm_builtin_or_i64, @function
+asm_builtin_or_i64:
+.LFB2527:
+	.cfi_startproc
+	movq	%rdi, %rax
+	orq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2527:
+	.size	asm_builtin_or_i64, .-asm_builtin_or_i64
+	.p2align 4
+	.globl	asm_opaque_or_i64
+	.type	asm_opaque_or_i64, @function
+asm_opaque_or_i64:
+.LFB2528:
+	.cfi_startproc
+	movq	%rsi, %rax
+	orq	%rdi, %rax
+	ret
+	.cfi_endproc
+.LFE2528:
+	.size	asm_opaque_or_i64, .-asm_opaque_or_i64
+	.p2align 4
+	.globl	asm_builtin_mod_eq_i64
+	.type	asm_builtin_mod_eq_i64, @function
+asm_builtin_mod_eq_i64:
+.LFB2537:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2537:
+	.size	asm_builtin_mod_eq_i64, .-asm_builtin_mod_eq_i64
+	.p2align 4
+	.globl	asm_opaque_mod_eq_i64
+	.type	asm_opaque_mod_eq_i64, @function
+asm_opaque_mod_eq_i64:
+.LFB2538:
+	.cfi_startproc
+	movq	%rdi, %rax
+	cqto
+	idivq	%rsi
+	movq	%rdx, %rax
+	ret
+	.cfi_endproc
+.LFE2538:
+	.size	asm_opaque_mod_eq_i64, .-asm_opaque_mod_eq_i64
+	.p2align 4
+	.globl	asm_builtin_and_eq_i64
+	.type	asm_builtin_and_eq_i64, @function
+asm_builtin_and_eq_i64:
+.LFB2539:
+	.cfi_startproc
+	movq	%rdi, %rax
+	andq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2539:
+	.size	asm_builtin_and_eq_i64, .-asm_builtin_and_eq_i64
+	.p2align 4
+	.globl	asm_opaque_and_eq_i64
+	.type	asm_opaque_and_eq_i64, @function
+asm_opaque_and_eq_i64:
+.LFB2540:
+	.cfi_startproc
+	movq	%rdi, %rax
+	andq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2540:
+	.size	asm_opaque_and_eq_i64, .-asm_opaque_and_eq_i64
+	.p2align 4
+	.globl	asm_builtin_xor_eq_i64
+	.type	asm_builtin_xor_eq_i64, @function
+asm_builtin_xor_eq_i64:
+.LFB2541:
+	.cfi_startproc
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2541:
+	.size	asm_builtin_xor_eq_i64, .-asm_builtin_xor_eq_i64
+	.p2align 4
+	.globl	asm_opaque_xor_eq_i64
+	.type	asm_opaque_xor_eq_i64, @function
+asm_opaque_xor_eq_i64:
+.LFB2542:
+	.cfi_startproc
+	movq	%rdi, %rax
+	xorq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2542:
+	.size	asm_opaque_xor_eq_i64, .-asm_opaque_xor_eq_i64
+	.p2align 4
+	.globl	asm_builtin_or_eq_i64
+	.type	asm_builtin_or_eq_i64, @function
+asm_builtin_or_eq_i64:
+.LFB2543:
+	.cfi_startproc
+	movq	%rdi, %rax
+	orq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2543:
+	.size	asm_builtin_or_eq_i64, .-asm_builtin_or_eq_i64
+	.p2align 4
+	.globl	asm_opaque_or_eq_i64
+	.type	asm_opaque_or_eq_i64, @function
+asm_opaque_or_eq_i64:
+.LFB2544:
+	.cfi_startproc
+	movq	%rdi, %rax
+	orq	%rsi, %rax
+	ret
+	.cfi_endproc
+.LFE2544:
+	.size	asm_opaque_or_eq_i64, .-asm_opaque_or_eq_i64
+	.p2align 4
+	.globl	asm_builtin_shl_i64
+	.type	asm_builtin_shl_i64, @function
+asm_builtin_shl_i64:
+.LFB2545:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	salq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2545:
+	.size	asm_builtin_shl_i64, .-asm_builtin_shl_i64
+	.p2align 4
+	.globl	asm_opaque_shl_i64
+	.type	asm_opaque_shl_i64, @function
+asm_opaque_shl_i64:
+.LFB2546:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	salq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2546:
+	.size	asm_opaque_shl_i64, .-asm_opaque_shl_i64
+	.p2align 4
+	.globl	asm_builtin_shr_i64
+	.type	asm_builtin_shr_i64, @function
+asm_builtin_shr_i64:
+.LFB2547:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	sarq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2547:
+	.size	asm_builtin_shr_i64, .-asm_builtin_shr_i64
+	.p2align 4
+	.globl	asm_opaque_shr_i64
+	.type	asm_opaque_shr_i64, @function
+asm_opaque_shr_i64:
+.LFB2548:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	sarq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2548:
+	.size	asm_opaque_shr_i64, .-asm_opaque_shr_i64
+	.p2align 4
+	.globl	asm_builtin_shl_eq_i64
+	.type	asm_builtin_shl_eq_i64, @function
+asm_builtin_shl_eq_i64:
+.LFB2549:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	salq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2549:
+	.size	asm_builtin_shl_eq_i64, .-asm_builtin_shl_eq_i64
+	.p2align 4
+	.globl	asm_opaque_shl_eq_i64
+	.type	asm_opaque_shl_eq_i64, @function
+asm_opaque_shl_eq_i64:
+.LFB2550:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	salq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2550:
+	.size	asm_opaque_shl_eq_i64, .-asm_opaque_shl_eq_i64
+	.p2align 4
+	.globl	asm_builtin_shr_eq_i64
+	.type	asm_builtin_shr_eq_i64, @function
+asm_builtin_shr_eq_i64:
+.LFB2551:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	sarq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2551:
+	.size	asm_builtin_shr_eq_i64, .-asm_builtin_shr_eq_i64
+	.p2align 4
+	.globl	asm_opaque_shr_eq_i64
+	.type	asm_opaque_shr_eq_i64, @function
+asm_opaque_shr_eq_i64:
+.LFB2552:
+	.cfi_startproc
+	movq	%rdi, %rax
+	movl	%esi, %ecx
+	sarq	%cl, %rax
+	ret
+	.cfi_endproc
+.LFE2552:
+	.size	asm_opaque_shr_eq_i64, .-asm_opaque_shr_eq_i64
+	.p2align 4
+	.globl	asm_builtin_compl_i64
+	.type	asm_builtin_compl_i64, @function
+asm_builtin_compl_i64:
+.LFB2553:
+	.cfi_startproc
+	movq	%rdi, %rax
+	notq	%rax
+	ret
+	.cfi_endproc
+.LFE2553:
+	.size	asm_builtin_compl_i64, .-asm_builtin_compl_i64
+	.p2align 4
+	.globl	asm_opaque_compl_i64
+	.type	asm_opaque_compl_i64, @function
+asm_opaque_compl_i64:
+.LFB2554:
+	.cfi_startproc
+	movq	%rdi, %rax
+	notq	%rax
+	ret
+	.cfi_endproc
+.LFE2554:
+	.size	asm_opaque_compl_i64, .-asm_opaque_compl_i64
+	.p2align 4
+	.globl	asm_builtin_mul_f64
+	.type	asm_builtin_mul_f64, @function
+asm_builtin_mul_f64:
+.LFB2555:
+	.cfi_startproc
+	mulsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2555:
+	.size	asm_builtin_mul_f64, .-asm_builtin_mul_f64
+	.p2align 4
+	.globl	asm_opaque_mul_f64
+	.type	asm_opaque_mul_f64, @function
+asm_opaque_mul_f64:
+.LFB2556:
+	.cfi_startproc
+	mulsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2556:
+	.size	asm_opaque_mul_f64, .-asm_opaque_mul_f64
+	.p2align 4
+	.globl	asm_builtin_div_f64
+	.type	asm_builtin_div_f64, @function
+asm_builtin_div_f64:
+.LFB2588:
+	.cfi_startproc
+	divsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2588:
+	.size	asm_builtin_div_f64, .-asm_builtin_div_f64
+	.p2align 4
+	.globl	asm_opaque_div_f64
+	.type	asm_opaque_div_f64, @function
+asm_opaque_div_f64:
+.LFB2589:
+	.cfi_startproc
+	divsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2589:
+	.size	asm_opaque_div_f64, .-asm_opaque_div_f64
+	.p2align 4
+	.globl	asm_builtin_add_f64
+	.type	asm_builtin_add_f64, @function
+asm_builtin_add_f64:
+.LFB2590:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2590:
+	.size	asm_builtin_add_f64, .-asm_builtin_add_f64
+	.p2align 4
+	.globl	asm_opaque_add_f64
+	.type	asm_opaque_add_f64, @function
+asm_opaque_add_f64:
+.LFB2591:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2591:
+	.size	asm_opaque_add_f64, .-asm_opaque_add_f64
+	.p2align 4
+	.globl	asm_builtin_sub_f64
+	.type	asm_builtin_sub_f64, @function
+asm_builtin_sub_f64:
+.LFB2600:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2600:
+	.size	asm_builtin_sub_f64, .-asm_builtin_sub_f64
+	.p2align 4
+	.globl	asm_opaque_sub_f64
+	.type	asm_opaque_sub_f64, @function
+asm_opaque_sub_f64:
+.LFB2601:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2601:
+	.size	asm_opaque_sub_f64, .-asm_opaque_sub_f64
+	.p2align 4
+	.globl	asm_builtin_mul_eq_f64
+	.type	asm_builtin_mul_eq_f64, @function
+asm_builtin_mul_eq_f64:
+.LFB2602:
+	.cfi_startproc
+	mulsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2602:
+	.size	asm_builtin_mul_eq_f64, .-asm_builtin_mul_eq_f64
+	.p2align 4
+	.globl	asm_opaque_mul_eq_f64
+	.type	asm_opaque_mul_eq_f64, @function
+asm_opaque_mul_eq_f64:
+.LFB2603:
+	.cfi_startproc
+	mulsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2603:
+	.size	asm_opaque_mul_eq_f64, .-asm_opaque_mul_eq_f64
+	.p2align 4
+	.globl	asm_builtin_div_eq_f64
+	.type	asm_builtin_div_eq_f64, @function
+asm_builtin_div_eq_f64:
+.LFB2604:
+	.cfi_startproc
+	divsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2604:
+	.size	asm_builtin_div_eq_f64, .-asm_builtin_div_eq_f64
+	.p2align 4
+	.globl	asm_opaque_div_eq_f64
+	.type	asm_opaque_div_eq_f64, @function
+asm_opaque_div_eq_f64:
+.LFB2605:
+	.cfi_startproc
+	divsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2605:
+	.size	asm_opaque_div_eq_f64, .-asm_opaque_div_eq_f64
+	.p2align 4
+	.globl	asm_builtin_add_eq_f64
+	.type	asm_builtin_add_eq_f64, @function
+asm_builtin_add_eq_f64:
+.LFB2606:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2606:
+	.size	asm_builtin_add_eq_f64, .-asm_builtin_add_eq_f64
+	.p2align 4
+	.globl	asm_opaque_add_eq_f64
+	.type	asm_opaque_add_eq_f64, @function
+asm_opaque_add_eq_f64:
+.LFB2607:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2607:
+	.size	asm_opaque_add_eq_f64, .-asm_opaque_add_eq_f64
+	.p2align 4
+	.globl	asm_builtin_sub_eq_f64
+	.type	asm_builtin_sub_eq_f64, @function
+asm_builtin_sub_eq_f64:
+.LFB2608:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2608:
+	.size	asm_builtin_sub_eq_f64, .-asm_builtin_sub_eq_f64
+	.p2align 4
+	.globl	asm_opaque_sub_eq_f64
+	.type	asm_opaque_sub_eq_f64, @function
+asm_opaque_sub_eq_f64:
+.LFB2609:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2609:
+	.size	asm_opaque_sub_eq_f64, .-asm_opaque_sub_eq_f64
+	.p2align 4
+	.globl	asm_builtin_pos_f64
+	.type	asm_builtin_pos_f64, @function
+asm_builtin_pos_f64:
+.LFB2610:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2610:
+	.size	asm_builtin_pos_f64, .-asm_builtin_pos_f64
+	.p2align 4
+	.globl	asm_opaque_pos_f64
+	.type	asm_opaque_pos_f64, @function
+asm_opaque_pos_f64:
+.LFB2611:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2611:
+	.size	asm_opaque_pos_f64, .-asm_opaque_pos_f64
+	.p2align 4
+	.globl	asm_builtin_neg_f64
+	.type	asm_builtin_neg_f64, @function
+asm_builtin_neg_f64:
+.LFB2612:
+	.cfi_startproc
+	xorpd	.LC1(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2612:
+	.size	asm_builtin_neg_f64, .-asm_builtin_neg_f64
+	.p2align 4
+	.globl	asm_opaque_neg_f64
+	.type	asm_opaque_neg_f64, @function
+asm_opaque_neg_f64:
+.LFB2613:
+	.cfi_startproc
+	xorpd	.LC1(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2613:
+	.size	asm_opaque_neg_f64, .-asm_opaque_neg_f64
+	.p2align 4
+	.globl	asm_builtin_preinc_f64
+	.type	asm_builtin_preinc_f64, @function
+asm_builtin_preinc_f64:
+.LFB2614:
+	.cfi_startproc
+	addsd	.LC2(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2614:
+	.size	asm_builtin_preinc_f64, .-asm_builtin_preinc_f64
+	.p2align 4
+	.globl	asm_opaque_preinc_f64
+	.type	asm_opaque_preinc_f64, @function
+asm_opaque_preinc_f64:
+.LFB2615:
+	.cfi_startproc
+	addsd	.LC2(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2615:
+	.size	asm_opaque_preinc_f64, .-asm_opaque_preinc_f64
+	.p2align 4
+	.globl	asm_builtin_predec_f64
+	.type	asm_builtin_predec_f64, @function
+asm_builtin_predec_f64:
+.LFB2616:
+	.cfi_startproc
+	subsd	.LC2(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2616:
+	.size	asm_builtin_predec_f64, .-asm_builtin_predec_f64
+	.p2align 4
+	.globl	asm_opaque_predec_f64
+	.type	asm_opaque_predec_f64, @function
+asm_opaque_predec_f64:
+.LFB2617:
+	.cfi_startproc
+	subsd	.LC2(%rip), %xmm0
+	ret
+	.cfi_endproc
+.LFE2617:
+	.size	asm_opaque_predec_f64, .-asm_opaque_predec_f64
+	.p2align 4
+	.globl	asm_builtin_postinc_f64
+	.type	asm_builtin_postinc_f64, @function
+asm_builtin_postinc_f64:
+.LFB2618:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2618:
+	.size	asm_builtin_postinc_f64, .-asm_builtin_postinc_f64
+	.p2align 4
+	.globl	asm_opaque_postinc_f64
+	.type	asm_opaque_postinc_f64, @function
+asm_opaque_postinc_f64:
+.LFB2619:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2619:
+	.size	asm_opaque_postinc_f64, .-asm_opaque_postinc_f64
+	.p2align 4
+	.globl	asm_builtin_postdec_f64
+	.type	asm_builtin_postdec_f64, @function
+asm_builtin_postdec_f64:
+.LFB2621:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2621:
+	.size	asm_builtin_postdec_f64, .-asm_builtin_postdec_f64
+	.p2align 4
+	.globl	asm_opaque_postdec_f64
+	.type	asm_opaque_postdec_f64, @function
+asm_opaque_postdec_f64:
+.LFB2622:
+	.cfi_startproc
+	ret
+	.cfi_endproc
+.LFE2622:
+	.size	asm_opaque_postdec_f64, .-asm_opaque_postdec_f64
+	.p2align 4
+	.globl	asm_builtin_eq_f64
+	.type	asm_builtin_eq_f64, @function
+asm_builtin_eq_f64:
+.LFB2623:
+	.cfi_startproc
+	ucomisd	%xmm1, %xmm0
+	movl	$0, %edx
+	setnp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2623:
+	.size	asm_builtin_eq_f64, .-asm_builtin_eq_f64
+	.p2align 4
+	.globl	asm_opaque_eq_f64
+	.type	asm_opaque_eq_f64, @function
+asm_opaque_eq_f64:
+.LFB2624:
+	.cfi_startproc
+	ucomisd	%xmm0, %xmm1
+	movl	$0, %edx
+	setnp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2624:
+	.size	asm_opaque_eq_f64, .-asm_opaque_eq_f64
+	.p2align 4
+	.globl	asm_builtin_ne_f64
+	.type	asm_builtin_ne_f64, @function
+asm_builtin_ne_f64:
+.LFB2625:
+	.cfi_startproc
+	ucomisd	%xmm1, %xmm0
+	movl	$1, %edx
+	setp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2625:
+	.size	asm_builtin_ne_f64, .-asm_builtin_ne_f64
+	.p2align 4
+	.globl	asm_opaque_ne_f64
+	.type	asm_opaque_ne_f64, @function
+asm_opaque_ne_f64:
+.LFB2626:
+	.cfi_startproc
+	ucomisd	%xmm0, %xmm1
+	movl	$1, %edx
+	setp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2626:
+	.size	asm_opaque_ne_f64, .-asm_opaque_ne_f64
+	.p2align 4
+	.globl	asm_builtin_lt_f64
+	.type	asm_builtin_lt_f64, @function
+asm_builtin_lt_f64:
+.LFB2627:
+	.cfi_startproc
+	comisd	%xmm0, %xmm1
+	seta	%al
+	ret
+	.cfi_endproc
+.LFE2627:
+	.size	asm_builtin_lt_f64, .-asm_builtin_lt_f64
+	.p2align 4
+	.globl	asm_opaque_lt_f64
+	.type	asm_opaque_lt_f64, @function
+asm_opaque_lt_f64:
+.LFB2628:
+	.cfi_startproc
+	comisd	%xmm0, %xmm1
+	seta	%al
+	ret
+	.cfi_endproc
+.LFE2628:
+	.size	asm_opaque_lt_f64, .-asm_opaque_lt_f64
+	.p2align 4
+	.globl	asm_builtin_gt_f64
+	.type	asm_builtin_gt_f64, @function
+asm_builtin_gt_f64:
+.LFB2629:
+	.cfi_startproc
+	comisd	%xmm1, %xmm0
+	seta	%al
+	ret
+	.cfi_endproc
+.LFE2629:
+	.size	asm_builtin_gt_f64, .-asm_builtin_gt_f64
+	.p2align 4
+	.globl	asm_opaque_gt_f64
+	.type	asm_opaque_gt_f64, @function
+asm_opaque_gt_f64:
+.LFB2630:
+	.cfi_startproc
+	comisd	%xmm1, %xmm0
+	seta	%al
+	ret
+	.cfi_endproc
+.LFE2630:
+	.size	asm_opaque_gt_f64, .-asm_opaque_gt_f64
+	.p2align 4
+	.globl	asm_builtin_le_f64
+	.type	asm_builtin_le_f64, @function
+asm_builtin_le_f64:
+.LFB2631:
+	.cfi_startproc
+	comisd	%xmm0, %xmm1
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE2631:
+	.size	asm_builtin_le_f64, .-asm_builtin_le_f64
+	.p2align 4
+	.globl	asm_opaque_le_f64
+	.type	asm_opaque_le_f64, @function
+asm_opaque_le_f64:
+.LFB2632:
+	.cfi_startproc
+	comisd	%xmm0, %xmm1
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE2632:
+	.size	asm_opaque_le_f64, .-asm_opaque_le_f64
+	.p2align 4
+	.globl	asm_builtin_ge_f64
+	.type	asm_builtin_ge_f64, @function
+asm_builtin_ge_f64:
+.LFB2633:
+	.cfi_startproc
+	comisd	%xmm1, %xmm0
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE2633:
+	.size	asm_builtin_ge_f64, .-asm_builtin_ge_f64
+	.p2align 4
+	.globl	asm_opaque_ge_f64
+	.type	asm_opaque_ge_f64, @function
+asm_opaque_ge_f64:
+.LFB2634:
+	.cfi_startproc
+	comisd	%xmm1, %xmm0
+	setnb	%al
+	ret
+	.cfi_endproc
+.LFE2634:
+	.size	asm_opaque_ge_f64, .-asm_opaque_ge_f64
+	.p2align 4
+	.globl	asm_builtin_not_f64
+	.type	asm_builtin_not_f64, @function
+asm_builtin_not_f64:
+.LFB2635:
+	.cfi_startproc
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	movl	$0, %edx
+	ucomisd	%xmm0, %xmm1
+	setnp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2635:
+	.size	asm_builtin_not_f64, .-asm_builtin_not_f64
+	.p2align 4
+	.globl	asm_opaque_not_f64
+	.type	asm_opaque_not_f64, @function
+asm_opaque_not_f64:
+.LFB2636:
+	.cfi_startproc
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	movl	$0, %edx
+	ucomisd	%xmm0, %xmm1
+	setnp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2636:
+	.size	asm_opaque_not_f64, .-asm_opaque_not_f64
+	.p2align 4
+	.globl	asm_builtin_bool_f64
+	.type	asm_builtin_bool_f64, @function
+asm_builtin_bool_f64:
+.LFB2637:
+	.cfi_startproc
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	movl	$1, %edx
+	ucomisd	%xmm0, %xmm1
+	setp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2637:
+	.size	asm_builtin_bool_f64, .-asm_builtin_bool_f64
+	.p2align 4
+	.globl	asm_opaque_bool_f64
+	.type	asm_opaque_bool_f64, @function
+asm_opaque_bool_f64:
+.LFB2638:
+	.cfi_startproc
+	movapd	%xmm0, %xmm1
+	pxor	%xmm0, %xmm0
+	movl	$1, %edx
+	ucomisd	%xmm0, %xmm1
+	setp	%al
+	cmovne	%edx, %eax
+	ret
+	.cfi_endproc
+.LFE2638:
+	.size	asm_opaque_bool_f64, .-asm_opaque_bool_f64
+	.p2align 4
+	.globl	asm_builtin_pos_add_dist_f64
+	.type	asm_builtin_pos_add_dist_f64, @function
+asm_builtin_pos_add_dist_f64:
+.LFB2639:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2639:
+	.size	asm_builtin_pos_add_dist_f64, .-asm_builtin_pos_add_dist_f64
+	.p2align 4
+	.globl	asm_opaque_pos_add_dist_f64
+	.type	asm_opaque_pos_add_dist_f64, @function
+asm_opaque_pos_add_dist_f64:
+.LFB2640:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2640:
+	.size	asm_opaque_pos_add_dist_f64, .-asm_opaque_pos_add_dist_f64
+	.p2align 4
+	.globl	asm_builtin_dist_add_pos_f64
+	.type	asm_builtin_dist_add_pos_f64, @function
+asm_builtin_dist_add_pos_f64:
+.LFB2662:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2662:
+	.size	asm_builtin_dist_add_pos_f64, .-asm_builtin_dist_add_pos_f64
+	.p2align 4
+	.globl	asm_opaque_dist_add_pos_f64
+	.type	asm_opaque_dist_add_pos_f64, @function
+asm_opaque_dist_add_pos_f64:
+.LFB2663:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2663:
+	.size	asm_opaque_dist_add_pos_f64, .-asm_opaque_dist_add_pos_f64
+	.p2align 4
+	.globl	asm_builtin_pos_sub_dist_f64
+	.type	asm_builtin_pos_sub_dist_f64, @function
+asm_builtin_pos_sub_dist_f64:
+.LFB2667:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2667:
+	.size	asm_builtin_pos_sub_dist_f64, .-asm_builtin_pos_sub_dist_f64
+	.p2align 4
+	.globl	asm_opaque_pos_sub_dist_f64
+	.type	asm_opaque_pos_sub_dist_f64, @function
+asm_opaque_pos_sub_dist_f64:
+.LFB2668:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2668:
+	.size	asm_opaque_pos_sub_dist_f64, .-asm_opaque_pos_sub_dist_f64
+	.p2align 4
+	.globl	asm_builtin_pos_sub_pos_f64
+	.type	asm_builtin_pos_sub_pos_f64, @function
+asm_builtin_pos_sub_pos_f64:
+.LFB2669:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2669:
+	.size	asm_builtin_pos_sub_pos_f64, .-asm_builtin_pos_sub_pos_f64
+	.p2align 4
+	.globl	asm_opaque_pos_sub_pos_f64
+	.type	asm_opaque_pos_sub_pos_f64, @function
+asm_opaque_pos_sub_pos_f64:
+.LFB2670:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2670:
+	.size	asm_opaque_pos_sub_pos_f64, .-asm_opaque_pos_sub_pos_f64
+	.p2align 4
+	.globl	asm_builtin_addr_add_off_f64
+	.type	asm_builtin_addr_add_off_f64, @function
+asm_builtin_addr_add_off_f64:
+.LFB2671:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2671:
+	.size	asm_builtin_addr_add_off_f64, .-asm_builtin_addr_add_off_f64
+	.p2align 4
+	.globl	asm_opaque_addr_add_off_f64
+	.type	asm_opaque_addr_add_off_f64, @function
+asm_opaque_addr_add_off_f64:
+.LFB2672:
+	.cfi_startproc
+	addsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2672:
+	.size	asm_opaque_addr_add_off_f64, .-asm_opaque_addr_add_off_f64
+	.p2align 4
+	.globl	asm_builtin_addr_sub_addr_f64
+	.type	asm_builtin_addr_sub_addr_f64, @function
+asm_builtin_addr_sub_addr_f64:
+.LFB2691:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2691:
+	.size	asm_builtin_addr_sub_addr_f64, .-asm_builtin_addr_sub_addr_f64
+	.p2align 4
+	.globl	asm_opaque_addr_sub_addr_f64
+	.type	asm_opaque_addr_sub_addr_f64, @function
+asm_opaque_addr_sub_addr_f64:
+.LFB2692:
+	.cfi_startproc
+	subsd	%xmm1, %xmm0
+	ret
+	.cfi_endproc
+.LFE2692:
+	.size	asm_opaque_addr_sub_addr_f64, .-asm_opaque_addr_sub_addr_f64
+	.section	.rodata.cst16,"aM",@progbits,16
+	.align 16
+.LC1:
+	.long	0
+	.long	-2147483648
+	.long	0
+	.long	0
+	.section	.rodata.cst8,"aM",@progbits,8
+	.align 8
+.LC2:
+	.long	0
+	.long	1072693248
+	.hidden	DW.ref.__gxx_personality_v0
+	.weak	DW.ref.__gxx_personality_v0
+	.section	.data.rel.local.DW.ref.__gxx_personality_v0,"awG",@progbits,DW.ref.__gxx_personality_v0,comdat
+	.align 8
+	.type	DW.ref.__gxx_personality_v0, @object
+	.size	DW.ref.__gxx_personality_v0, 8
+DW.ref.__gxx_personality_v0:
+	.quad	__gxx_personality_v0
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
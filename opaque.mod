@@ -31,12 +31,14 @@
 # Directory trees containing source files
 #
 [real_trees]
+bench
 example
 
 #
 # Source files creating executables
 #
 [real_executables]
+bench/*.cpp
 example/demo_numeric_typedef.cpp
 example/tutorial.cpp
 
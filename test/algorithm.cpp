@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/algorithm.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/checked_numeric_typedef.hpp"
+#include "opaque/fixed_point_typedef.hpp"
+#include "opaque/saturating_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct distance : numeric_typedef<std::int64_t, distance> {
+  using base = numeric_typedef<std::int64_t, distance>;
+  using base::base;
+};
+
+struct position : experimental::position_typedef<distance, position> {
+  using base = experimental::position_typedef<distance, position>;
+  using base::base;
+};
+
+struct weight : numeric_typedef<double, weight> {
+  using base = numeric_typedef<double, weight>;
+  using base::base;
+};
+
+// Closed under + but not batchable, and not commutative
+struct label : numeric_typedef_base<std::string, label>
+             , binop::addable<label> {
+  using base = numeric_typedef_base<std::string, label>;
+  using base::base;
+};
+
+struct level : saturating_typedef<std::int8_t, level> {
+  using base = saturating_typedef<std::int8_t, level>;
+  using base::base;
+};
+
+struct volume : checked_numeric_typedef<std::int8_t, volume,
+                                        saturate_on_overflow> {
+  using base = checked_numeric_typedef<std::int8_t, volume,
+                                       saturate_on_overflow>;
+  using base::base;
+};
+
+struct ratio : fixed_point_typedef<std::int32_t, 16, ratio> {
+  using base = fixed_point_typedef<std::int32_t, 16, ratio>;
+  using base::base;
+};
+
+// Small chunks, so that every test divides its input between threads
+const parallel_policy threads(4, 100);
+
+static std::vector<distance> steps(std::size_t n) {
+  std::vector<distance> v;
+  for (std::size_t i = 0; i != n; ++i) {
+    v.push_back(distance(static_cast<std::int64_t>(i % 7) - 3));
+  }
+  return v;
+}
+
+TEST(parallel_policy) {
+  CHECK_EQUAL(1u, parallel_policy(4, 100).chunks(0));
+  CHECK_EQUAL(1u, parallel_policy(4, 100).chunks(199));
+  CHECK_EQUAL(3u, parallel_policy(4, 100).chunks(300));
+  CHECK_EQUAL(4u, parallel_policy(4, 100).chunks(100000));
+  CHECK_EQUAL(1u, parallel_policy(1, 100).chunks(100000));
+}
+
+TEST(reduce) {
+  auto v = steps(10007);
+  distance serial(0);
+  for (const distance& d : v) serial += d;
+
+  CHECK_EQUAL(true, serial == reduce(v, distance(0), plus(), threads));
+  CHECK_EQUAL(true, serial == reduce(v));
+  CHECK_EQUAL(true, distance(0) == reduce(std::vector<distance>()));
+
+  // Summing distances from a position gives a position
+  position p = reduce(v, position(1000), plus(), threads);
+  CHECK_EQUAL(true, p == position(1000) + serial);
+}
+
+TEST(reduce_floating) {
+  std::vector<weight> v;
+  double serial = 0;
+  for (std::size_t i = 0; i != 5003; ++i) {
+    v.push_back(weight(1.0 / static_cast<double>(i + 1)));
+    serial += v.back().value;
+  }
+  CHECK_CLOSE(serial, reduce(v, weight(0), plus(), threads).value, 1e-9);
+}
+
+TEST(reduce_ordered) {
+  std::vector<label> v;
+  std::string serial;
+  for (std::size_t i = 0; i != 1000; ++i) {
+    v.push_back(label(std::string(1, static_cast<char>('a' + i % 26))));
+    serial += v.back().value;
+  }
+  CHECK_EQUAL(serial, reduce(v, label(), plus(), threads).value);
+}
+
+TEST(reduce_other_operations) {
+  std::vector<std::uint32_t> v;
+  std::uint32_t all = 0xffffffff, any = 0, parity = 0;
+  for (std::uint32_t i = 0; i != 1000; ++i) {
+    v.push_back(~(1u << (i % 32)) ^ (i << 8));
+    all &= v.back();
+    any |= v.back();
+    parity ^= v.back();
+  }
+  CHECK_EQUAL(all, reduce(v, 0xffffffffu, bit_and(), threads));
+  CHECK_EQUAL(any, reduce(v, 0u, bit_or(), threads));
+  CHECK_EQUAL(parity, reduce(v, 0u, bit_xor(), threads));
+}
+
+TEST(reduce_saturating) {
+  // Saturating sums depend on the order, and are combined serially
+  std::vector<level> up(1000, level(std::int8_t(100)));
+  CHECK_EQUAL(127, reduce(up, level(std::int8_t(0)), plus(), threads).value);
+  CHECK_EQUAL(127, reduce(up).value);
+  std::vector<volume> loud(1000, volume(std::int8_t(100)));
+  CHECK_EQUAL(127, reduce(loud, volume(std::int8_t(0)), plus(),
+                          threads).value);
+  std::vector<level> swing;
+  for (std::size_t i = 0; i != 1000; ++i) {
+    swing.push_back(level(std::int8_t(i < 500 ? 100 : -100)));
+  }
+  level serial(std::int8_t(0));
+  for (const level& x : swing) serial += x;
+  CHECK_EQUAL(serial.value,
+              reduce(swing, level(std::int8_t(0)), plus(), threads).value);
+  std::vector<level> out(swing.size());
+  inclusive_scan(swing, out, plus(), threads);
+  level acc(std::int8_t(0));
+  for (std::size_t i = 0; i != swing.size(); ++i) {
+    acc += swing[i];
+    CHECK_EQUAL(acc.value, out[i].value);
+  }
+}
+
+TEST(reduce_fixed_point) {
+  // Fixed-point products are rescaled, and sums are on the storage
+  const ratio two = ratio::from_floating(2.0);
+  const ratio one = ratio::from_floating(1.0);
+  std::vector<ratio> v(3, two);
+  CHECK_EQUAL(ratio::from_floating(8.0), reduce(v, one, multiplies()));
+  std::vector<ratio> w;
+  for (std::size_t i = 0; i != 1000; ++i) {
+    w.push_back(ratio::from_floating(i % 2 ? 1.0 / 1024 : 1024.0));
+  }
+  CHECK_EQUAL(ratio::from_floating(0.5),
+              reduce(w, ratio::from_floating(0.5), multiplies(), threads));
+  std::vector<ratio> x;
+  for (std::size_t i = 0; i != 1000; ++i) {
+    x.push_back(ratio::from_floating(i % 2 ? 0.25 : 1.5));
+  }
+  CHECK_EQUAL(ratio::from_floating(875.0), reduce(x, ratio(0), plus(),
+                                                  threads));
+}
+
+TEST(inclusive_scan) {
+  auto v = steps(1234);
+  std::vector<distance> out(v.size());
+  inclusive_scan(v, out, plus(), threads);
+  distance acc(0);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    acc += v[i];
+    CHECK_EQUAL(true, acc == out[i]);
+  }
+
+  // Running positions from a starting position
+  std::vector<position> path(v.size());
+  inclusive_scan(v, path, plus(), position(50), threads);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    CHECK_EQUAL(true, path[i] == position(50) + out[i]);
+  }
+
+  // In place
+  inclusive_scan(v, v, plus(), threads);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    CHECK_EQUAL(true, v[i] == out[i]);
+  }
+}
+
+TEST(exclusive_scan) {
+  auto v = steps(1234);
+  std::vector<position> path(v.size());
+  exclusive_scan(v, path, position(-5), plus(), threads);
+  position acc(-5);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    CHECK_EQUAL(true, acc == path[i]);
+    acc += v[i];
+  }
+
+  auto w = steps(1234);
+  exclusive_scan(w, w, distance(0), plus(), threads);
+  distance sum(0);
+  for (std::size_t i = 0; i != v.size(); ++i) {
+    CHECK_EQUAL(true, sum == w[i]);
+    sum += v[i];
+  }
+}
+
+TEST(exception) {
+  std::vector<int> v(1000, 1);
+  v[751] = -1;
+  auto checked = [](int l, int r) -> int {
+    if (r < 0) throw std::domain_error("negative");
+    return l + r;
+  };
+  try {
+    reduce(v, 0, checked, threads);
+    CHECK_CATCH(std::domain_error, e);
+    CHECK_STRINGS("negative", e.what());
+  }
+}
@@ -0,0 +1,178 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/atomic_typedef.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/handle_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct sequence : numeric_typedef<std::uint64_t, sequence> {
+  using base = numeric_typedef<std::uint64_t, sequence>;
+  using base::base;
+};
+
+struct distance : numeric_typedef<std::int64_t, distance> {
+  using base = numeric_typedef<std::int64_t, distance>;
+  using base::base;
+};
+
+struct offset : experimental::position_typedef<distance, offset> {
+  using base = experimental::position_typedef<distance, offset>;
+  using base::base;
+};
+
+struct entity : experimental::handle_typedef<entity, 20, 12> {
+  using base = experimental::handle_typedef<entity, 20, 12>;
+  using base::base;
+};
+
+struct weight : numeric_typedef<double, weight> {
+  using base = numeric_typedef<double, weight>;
+  using base::base;
+};
+
+// Wraps around at 1000 instead of at the limit of the underlying type
+struct clock_hand : numeric_typedef<std::uint32_t, clock_hand> {
+  using base = numeric_typedef<std::uint32_t, clock_hand>;
+  using base::base;
+  clock_hand& operator+=(const clock_hand& r) & {
+    value = (value + r.value) % 1000;
+    return *this;
+  }
+};
+
+namespace opaque {
+template <> struct is_native_arithmetic<clock_hand> : std::false_type { };
+}
+
+template <typename A, typename D, typename = void>
+struct can_fetch_add : std::false_type { };
+template <typename A, typename D>
+struct can_fetch_add<A, D, void_t<decltype(
+    std::declval<A&>().fetch_add(std::declval<const D&>()))>>
+  : std::true_type { };
+
+template <typename A, typename D, typename = void>
+struct can_fetch_or : std::false_type { };
+template <typename A, typename D>
+struct can_fetch_or<A, D, void_t<decltype(
+    std::declval<A&>().fetch_or(std::declval<const D&>()))>>
+  : std::true_type { };
+
+SUITE(atomics) {
+  TEST(operations) {
+    atomic_typedef<sequence> s(sequence(5u));
+    CHECK_EQUAL(true, s.is_lock_free());
+    CHECK_EQUAL(5u, s.load().value);
+    s.store(sequence(7u));
+    CHECK_EQUAL(7u, s.exchange(sequence(9u)).value);
+    sequence expected(1u);
+    CHECK_EQUAL(false, s.compare_exchange_strong(expected, sequence(2u)));
+    CHECK_EQUAL(9u, expected.value);
+    CHECK_EQUAL(true, s.compare_exchange_strong(expected, sequence(2u)));
+    while (not s.compare_exchange_weak(expected, sequence(12u),
+                                       std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) { }
+    CHECK_EQUAL(12u, s.fetch_add(sequence(3u)).value);
+    CHECK_EQUAL(15u, s.fetch_sub(sequence(1u)).value);
+    CHECK_EQUAL(14u, s.fetch_or(sequence(1u)).value);
+    CHECK_EQUAL(15u, s.fetch_and(sequence(6u)).value);
+    CHECK_EQUAL(6u, s.fetch_xor(sequence(3u)).value);
+    CHECK_EQUAL(5u, s.load(std::memory_order_relaxed).value);
+  }
+
+  TEST(permissions) {
+    typedef atomic_typedef<sequence> a_sequence;
+    typedef atomic_typedef<offset> an_offset;
+    typedef atomic_typedef<entity> an_entity;
+    typedef atomic_typedef<weight> a_weight;
+    CHECK_EQUAL(true , (can_fetch_add<a_sequence, sequence>::value));
+    CHECK_EQUAL(false, (can_fetch_add<a_sequence, distance>::value));
+    CHECK_EQUAL(false, (can_fetch_add<a_sequence, std::uint64_t>::value));
+    CHECK_EQUAL(true , (can_fetch_add<an_offset, distance>::value));
+    CHECK_EQUAL(false, (can_fetch_add<an_offset, offset>::value));
+    CHECK_EQUAL(false, (can_fetch_or<an_offset, distance>::value));
+    CHECK_EQUAL(false, (can_fetch_add<an_entity, entity>::value));
+    CHECK_EQUAL(true , (can_fetch_add<a_weight, weight>::value));
+  }
+
+  TEST(positions) {
+    atomic_typedef<offset> o(offset(10));
+    CHECK_EQUAL(10, o.fetch_add(distance(5)).value);
+    CHECK_EQUAL(15, o.fetch_sub(distance(20)).value);
+    CHECK_EQUAL(-5, o.load().value);
+  }
+
+  TEST(handles) {
+    atomic_typedef<entity> e(entity::make(3, 1));
+    entity expected = entity::make(3, 1);
+    CHECK_EQUAL(true,
+                e.compare_exchange_strong(expected, entity::make(3, 2)));
+    CHECK_EQUAL(2u, e.load().generation());
+  }
+
+  TEST(compare_exchange_loop) {
+    // Operators that do more than the underlying type are applied as is
+    atomic_typedef<clock_hand> hand(clock_hand(990u));
+    CHECK_EQUAL(990u, hand.fetch_add(clock_hand(15u)).value);
+    CHECK_EQUAL(5u, hand.load().value);
+    atomic_typedef<weight> w(weight(1.5));
+    w.fetch_add(weight(2.0));
+    CHECK_EQUAL(true, w.load() > weight(3.25) and w.load() < weight(3.75));
+  }
+
+  TEST(contention) {
+    const unsigned threads = 4;
+    const unsigned increments = 20000;
+    atomic_typedef<sequence> s(sequence(0u));
+    atomic_typedef<clock_hand> hand(clock_hand(0u));
+    std::vector<std::thread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+      pool.emplace_back([&]{
+        for (unsigned i = 0; i < increments; ++i) {
+          s.fetch_add(sequence(1u), std::memory_order_relaxed);
+          hand.fetch_add(clock_hand(1u), std::memory_order_relaxed);
+        }
+      });
+    }
+    for (std::thread& t : pool) t.join();
+    CHECK_EQUAL(std::uint64_t(threads) * increments, s.load().value);
+    CHECK_EQUAL(threads * increments % 1000, hand.load().value);
+  }
+}
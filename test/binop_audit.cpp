@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binop/binop_function.hpp"
+#include "opaque/binop/binop_overload.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include "tracing_base.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <utility>
+
+//
+// Audit of the copies and moves made by every overload_1..overload_4 path.
+//
+// The underlying type stands in for an arbitrary-precision integer: every
+// copy of it is a heap allocation, so each expression is checked against the
+// smallest number of copies and moves that any implementation could achieve.
+// The counts for every expression are also printed as a table.
+//
+
+using namespace opaque;
+
+std::vector<tracing_base::operation> tracing_base::trace;
+using operation = tracing_base::operation;
+
+UNIT_TEST_MAIN
+
+namespace {
+
+struct big : tracing_base {
+  std::vector<unsigned> limbs;
+  big() : limbs(64, 1u) { }
+  big& operator+=(const big& peer) {
+    for (std::size_t i = 0; i < limbs.size(); ++i) limbs[i] += peer.limbs[i];
+    return *this;
+  }
+  big& operator-=(const big& peer) {
+    for (std::size_t i = 0; i < limbs.size(); ++i) limbs[i] -= peer.limbs[i];
+    return *this;
+  }
+  big& operator*=(const big& peer) {
+    for (std::size_t i = 0; i < limbs.size(); ++i) limbs[i] *= peer.limbs[i];
+    return *this;
+  }
+};
+
+// A distinct result type, constructible only by conversion from big
+struct bigger : big {
+  explicit bigger(const big& b) : big(b) { }
+  explicit bigger(      big&& b) : big(std::move(b)) { }
+};
+
+struct integer : numeric_typedef<big, integer> {
+  using base = numeric_typedef<big, integer>;
+  using base::base;
+  integer() : base(big()) { }
+};
+
+struct distance : numeric_typedef<big, distance> {
+  using base = numeric_typedef<big, distance>;
+  using base::base;
+  distance() : base(big()) { }
+};
+
+struct position : experimental::position_typedef<distance, position> {
+  using base = experimental::position_typedef<distance, position>;
+  using base::base;
+  position() : base(big()) { }
+};
+
+struct counts {
+  unsigned copies;
+  unsigned moves;
+};
+
+//
+// Evaluate an expression and count the copies and moves it made, including
+// those needed to produce its result, but not those needed to set up its
+// operands.
+//
+bool header_printed = false;
+
+template <typename F>
+counts audit(const char * expression, F&& f) {
+  if (not header_printed) {
+    std::printf("%-44s %6s %6s\n", "expression", "copies", "moves");
+    header_printed = true;
+  }
+  tracing_base::clear_trace();
+  auto result = f();
+  const auto& trace = tracing_base::trace;
+  counts c;
+  c.copies = static_cast<unsigned>(
+      std::count(trace.begin(), trace.end(), operation::copy_constructor) +
+      std::count(trace.begin(), trace.end(), operation::copy_assignment));
+  c.moves = static_cast<unsigned>(
+      std::count(trace.begin(), trace.end(), operation::move_constructor) +
+      std::count(trace.begin(), trace.end(), operation::move_assignment));
+  std::printf("%-44s %6u %6u\n", expression, c.copies, c.moves);
+  return c;
+}
+
+}
+
+#define AUDIT(expression) audit(#expression, [&]{ return expression; })
+
+SUITE(overload) {
+
+  using add = binop::add_equal_t;
+  using sub = binop::subtract_equal_t;
+
+  TEST(norm_no_conversion) {
+    using over = binop::binary_operator<sub, big, false>;
+    big l, r, t1, t2, t3, t4;
+    counts ll = AUDIT(over::func(l, r));
+    CHECK_EQUAL(1u, ll.copies);
+    CHECK_EQUAL(0u, ll.moves);
+    counts lr = AUDIT(over::func(l, std::move(t1)));
+    CHECK_EQUAL(1u, lr.copies);
+    CHECK_EQUAL(0u, lr.moves);
+    counts rl = AUDIT(over::func(std::move(t2), r));
+    CHECK_EQUAL(0u, rl.copies);
+    CHECK_EQUAL(1u, rl.moves);
+    counts rr = AUDIT(over::func(std::move(t3), std::move(t4)));
+    CHECK_EQUAL(0u, rr.copies);
+    CHECK_EQUAL(1u, rr.moves);
+  }
+
+  TEST(swap_no_conversion) {
+    using over = binop::binary_operator<add, big, true>;
+    big l, r, t1, t2, t3, t4;
+    counts ll = AUDIT(over::func(l, r));
+    CHECK_EQUAL(1u, ll.copies);
+    CHECK_EQUAL(0u, ll.moves);
+    // Commutativity lets the rvalue on the right be reused
+    counts lr = AUDIT(over::func(l, std::move(t1)));
+    CHECK_EQUAL(0u, lr.copies);
+    CHECK_EQUAL(1u, lr.moves);
+    counts rl = AUDIT(over::func(std::move(t2), r));
+    CHECK_EQUAL(0u, rl.copies);
+    CHECK_EQUAL(1u, rl.moves);
+    counts rr = AUDIT(over::func(std::move(t3), std::move(t4)));
+    CHECK_EQUAL(0u, rr.copies);
+    CHECK_EQUAL(1u, rr.moves);
+  }
+
+  TEST(norm_ret_conversion) {
+    using over = binop::binary_operator<sub, bigger, false, big, big>;
+    big l, r, t1, t2, t3, t4;
+    counts ll = AUDIT(over::func(l, r));
+    CHECK_EQUAL(1u, ll.copies);
+    CHECK_EQUAL(1u, ll.moves);
+    counts lr = AUDIT(over::func(l, std::move(t1)));
+    CHECK_EQUAL(1u, lr.copies);
+    CHECK_EQUAL(1u, lr.moves);
+    counts rl = AUDIT(over::func(std::move(t2), r));
+    CHECK_EQUAL(0u, rl.copies);
+    CHECK_EQUAL(1u, rl.moves);
+    counts rr = AUDIT(over::func(std::move(t3), std::move(t4)));
+    CHECK_EQUAL(0u, rr.copies);
+    CHECK_EQUAL(1u, rr.moves);
+  }
+
+  TEST(swap_ret_conversion) {
+    using over = binop::binary_operator<add, bigger, true, big, big>;
+    big l, r, t1, t2, t3, t4;
+    counts ll = AUDIT(over::func(l, r));
+    CHECK_EQUAL(1u, ll.copies);
+    CHECK_EQUAL(1u, ll.moves);
+    counts lr = AUDIT(over::func(l, std::move(t1)));
+    CHECK_EQUAL(0u, lr.copies);
+    CHECK_EQUAL(1u, lr.moves);
+    counts rl = AUDIT(over::func(std::move(t2), r));
+    CHECK_EQUAL(0u, rl.copies);
+    CHECK_EQUAL(1u, rl.moves);
+    counts rr = AUDIT(over::func(std::move(t3), std::move(t4)));
+    CHECK_EQUAL(0u, rr.copies);
+    CHECK_EQUAL(1u, rr.moves);
+  }
+
+}
+
+SUITE(opaque) {
+
+  TEST(numeric_typedef) {
+    integer l, r, t1, t2, t3, t4, t5, t6;
+    counts ll = AUDIT(l + r);
+    CHECK_EQUAL(1u, ll.copies);
+    CHECK_EQUAL(0u, ll.moves);
+    counts lr = AUDIT(l + std::move(t1));
+    CHECK_EQUAL(0u, lr.copies);
+    CHECK_EQUAL(1u, lr.moves);
+    counts rl = AUDIT(std::move(t2) + r);
+    CHECK_EQUAL(0u, rl.copies);
+    CHECK_EQUAL(1u, rl.moves);
+    counts rr = AUDIT(std::move(t3) + std::move(t4));
+    CHECK_EQUAL(0u, rr.copies);
+    CHECK_EQUAL(1u, rr.moves);
+    counts nc = AUDIT(l - std::move(t5));
+    CHECK_EQUAL(1u, nc.copies);
+    CHECK_EQUAL(0u, nc.moves);
+    // The temporary from the first addition is reused by the second
+    counts chain = AUDIT(l + r + t6);
+    CHECK_EQUAL(1u, chain.copies);
+    CHECK_EQUAL(1u, chain.moves);
+  }
+
+  TEST(position_typedef) {
+    position p, q, t1, t2, t3;
+    distance d, t4, t5;
+    counts pd = AUDIT(p + d);
+    CHECK_EQUAL(1u, pd.copies);
+    CHECK_EQUAL(0u, pd.moves);
+    counts dp = AUDIT(d + p);
+    CHECK_EQUAL(1u, dp.copies);
+    CHECK_EQUAL(0u, dp.moves);
+    counts rd = AUDIT(std::move(t1) + d);
+    CHECK_EQUAL(0u, rd.copies);
+    CHECK_EQUAL(1u, rd.moves);
+    counts dr = AUDIT(d + std::move(t2));
+    CHECK_EQUAL(0u, dr.copies);
+    CHECK_EQUAL(1u, dr.moves);
+    counts pl = AUDIT(p - std::move(t4));
+    CHECK_EQUAL(1u, pl.copies);
+    CHECK_EQUAL(0u, pl.moves);
+    counts pr = AUDIT(std::move(t3) - std::move(t5));
+    CHECK_EQUAL(0u, pr.copies);
+    CHECK_EQUAL(1u, pr.moves);
+    // The difference of two positions is computed on the underlying type and
+    // converted to a distance, which costs a move
+    counts pp = AUDIT(p - q);
+    CHECK_EQUAL(1u, pp.copies);
+    CHECK_EQUAL(1u, pp.moves);
+  }
+
+}
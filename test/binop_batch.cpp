@@ -0,0 +1,207 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/binop/binop_batch.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct distance : numeric_typedef<std::int32_t, distance> {
+  using base = numeric_typedef<std::int32_t, distance>;
+  using base::base;
+};
+
+struct offset : experimental::position_typedef<distance, offset> {
+  using base = experimental::position_typedef<distance, offset>;
+  using base::base;
+};
+
+struct ratio : numeric_typedef<float, ratio> {
+  using base = numeric_typedef<float, ratio>;
+  using base::base;
+};
+
+struct flags : numeric_typedef<std::uint32_t, flags> {
+  using base = numeric_typedef<std::uint32_t, flags>;
+  using base::base;
+};
+
+// Redefines operator+= to saturate, so it must not be batched on storage
+struct level : numeric_typedef<std::uint8_t, level> {
+  using base = numeric_typedef<std::uint8_t, level>;
+  using base::base;
+  level& operator+=(const level& peer) & noexcept {
+    value = static_cast<std::uint8_t>(
+        value > 255 - peer.value ? 255 : value + peer.value);
+    return *this;
+  }
+};
+
+namespace opaque { namespace binop {
+template <> struct is_batchable<level> : std::false_type { };
+} }
+
+// Not layout-compatible with its underlying type
+struct label : numeric_typedef_base<std::string, label>
+             , binop::addable<label> {
+  using base = numeric_typedef_base<std::string, label>;
+  using base::base;
+};
+
+using add_distance = binop::addable<distance>;
+using add_offset = binop::addable<offset, true, offset, distance>;
+using sub_offset = binop::subtractable<distance, false, offset, offset,
+                                       std::int32_t, std::int32_t>;
+using mul_ratio = binop::multipliable<ratio>;
+using shl_distance = binop::left_shiftable<distance, false, distance, unsigned>;
+using shl_flags = binop::left_shiftable<flags, false, flags, std::uint32_t>;
+using shr_flags = binop::right_shiftable<flags, false, flags, std::uint32_t>;
+
+template <typename T, typename F>
+std::vector<T> sequence(std::size_t n, F f) {
+  std::vector<T> v;
+  for (std::size_t i = 0; i != n; ++i) v.push_back(f(i));
+  return v;
+}
+
+TEST(is_lane_operation) {
+  CHECK_EQUAL(true , binop::is_lane_operation<add_distance>::value);
+  CHECK_EQUAL(true , binop::is_lane_operation<add_offset>::value);
+  CHECK_EQUAL(true , binop::is_lane_operation<sub_offset>::value);
+  CHECK_EQUAL(true , binop::is_lane_operation<mul_ratio>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<shl_distance>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<shl_flags>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<binop::addable<level>>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<binop::addable<label>>::value);
+}
+
+TEST(apply_same_type) {
+  const std::size_t n = 37; // not a multiple of any vector width
+  auto l = sequence<distance>(n, [](std::size_t i) {
+      return distance(static_cast<std::int32_t>(i * 3)); });
+  auto r = sequence<distance>(n, [](std::size_t i) {
+      return distance(-static_cast<std::int32_t>(i)); });
+  std::vector<distance> out(n);
+  binop::apply<add_distance>(out, l, r);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, out[i] == l[i] + r[i]);
+  }
+  const std::vector<distance> before = l;
+  binop::apply<binop::multipliable<distance>>(l, l, r);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, l[i] == before[i] * r[i]);
+  }
+}
+
+TEST(apply_mixed_type) {
+  const std::size_t n = 19;
+  auto p = sequence<offset>(n, [](std::size_t i) {
+      return offset(static_cast<std::int32_t>(100 + i)); });
+  auto d = sequence<distance>(n, [](std::size_t i) {
+      return distance(static_cast<std::int32_t>(i * i)); });
+
+  std::vector<offset> moved(n);
+  binop::apply<add_offset>(moved, p, d);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, moved[i] == p[i] + d[i]);
+  }
+
+  std::vector<distance> diff(n);
+  binop::apply<sub_offset>(diff, moved, p);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, diff[i] == d[i]);
+  }
+
+  binop::transform_assign<add_offset>(p, diff);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, p[i] == moved[i]);
+  }
+}
+
+TEST(apply_floating) {
+  const std::size_t n = 13;
+  auto l = sequence<ratio>(n, [](std::size_t i) {
+      return ratio(static_cast<float>(i) * 0.5f); });
+  auto r = sequence<ratio>(n, [](std::size_t i) {
+      return ratio(static_cast<float>(i) + 0.25f); });
+  std::vector<ratio> out(n);
+  binop::apply<mul_ratio>(out, l, r);
+  for (std::size_t i = 0; i != n; ++i) {
+    const float expected = (l[i] * r[i]).value;
+    CHECK_EQUAL(true, std::equal_to<float>()(expected, out[i].value));
+  }
+}
+
+TEST(apply_shift) {
+  // Each element has its own count, which no vector shift instruction takes
+  const std::size_t n = 21;
+  const std::vector<flags> ones(n, flags(1u));
+  const auto counts = sequence<std::uint32_t>(n, [](std::size_t i) {
+      return static_cast<std::uint32_t>(i); });
+  std::vector<flags> out(n);
+  binop::apply<shl_flags>(out, ones, counts);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(std::uint32_t{1} << i, out[i].value);
+  }
+  std::vector<flags> l = out;
+  binop::transform_assign<shr_flags>(l, counts);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(1u, l[i].value);
+  }
+  l = ones;
+  binop::transform_assign<shl_flags>(l, counts);
+  for (std::size_t i = 0; i != n; ++i) {
+    CHECK_EQUAL(true, l[i] == out[i]);
+  }
+}
+
+TEST(apply_fallback) {
+  std::vector<level> l = { level(std::uint8_t{200}), level(std::uint8_t{10}),
+                           level(std::uint8_t{255}) };
+  std::vector<level> r = { level(std::uint8_t{100}), level(std::uint8_t{20}),
+                           level(std::uint8_t{1}) };
+  binop::transform_assign<binop::addable<level>>(l, r);
+  CHECK_EQUAL(255, l[0].value);
+  CHECK_EQUAL( 30, l[1].value);
+  CHECK_EQUAL(255, l[2].value);
+
+  std::vector<label> a = { label("ab"), label("") };
+  std::vector<label> b = { label("cd"), label("x") };
+  std::vector<label> c(2);
+  binop::apply<binop::addable<label>>(c, a, b);
+  CHECK_EQUAL("abcd", c[0].value);
+  CHECK_EQUAL("x", c[1].value);
+}
@@ -236,9 +236,7 @@ TEST(show_operand_converting) {
     trace_type t = {
       operation::default_constructor, operation::default_constructor,
       operation::mark,             // operate on argument
-      operation::move_constructor, // return by value an underlying from op
       operation::move_constructor, // convert to T, elide return
-      operation::destructor,       // anonymous temporary
       operation::destructor, operation::destructor, operation::destructor,
     };
     CHECK_EQUAL(t.size(), tracing_base::trace.size());
@@ -249,9 +247,7 @@ TEST(show_operand_converting) {
     trace_type t = {
       operation::default_constructor, operation::default_constructor,
       operation::mark,             // operate on argument
-      operation::move_constructor, // return by value an underlying from op
       operation::move_constructor, // convert to T, elide return
-      operation::destructor,       // anonymous temporary
       operation::destructor, operation::destructor, operation::destructor,
     };
     CHECK_EQUAL(t.size(), tracing_base::trace.size());
@@ -262,9 +258,7 @@ TEST(show_operand_converting) {
     trace_type t = {
       operation::default_constructor, operation::default_constructor,
       operation::mark,             // operate on argument
-      operation::move_constructor, // return by value an underlying from op
       operation::move_constructor, // convert to T, elide return
-      operation::destructor,       // anonymous temporary
       operation::destructor, operation::destructor, operation::destructor,
     };
     CHECK_EQUAL(t.size(), tracing_base::trace.size());
@@ -108,6 +108,31 @@ foo func_swap(      foo&& p1,       foo&& p2) {
   return std::move(p2);
 }
 
+//
+// Converting implementations that reuse an rvalue operand, which converting
+// overloads must match.  The operand is converted to the result type once.
+//
+
+bar conv_norm(      foo&& p1, const foo&  p2) {
+  p1 *= p2;
+  return bar(std::move(p1));
+}
+
+bar conv_norm(      foo&& p1,       foo&& p2) {
+  p1 *= p2;
+  return bar(std::move(p1));
+}
+
+bar conv_swap(const foo&  p1,       foo&& p2) {
+  p2 *= p1;
+  return bar(std::move(p2));
+}
+
+bar conv_swap(      foo&& p1,       foo&& p2) {
+  p2 *= p1;
+  return bar(std::move(p2));
+}
+
 }
 
 TEST(norm_ll_no_conversion) {
@@ -349,7 +374,7 @@ TEST(norm_rl_ret_conversion) {
     trace_t actual;
     { tracing_base::scope_printer P(std::cout);
       const T r;
-      auto x = static_cast<R>(func_norm(foo(), r));
+      auto x = conv_norm(foo(), r);
       expected = tracing_base::trace;
     }
     { tracing_base::scope_printer P(std::cout);
@@ -372,7 +397,7 @@ TEST(norm_rr_ret_conversion) {
     trace_t expected;
     trace_t actual;
     { tracing_base::scope_printer P(std::cout);
-      auto x = static_cast<R>(func_norm(foo(), foo()));
+      auto x = conv_norm(foo(), foo());
       expected = tracing_base::trace;
     }
     { tracing_base::scope_printer P(std::cout);
@@ -419,7 +444,7 @@ TEST(swap_lr_ret_conversion) {
     trace_t actual;
     { tracing_base::scope_printer P(std::cout);
       const T l;
-      auto x = static_cast<R>(func_swap(l, foo()));
+      auto x = conv_swap(l, foo());
       expected = tracing_base::trace;
     }
     { tracing_base::scope_printer P(std::cout);
@@ -466,7 +491,7 @@ TEST(swap_rr_ret_conversion) {
     trace_t expected;
     trace_t actual;
     { tracing_base::scope_printer P(std::cout);
-      auto x = static_cast<R>(func_swap(foo(), foo()));
+      auto x = conv_swap(foo(), foo());
       expected = tracing_base::trace;
     }
     { tracing_base::scope_printer P(std::cout);
@@ -0,0 +1,192 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/checked_numeric_typedef.hpp"
+#include "opaque/atomic_typedef.hpp"
+#include "opaque/binop/binop_batch.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct strict : checked_numeric_typedef<int, strict> {
+  using base = checked_numeric_typedef<int, strict>;
+  using base::base;
+};
+
+struct level : checked_numeric_typedef<std::int8_t, level,
+                                       saturate_on_overflow> {
+  using base = checked_numeric_typedef<std::int8_t, level,
+                                       saturate_on_overflow>;
+  using base::base;
+};
+
+struct volume : checked_numeric_typedef<std::uint16_t, volume,
+                                        saturate_on_overflow> {
+  using base = checked_numeric_typedef<std::uint16_t, volume,
+                                       saturate_on_overflow>;
+  using base::base;
+};
+
+struct hashed : checked_numeric_typedef<std::uint32_t, hashed,
+                                        wrap_on_overflow> {
+  using base = checked_numeric_typedef<std::uint32_t, hashed,
+                                       wrap_on_overflow>;
+  using base::base;
+};
+
+struct fatal : checked_numeric_typedef<long, fatal, trap_on_overflow> {
+  using base = checked_numeric_typedef<long, fatal, trap_on_overflow>;
+  using base::base;
+};
+
+static level lv(int v) { return level(static_cast<std::int8_t>(v)); }
+static volume vol(int v) { return volume(static_cast<std::uint16_t>(v)); }
+
+template <typename T>
+static bool throws(T f) {
+  try {
+    f();
+  } catch (const std::overflow_error&) {
+    return true;
+  }
+  return false;
+}
+
+constexpr int imax = std::numeric_limits<int>::max();
+constexpr int imin = std::numeric_limits<int>::min();
+
+SUITE(checked) {
+  TEST(in_range) {
+    CHECK_EQUAL(7, (strict(3) + strict(4)).value);
+    CHECK_EQUAL(-1, (strict(3) - strict(4)).value);
+    CHECK_EQUAL(-12, (strict(-3) * strict(4)).value);
+    CHECK_EQUAL(-2, (strict(-9) / strict(4)).value);
+    CHECK_EQUAL(-1, (strict(-9) % strict(4)).value);
+    CHECK_EQUAL(-5, (-strict(5)).value);
+    strict s(1);
+    CHECK_EQUAL(1, (s++).value);
+    CHECK_EQUAL(3, (++s).value);
+    CHECK_EQUAL(3, (s--).value);
+    CHECK_EQUAL(1, (--s).value);
+    CHECK_EQUAL(6, (strict(3) << 1u).value);
+    CHECK_EQUAL(1, (strict(3) & strict(5)).value);
+  }
+
+  TEST(throwing) {
+    CHECK_EQUAL(true, throws([]{ strict(imax) + strict(1); }));
+    CHECK_EQUAL(true, throws([]{ strict(imin) - strict(1); }));
+    CHECK_EQUAL(true, throws([]{ strict(imax / 2 + 1) * strict(2); }));
+    CHECK_EQUAL(true, throws([]{ strict(imin) * strict(-1); }));
+    CHECK_EQUAL(true, throws([]{ strict(imin) / strict(-1); }));
+    CHECK_EQUAL(true, throws([]{ -strict(imin); }));
+    CHECK_EQUAL(true, throws([]{ strict s(imax); ++s; }));
+    CHECK_EQUAL(true, throws([]{ strict s(imin); s--; }));
+    CHECK_EQUAL(0, (strict(imin) % strict(-1)).value);
+    CHECK_EQUAL(imax, (strict(imax - 1) + strict(1)).value);
+    // The operand is unchanged when an exception is thrown
+    strict s(imax);
+    CHECK_EQUAL(true, throws([&]{ s += strict(1); }));
+    CHECK_EQUAL(imax, s.value);
+  }
+
+  TEST(saturating) {
+    CHECK_EQUAL(127, (lv(100) + lv(100)).value);
+    CHECK_EQUAL(-128, (lv(-100) + lv(-100)).value);
+    CHECK_EQUAL(-128, (lv(-100) - lv(100)).value);
+    CHECK_EQUAL(127, (lv(100) - lv(-100)).value);
+    CHECK_EQUAL(127, (lv(-20) * lv(-20)).value);
+    CHECK_EQUAL(-128, (lv(-20) * lv(20)).value);
+    CHECK_EQUAL(127, (lv(-128) / lv(-1)).value);
+    CHECK_EQUAL(127, (-lv(-128)).value);
+    CHECK_EQUAL(65535, (vol(65000) + vol(1000)).value);
+    CHECK_EQUAL(0, (vol(5) - vol(6)).value);
+    CHECK_EQUAL(65535, (vol(300) * vol(300)).value);
+    CHECK_EQUAL(0, (-vol(5)).value);
+    volume v = vol(0);
+    CHECK_EQUAL(0, (--v).value);
+  }
+
+  TEST(wrapping) {
+    hashed h(0xffffffffu);
+    CHECK_EQUAL(0u, (h + hashed(1u)).value);
+    CHECK_EQUAL(0xfffffffeu, (h * hashed(2u)).value);
+    CHECK_EQUAL(1u, (-h).value);
+    CHECK_EQUAL(0u, (++h).value);
+  }
+
+  TEST(exceptions) {
+    CHECK_EQUAL(false, noexcept(std::declval<strict&>() += strict(1)));
+    CHECK_EQUAL(true,  noexcept(std::declval<strict&>() %= strict(1)));
+    CHECK_EQUAL(true,  noexcept(std::declval<level&>() += level()));
+    CHECK_EQUAL(true,  noexcept(std::declval<hashed&>() *= hashed(1u)));
+    CHECK_EQUAL(true,  noexcept(std::declval<fatal&>() -= fatal(1)));
+    CHECK_EQUAL(true,  noexcept(-fatal(1)));
+    CHECK_EQUAL(4L, (fatal(2) * fatal(2)).value);
+  }
+
+  TEST(atomics) {
+    // Checked types update atomically with their own operators
+    CHECK_EQUAL(false, is_native_arithmetic<level>::value);
+    CHECK_EQUAL(false, is_native_arithmetic<strict>::value);
+    atomic_typedef<level> a(lv(120));
+    CHECK_EQUAL(120, a.fetch_add(lv(100)).value);
+    CHECK_EQUAL(127, a.load().value);
+    atomic_typedef<strict> s{strict(imax)};
+    CHECK_EQUAL(true, throws([&]{ s.fetch_add(strict(1)); }));
+    CHECK_EQUAL(imax, s.load().value);
+  }
+
+  TEST(batches) {
+    // Batches apply the operators of checked types element by element,
+    // except that saturating types use the saturating lane operations
+    CHECK_EQUAL(false, binop::is_batchable<strict>::value);
+    CHECK_EQUAL(true, binop::is_batchable<level>::value);
+    CHECK_EQUAL(true, binop::is_lane_operation<binop::addable<level>>::value);
+    std::vector<level> l(37, lv(100)), r(37, lv(100)), out(37);
+    binop::apply<binop::addable<level>>(out, l, r);
+    binop::transform_assign<binop::addable<level>>(l, r);
+    for (std::size_t i = 0; i != out.size(); ++i) {
+      CHECK_EQUAL(127, out[i].value);
+      CHECK_EQUAL(127, l[i].value);
+    }
+    std::vector<strict> a(37, strict(1)), b(37, strict(1)), c(37);
+    b[30] = strict(imax);
+    CHECK_EQUAL(true, throws([&]{
+      binop::apply<binop::addable<strict>>(c, a, b); }));
+    CHECK_EQUAL(true, throws([&]{
+      binop::transform_assign<binop::addable<strict>>(a, b); }));
+  }
+}
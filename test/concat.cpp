@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/concat.hpp"
+#include "opaque/experimental/fixed_string_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "opaque/experimental/string_typedef.hpp"
+#include "opaque/experimental/string_view_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+using namespace std;
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+// Counts the allocations made through it
+struct counter {
+  unsigned allocations = 0;
+};
+
+template <typename T>
+struct counting_allocator {
+  typedef T value_type;
+  counter * count;
+  explicit counting_allocator(counter& c) noexcept : count(&c) { }
+  template <typename U>
+  counting_allocator(const counting_allocator<U>& a) noexcept
+    : count(a.count) { }
+  T * allocate(std::size_t n) {
+    ++count->allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T * p, std::size_t n) noexcept {
+    std::allocator<T>().deallocate(p, n);
+  }
+};
+template <typename T, typename U>
+bool operator==(const counting_allocator<T>& l,
+                const counting_allocator<U>& r) {
+  return l.count == r.count;
+}
+template <typename T, typename U>
+bool operator!=(const counting_allocator<T>& l,
+                const counting_allocator<U>& r) {
+  return l.count != r.count;
+}
+
+typedef std::basic_string<char, std::char_traits<char>,
+                          counting_allocator<char>> counted_basic_string;
+
+struct counted_string
+  : opaque::experimental::string_typedef<counted_basic_string, counted_string>
+{
+  using base = opaque::experimental::string_typedef<counted_basic_string,
+                                                     counted_string>;
+  using base::base;
+};
+
+struct a_string
+  : opaque::experimental::safer_string_typedef<std::string, a_string>
+{
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+struct b_string
+  : opaque::experimental::safer_string_typedef<std::string, b_string>
+{
+  using base =
+    opaque::experimental::safer_string_typedef<std::string, b_string>;
+  using base::base;
+};
+
+struct path : opaque::experimental::string_typedef<std::string, path> {
+  using base = opaque::experimental::string_typedef<std::string, path>;
+  using base::base;
+};
+
+struct code : opaque::experimental::fixed_string_typedef<8, code> {
+  using base = opaque::experimental::fixed_string_typedef<8, code>;
+  using base::base;
+};
+
+struct path_view : opaque::experimental::string_view_typedef<path_view> {
+  using base = opaque::experimental::string_view_typedef<path_view>;
+  using base::base;
+};
+
+// Longer than the small string buffer, so that it must allocate
+static const char long_text[] = "a string that does not fit in the buffer";
+
+template <typename... P>
+using concat_t = decltype(experimental::concat(std::declval<const P&>()...));
+
+template <typename, typename = void>
+struct can_concat : std::false_type { };
+template <typename... P>
+struct can_concat<void(P...), void_t<concat_t<P...>>> : std::true_type { };
+
+SUITE(concat) {
+  TEST(values) {
+    const a_string prefix("user"), id("42"), suffix(".log");
+    CHECK_EQUAL(a_string("user/42.log"),
+                experimental::concat(prefix, '/', id, suffix));
+    CHECK_EQUAL(a_string("user"), experimental::concat(prefix));
+    CHECK_EQUAL(a_string("42user"), experimental::concat(id, prefix));
+    CHECK_EQUAL(a_string("<42>"), experimental::concat('<', id, '>'));
+    CHECK_EQUAL(a_string(), experimental::concat(a_string(), a_string()));
+    CHECK_EQUAL(path("/usr/lib/x"),
+                experimental::concat("/usr", path("/lib"), '/', "x"));
+    CHECK_EQUAL(code("ab-cd"),
+                experimental::concat(code("ab"), '-', code("cd")));
+  }
+
+  TEST(result_type) {
+    CHECK_EQUAL(true, (std::is_same<a_string,
+                                    concat_t<char, a_string, char>>::value));
+    CHECK_EQUAL(true, (std::is_same<path,
+                                    concat_t<const char *, path>>::value));
+    CHECK_EQUAL(true, (std::is_same<path,
+                                    concat_t<char[3], path, char *>>::value));
+  }
+
+  TEST(mixed_types) {
+    CHECK_EQUAL(true , (can_concat<void(a_string, a_string)>::value));
+    CHECK_EQUAL(false, (can_concat<void(a_string, b_string)>::value));
+    CHECK_EQUAL(false, (can_concat<void(a_string, char, path)>::value));
+    CHECK_EQUAL(false, (can_concat<void(a_string, std::string)>::value));
+    CHECK_EQUAL(false, (can_concat<void(a_string, const char *)>::value));
+    CHECK_EQUAL(false, (can_concat<void(code, const char *)>::value));
+    CHECK_EQUAL(false, (can_concat<void(path, int)>::value));
+    CHECK_EQUAL(false, (can_concat<void(char, const char *)>::value));
+  }
+
+  TEST(result_must_append) {
+    CHECK_EQUAL(true , (can_concat<void(code, char)>::value));
+    CHECK_EQUAL(false, (can_concat<void(path_view, path_view)>::value));
+    CHECK_EQUAL(false, (can_concat<void(path_view, char)>::value));
+    CHECK_EQUAL(false, (can_concat<void(std::string, std::string)>::value));
+    CHECK_EQUAL(false, (can_concat<void(std::string, char)>::value));
+  }
+
+  TEST(single_allocation) {
+    counter c;
+    const counting_allocator<char> alloc(c);
+    const counted_string prefix(counted_basic_string(long_text, alloc));
+    const counted_string id(counted_basic_string(long_text, alloc));
+    c.allocations = 0;
+    const counted_string s =
+      experimental::concat(prefix, '/', id, "-", long_text);
+    CHECK_EQUAL(1u, c.allocations);
+    CHECK_EQUAL(true, s.get_allocator() == alloc);
+    CHECK_EQUAL(3 * prefix.size() + 2, s.size());
+    c.allocations = 0;
+    const counted_string eager = prefix + '/' + id + "-" + long_text;
+    CHECK_EQUAL(true, c.allocations > 1);
+    CHECK_EQUAL(eager, s);
+  }
+
+  TEST(allocator_of_first_operand) {
+    counter a, b;
+    const counting_allocator<char> in_a(a), in_b(b);
+    const counted_string l(counted_basic_string(long_text, in_a));
+    const counted_string r(counted_basic_string(long_text, in_b));
+    CHECK_EQUAL(true, experimental::concat(l, r).get_allocator() == in_a);
+    CHECK_EQUAL(true, experimental::concat(r, l).get_allocator() == in_b);
+    CHECK_EQUAL(true,
+                experimental::concat("<", r, l).get_allocator() == in_b);
+  }
+
+  TEST(overflow) {
+    CHECK_EQUAL(code("abcdefgh"),
+                experimental::concat(code("abcd"), code("efgh")));
+    try {
+      experimental::concat(code("abcde"), code("fghi"));
+      CHECK_CATCH(std::length_error, e);
+    }
+  }
+}
@@ -0,0 +1,284 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/expr_numeric_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include "tracing_base.hpp"
+#include <algorithm>
+#include <vector>
+
+using namespace opaque;
+using namespace opaque::experimental;
+
+std::vector<tracing_base::operation> tracing_base::trace;
+using operation = tracing_base::operation;
+
+UNIT_TEST_MAIN
+
+struct safe_int : expr_numeric_typedef<int, safe_int> {
+  using base = expr_numeric_typedef<int, safe_int>;
+  using base::base;
+  using base::operator=;
+};
+
+SUITE(evaluation) {
+
+  TEST(arithmetic) {
+    safe_int a(7), b(3), c(5);
+    CHECK_EQUAL(10, safe_int(a + b).value);
+    CHECK_EQUAL( 4, safe_int(a - b).value);
+    CHECK_EQUAL(21, safe_int(a * b).value);
+    CHECK_EQUAL( 2, safe_int(a / b).value);
+    CHECK_EQUAL( 1, safe_int(a % b).value);
+    CHECK_EQUAL(56, safe_int(a << 3u).value);
+    CHECK_EQUAL( 3, safe_int(a >> 1u).value);
+    CHECK_EQUAL( 3, safe_int(a & b).value);
+    CHECK_EQUAL( 4, safe_int(a ^ b).value);
+    CHECK_EQUAL( 7, safe_int(a | b).value);
+    CHECK_EQUAL(15, (a + b + c).evaluate().value);
+  }
+
+  TEST(nested) {
+    safe_int a(7), b(3), c(5), d(2);
+    safe_int x = a + b + c + d;
+    CHECK_EQUAL(17, x.value);
+    safe_int y = a - b * c;
+    CHECK_EQUAL(-8, y.value);
+    safe_int z = (a + b) * (c - d);
+    CHECK_EQUAL(30, z.value);
+    safe_int w = a - (b - (c - d));
+    CHECK_EQUAL( 7, w.value);
+    safe_int v = safe_int(1) + (safe_int(2) << 2u) + safe_int(3);
+    CHECK_EQUAL(12, v.value);
+  }
+
+  TEST(assign) {
+    safe_int a(7), b(3), c(5);
+    safe_int x(100);
+    x = a + b - c;
+    CHECK_EQUAL( 5, x.value);
+    x += a * b;
+    CHECK_EQUAL(26, x.value);
+  }
+
+  TEST(alias) {
+    safe_int a(7), b(3);
+    safe_int x(2);
+    x = x + a;
+    CHECK_EQUAL( 9, x.value);
+    x = a - x;
+    CHECK_EQUAL(-2, x.value);
+    x = (b - x) * x;
+    CHECK_EQUAL(-10, x.value);
+    x = a - (b - x);
+    CHECK_EQUAL(-6, x.value);
+    x = x * x - x;
+    CHECK_EQUAL(42, x.value);
+  }
+
+}
+
+//
+// Mixed-type expressions follow the same rules as the eager operators
+//
+
+struct meters : expr_numeric_typedef<int, meters> {
+  using base = expr_numeric_typedef<int, meters>;
+  using base::base;
+  using base::operator=;
+};
+
+struct spot : numeric_typedef_base<int, spot>
+  , binop::lazy_addable     <spot  , true , spot  , meters>
+  , binop::lazy_addable     <spot  , true , meters, spot  >
+  , binop::lazy_subtractable<spot  , false, spot  , meters>
+  , binop::lazy_subtractable<meters, false, spot  , spot  , int, int>
+{
+  using base = numeric_typedef_base<int, spot>;
+  using base::base;
+  spot& operator+=(const spot&) = delete;
+  spot& operator-=(const spot&) = delete;
+  spot& operator+=(const meters& m) & { value += m.value; return *this; }
+  spot& operator-=(const meters& m) & { value -= m.value; return *this; }
+};
+
+template <typename T, typename U,
+         template <typename, typename> class E, typename = void>
+struct is_well_formed : std::false_type { };
+template <typename T, typename U,
+         template <typename, typename> class E>
+struct is_well_formed<T,U,E,void_t<E<T,U>>> : std::true_type { };
+
+template <typename T, typename U>
+using is_addable_t      = decltype(std::declval<T>() + std::declval<U>());
+template <typename T, typename U>
+using is_subtractable_t = decltype(std::declval<T>() - std::declval<U>());
+
+template <typename T, typename U>
+using is_addable      = is_well_formed<T,U,is_addable_t>;
+template <typename T, typename U>
+using is_subtractable = is_well_formed<T,U,is_subtractable_t>;
+
+template <typename L, typename R>
+using sum_t = decltype(std::declval<L>() + std::declval<R>());
+
+SUITE(mixed) {
+
+  TEST(evaluate) {
+    spot p(10), q(4);
+    meters d(3);
+    CHECK_EQUAL(13, (p + d).evaluate().value);
+    CHECK_EQUAL(13, (d + p).evaluate().value);
+    CHECK_EQUAL( 7, (p - d).evaluate().value);
+    CHECK_EQUAL(16, (p + d + d).evaluate().value);
+    meters m = p - q;
+    CHECK_EQUAL( 6, m.value);
+    m = p - q + d;
+    CHECK_EQUAL( 9, m.value);
+    CHECK_EQUAL(13, (p + (p - q - d)).evaluate().value);
+  }
+
+  TEST(permission) {
+    CHECK_EQUAL(false, (is_addable     <spot  , spot  >::value));
+    CHECK_EQUAL(true , (is_addable     <spot  , meters>::value));
+    CHECK_EQUAL(true , (is_addable     <meters, spot  >::value));
+    CHECK_EQUAL(true , (is_addable     <meters, meters>::value));
+    CHECK_EQUAL(true , (is_subtractable<spot  , spot  >::value));
+    CHECK_EQUAL(true , (is_subtractable<spot  , meters>::value));
+    CHECK_EQUAL(false, (is_subtractable<meters, spot  >::value));
+    using spot_expr = sum_t<spot, meters>;
+    CHECK_EQUAL(true , (is_addable     <spot_expr, meters   >::value));
+    CHECK_EQUAL(false, (is_addable     <spot_expr, spot     >::value));
+    CHECK_EQUAL(false, (is_addable     <spot_expr, spot_expr>::value));
+    CHECK_EQUAL(true , (is_subtractable<spot_expr, spot_expr>::value));
+    CHECK_EQUAL(false, (is_addable     <safe_int , meters   >::value));
+  }
+
+}
+
+//
+// A fused expression creates no temporaries of an expensive underlying type
+//
+
+struct big : tracing_base {
+  std::vector<unsigned> limbs;
+  explicit big(unsigned v) : limbs(16, v) { }
+  big& operator+=(const big& peer) {
+    for (std::size_t i = 0; i < limbs.size(); ++i) limbs[i] += peer.limbs[i];
+    return *this;
+  }
+  big& operator*=(const big& peer) {
+    for (std::size_t i = 0; i < limbs.size(); ++i) limbs[i] *= peer.limbs[i];
+    return *this;
+  }
+};
+
+struct vec : expr_numeric_typedef<big, vec> {
+  using base = expr_numeric_typedef<big, vec>;
+  using base::base;
+  using base::operator=;
+};
+
+namespace {
+
+unsigned count(operation a, operation b) {
+  const auto& trace = tracing_base::trace;
+  return static_cast<unsigned>(std::count(trace.begin(), trace.end(), a) +
+                               std::count(trace.begin(), trace.end(), b));
+}
+unsigned copies() {
+  return count(operation::copy_constructor, operation::copy_assignment);
+}
+unsigned moves() {
+  return count(operation::move_constructor, operation::move_assignment);
+}
+
+}
+
+SUITE(fusion) {
+
+  TEST(assign) {
+    vec a(1u), b(2u), c(3u), d(4u), x(0u);
+    tracing_base::clear_trace();
+    x = a + b + c + d;
+    CHECK_EQUAL(1u, copies());
+    CHECK_EQUAL(0u, moves());
+    CHECK_EQUAL(10u, x.value.limbs[0]);
+  }
+
+  TEST(construct) {
+    vec a(1u), b(2u), c(3u), d(4u);
+    tracing_base::clear_trace();
+    vec x = a + b + c + d;
+    CHECK_EQUAL(1u, copies());
+    CHECK_EQUAL(1u, moves());
+    CHECK_EQUAL(10u, x.value.limbs[0]);
+  }
+
+  TEST(in_place) {
+    vec a(1u), x(5u);
+    tracing_base::clear_trace();
+    x = x + a + a;
+    CHECK_EQUAL(0u, copies());
+    CHECK_EQUAL(0u, moves());
+    CHECK_EQUAL( 7u, x.value.limbs[0]);
+  }
+
+  TEST(commutative) {
+    vec a(1u), b(2u), c(3u), x(0u);
+    tracing_base::clear_trace();
+    x = a + b * c;
+    CHECK_EQUAL(1u, copies());
+    CHECK_EQUAL(0u, moves());
+    CHECK_EQUAL( 7u, x.value.limbs[0]);
+  }
+
+  TEST(alias) {
+    vec a(2u), x(3u);
+    tracing_base::clear_trace();
+    x = a * x;
+    CHECK_EQUAL(0u, copies());
+    CHECK_EQUAL(0u, moves());
+    CHECK_EQUAL( 6u, x.value.limbs[0]);
+    tracing_base::clear_trace();
+    x = a + (a * x);
+    CHECK_EQUAL(0u, copies());
+    CHECK_EQUAL(0u, moves());
+    CHECK_EQUAL(14u, x.value.limbs[0]);
+  }
+
+  TEST(temporary) {
+    vec x(3u);
+    tracing_base::clear_trace();
+    x = x * (x + x);
+    CHECK_EQUAL(1u, copies());
+    CHECK_EQUAL(1u, moves());
+    CHECK_EQUAL(18u, x.value.limbs[0]);
+  }
+
+}
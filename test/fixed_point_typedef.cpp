@@ -0,0 +1,285 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/fixed_point_typedef.hpp"
+#include "opaque/binop/binop_batch.hpp"
+#include "opaque/format.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct price : fixed_point_typedef<std::int64_t, 16, price> {
+  using base = fixed_point_typedef<std::int64_t, 16, price>;
+  using base::base;
+};
+
+struct notional : fixed_point_typedef<std::int64_t, 24, notional> {
+  using base = fixed_point_typedef<std::int64_t, 24, notional>;
+  using base::base;
+};
+
+// A whole number of units, which can be bought at a price
+struct quantity : fixed_point_typedef<std::int32_t, 0, quantity>
+  , binop::multipliable<notional, true, price, quantity, notional, notional>
+  , binop::multipliable<notional, true, quantity, price, notional, notional>
+  , binop::dividable<price, false, notional, quantity, price, price> {
+  using base = fixed_point_typedef<std::int32_t, 0, quantity>;
+  using base::base;
+};
+
+template <typename T, unsigned F>
+struct fixed : fixed_point_typedef<T, F, fixed<T,F>> {
+  using base = fixed_point_typedef<T, F, fixed<T,F>>;
+  using base::base;
+};
+
+static_assert(price::frac_bits == 16, "Wrong scale");
+static_assert(price::from_floating(1.5).value == 3 << 15, "Not constexpr");
+static_assert(static_cast<std::int64_t>(static_cast<double>(
+    price::from_floating(-2.25)) * 4) == -9, "Not constexpr");
+static_assert(notional(price::from_floating(0.5)).value == 1 << 23,
+              "Not constexpr");
+
+static_assert(not std::is_constructible<price, double>::value,
+              "Constructible from floating point");
+static_assert(not std::is_convertible<notional, price>::value,
+              "Implicitly rescaled");
+static_assert(detail::is_fixed_point_opaque<price>::value and
+              not detail::is_arithmetic_opaque<price>::value,
+              "Formatted as an integer");
+
+template <int N>
+struct places : default_format_traits {
+  static constexpr int precision() noexcept { return N; }
+};
+
+struct dollars : places<2> {
+  static constexpr const char * prefix() noexcept { return "$"; }
+};
+
+static std::string fmt(int precision, double v) {
+  char buffer[64];
+  std::snprintf(buffer, sizeof buffer, "%.*f", precision, v);
+  return buffer;
+}
+
+SUITE(fixed_point) {
+
+TEST(convert) {
+  CHECK_EQUAL(98304, price::from_floating(1.5).value);
+  CHECK_EQUAL(-98304, price::from_floating(-1.5f).value);
+  // To nearest, halfway cases away from zero
+  using f2 = fixed<int, 2>;
+  CHECK_EQUAL(1, f2::from_floating(0.125).value);
+  CHECK_EQUAL(-1, f2::from_floating(-0.125).value);
+  CHECK_EQUAL(0, f2::from_floating(0.124).value);
+  CHECK_EQUAL(5, f2::from_floating(1.3).value);
+  CHECK_EQUAL(-5, f2::from_floating(-1.3L).value);
+  CHECK_EQUAL(std::string("-1.25"),
+              fmt(2, static_cast<double>(f2(-5))));
+  CHECK_EQUAL(std::string("0.75"),
+              fmt(2, static_cast<double>(f2(3))));
+  CHECK_EQUAL(std::string("0.75"),
+              fmt(2, static_cast<float>(f2(3))));
+}
+
+TEST(arithmetic) {
+  const price a = price::from_floating(2.5);
+  const price b = price::from_floating(-1.25);
+  CHECK_EQUAL(price::from_floating(-3.125), a * b);
+  CHECK_EQUAL(price::from_floating(-2.0), a / b);
+  CHECK_EQUAL(price::from_floating(1.25), a + b);
+  CHECK_EQUAL(price::from_floating(3.75), a - b);
+  CHECK_EQUAL(price::from_floating(0.0), a % price::from_floating(1.25));
+  price c = a;
+  CHECK_EQUAL(price::from_floating(3.5), ++c);
+  CHECK_EQUAL(price::from_floating(3.5), c--);
+  CHECK_EQUAL(price::from_floating(2.5), c);
+  // Products round toward negative infinity, quotients toward zero
+  using f1 = fixed<int, 1>;
+  CHECK_EQUAL(f1(-1), f1(1) * f1(-1));
+  CHECK_EQUAL(f1(0), f1(1) * f1(1));
+  CHECK_EQUAL(f1(-1), f1(-3) / f1(4));
+  // Full width products of 64-bit values
+  const price big = price::from_floating(1e9);
+  CHECK_EQUAL(price::from_floating(1e12), big * price::from_floating(1e3));
+  CHECK_EQUAL(price::from_floating(1e6), big / price::from_floating(1e3));
+  // Small unsigned types
+  using u4 = fixed<std::uint8_t, 4>;
+  CHECK_EQUAL(u4::from_floating(7.5), u4::from_floating(2.5) *
+                                      u4::from_floating(3.0));
+  CHECK_EQUAL(u4::from_floating(0.75), u4::from_floating(1.5) /
+                                       u4::from_floating(2.0));
+}
+
+TEST(rescale) {
+  CHECK_EQUAL(notional::from_floating(-1.75),
+              notional(price::from_floating(-1.75)));
+  CHECK_EQUAL(price::from_floating(-1.75),
+              price(notional::from_floating(-1.75)));
+  // Narrowing rounds toward negative infinity
+  CHECK_EQUAL(price(-1), price(notional(-1)));
+  CHECK_EQUAL(price(0), price(notional(255)));
+  CHECK_EQUAL(quantity(3), quantity(price::from_floating(3.99)));
+  CHECK_EQUAL(fixed<std::uint16_t, 15>(std::uint16_t(0x8000)),
+              fixed<std::uint16_t, 15>(fixed<std::uint8_t, 0>(
+                  std::uint8_t(1))));
+}
+
+TEST(mixed) {
+  const price p = price::from_floating(101.25);
+  const quantity q(7);
+  CHECK_EQUAL(notional::from_floating(708.75), p * q);
+  CHECK_EQUAL(notional::from_floating(708.75), q * p);
+  CHECK_EQUAL(notional::from_floating(-708.75), -p * q);
+  CHECK_EQUAL(p, p * q / q);
+  // Finer than either operand, the product is exact
+  const price tick(1);
+  CHECK_EQUAL(notional(7 << 8), tick * q);
+  CHECK_EQUAL(notional::from_floating(1e9 * 101.25),
+              p * quantity(1000000000));
+}
+
+TEST(format) {
+  CHECK_EQUAL(std::string("101.25"), to_string(price::from_floating(101.25)));
+  CHECK_EQUAL(std::string("-0.5"), to_string(price::from_floating(-0.5)));
+  CHECK_EQUAL(std::string("0"), to_string(price(0)));
+  CHECK_EQUAL(std::string("12"), to_string(quantity(12)));
+  CHECK_EQUAL(std::string("-2147483648"),
+              to_string(quantity(std::numeric_limits<std::int32_t>::min())));
+  using f8 = fixed<int, 8>;
+  CHECK_EQUAL(std::string("0.004"), to_string(f8(1)));
+  CHECK_EQUAL(std::string("0.996"), to_string(f8(255)));
+  CHECK_EQUAL(std::string("-128"), to_string(f8(-32768)));
+  CHECK_EQUAL(std::string("127.996"), to_string(f8(32767)));
+  CHECK_EQUAL(std::string("0.000000000000000002"),
+              to_string(fixed<std::int64_t, 59>(1)));
+  CHECK_EQUAL(std::string("-16"),
+              to_string(fixed<std::int64_t, 59>(
+                  std::numeric_limits<std::int64_t>::min())));
+  CHECK_EQUAL(std::string("1"),
+              to_string(fixed<std::uint64_t, 59>(std::uint64_t(1) << 59)));
+}
+
+TEST(shortest) {
+  using f8 = fixed<int, 8>;
+  for (int i = -32768; i != 32768; ++i) {
+    const f8 v(i);
+    const std::string s = to_string(v);
+    CHECK_EQUAL(v, f8::from_floating(std::strtod(s.c_str(), nullptr)));
+    // With one digit fewer, rounded either way, the value is lost
+    const std::size_t point = s.find('.');
+    if (point == std::string::npos) continue;
+    const std::string t = s.substr(0, s.size() - 1);
+    const double shorter = std::strtod(t.c_str(), nullptr);
+    const double step = std::pow(10.0, -static_cast<double>(t.size() -
+                                                            point - 1));
+    CHECK_EQUAL(false, v == f8::from_floating(shorter));
+    CHECK_EQUAL(false, v == f8::from_floating(i < 0 ? shorter - step
+                                                    : shorter + step));
+  }
+  using f2 = fixed<int, 2>;
+  // Halfway between two digits, the last rounds away from zero
+  CHECK_EQUAL(std::string("0.8"), to_string(f2(3)));
+  CHECK_EQUAL(std::string("-0.3"), to_string(f2(-1)));
+}
+
+TEST(precision) {
+  using f8 = fixed<int, 8>;
+  // Exact to eight places, as printf is
+  for (int i = -32768; i != 32768; ++i) {
+    const f8 v(i);
+    CHECK_EQUAL(fmt(8, static_cast<double>(v)),
+                (to_string<f8, places<8>>(v)));
+  }
+  // Rounded half away from zero
+  CHECK_EQUAL(std::string("1.00"), (to_string<f8, places<2>>(f8(255))));
+  CHECK_EQUAL(std::string("-1.00"), (to_string<f8, places<2>>(f8(-255))));
+  CHECK_EQUAL(std::string("0.13"), (to_string<f8, places<2>>(f8(32))));
+  CHECK_EQUAL(std::string("0.12"), (to_string<f8, places<2>>(f8(31))));
+  CHECK_EQUAL(std::string("2"), (to_string<f8, places<0>>(f8(384))));
+  CHECK_EQUAL(std::string("-2"), (to_string<f8, places<0>>(f8(-384))));
+  CHECK_EQUAL(std::string("-0"), (to_string<f8, places<0>>(f8(-1))));
+  CHECK_EQUAL(std::string("0.500000000000"),
+              (to_string<f8, places<12>>(f8(128))));
+  CHECK_EQUAL(std::string("12.000"),
+              (to_string<quantity, places<3>>(quantity(12))));
+  CHECK_EQUAL(std::string("$101.20"),
+              (to_string<price, dollars>(price::from_floating(101.2))));
+}
+
+TEST(buffer) {
+  char buffer[8];
+  const price p = price::from_floating(-101.25);
+  for (std::size_t n = 0; n != 7; ++n) {
+    const to_chars_result r = to_chars(buffer, buffer + n, p);
+    CHECK_EQUAL(true, r.ec == std::errc::value_too_large);
+    CHECK_EQUAL(buffer + n, r.ptr);
+  }
+  const to_chars_result r = to_chars(buffer, buffer + 7, p);
+  CHECK_EQUAL(true, r.ec == std::errc());
+  CHECK_EQUAL(std::string("-101.25"), std::string(buffer, r.ptr));
+}
+
+TEST(batch) {
+  using add = binop::addable<price>;
+  using mul = binop::multipliable<price>;
+  using buy = binop::multipliable<notional, true, price, quantity,
+                                  notional, notional>;
+  CHECK_EQUAL(true, binop::is_batchable<price>::value);
+  CHECK_EQUAL(true, binop::is_lane_operation<add>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<mul>::value);
+  CHECK_EQUAL(false, binop::is_lane_operation<buy>::value);
+  std::vector<price> a, b, sum(37), product(37);
+  std::vector<quantity> q;
+  std::vector<notional> n(37);
+  for (int i = 0; i != 37; ++i) {
+    a.push_back(price::from_floating(i * 1.25 - 20));
+    b.push_back(price::from_floating(3.5 - i * 0.75));
+    q.push_back(quantity(i - 18));
+  }
+  binop::apply<add>(sum, a, b);
+  binop::apply<mul>(product, a, b);
+  binop::apply<buy>(n, a, q);
+  for (std::size_t i = 0; i != a.size(); ++i) {
+    CHECK_EQUAL(a[i] + b[i], sum[i]);
+    CHECK_EQUAL(a[i] * b[i], product[i]);
+    CHECK_EQUAL(a[i] * q[i], n[i]);
+  }
+}
+
+}
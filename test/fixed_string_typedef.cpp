@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/fixed_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+using namespace opaque;
+using opaque::experimental::fixed_string;
+
+UNIT_TEST_MAIN
+
+struct code : experimental::fixed_string_typedef<24, code> {
+  using base = experimental::fixed_string_typedef<24, code>;
+  using base::base;
+};
+
+struct tiny : experimental::fixed_string_typedef<4, tiny> {
+  using base = experimental::fixed_string_typedef<4, tiny>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(code)
+
+TEST(traits) {
+  CHECK_EQUAL(true, std::is_trivially_copyable<code>::value);
+  CHECK_EQUAL(true, std::is_trivially_copyable<fixed_string<300>>::value);
+  CHECK_EQUAL(true, sizeof(fixed_string<15>) == 17);
+  CHECK_EQUAL(true, sizeof(fixed_string<300>) == 304);
+  CHECK_EQUAL(true, sizeof(code) == sizeof(fixed_string<24>));
+  CHECK_EQUAL(24u, code::capacity());
+
+  CHECK_EQUAL(true , (std::is_constructible<code, const char *>::value));
+  CHECK_EQUAL(false, (std::is_convertible<const char *, code>::value));
+  CHECK_EQUAL(true , (std::is_constructible<code, std::string>::value));
+  CHECK_EQUAL(false, (std::is_convertible<std::string, code>::value));
+  CHECK_EQUAL(false, (std::is_constructible<code, tiny>::value));
+}
+
+TEST(basics) {
+  code empty;
+  CHECK_EQUAL(true, empty.empty());
+  CHECK_EQUAL(0, std::strcmp(empty.c_str(), ""));
+
+  code a("instrument_code_01");
+  CHECK_EQUAL(18u, a.size());
+  CHECK_EQUAL("instrument_code_01", a.str());
+  CHECK_EQUAL(true, a == "instrument_code_01");
+  CHECK_EQUAL(true, a != "instrument");
+  CHECK_EQUAL('i', a.front());
+  CHECK_EQUAL('1', a.back());
+
+  a += '!';
+  a.append(code("abc"), 1, 1);
+  CHECK_EQUAL("instrument_code_01!b", a.str());
+  CHECK_EQUAL(true, code("ab") + code("cd") == "abcd");
+  CHECK_EQUAL(true, 'x' + code("y") + 'z' == "xyz");
+  CHECK_EQUAL(true, code("abc") < code("abd"));
+  CHECK_EQUAL(true, code("abc") < "abcd");
+  CHECK_EQUAL(true, "abd" > code("abc"));
+  CHECK_EQUAL(true, code("b").compare(code("a")) > 0);
+  CHECK_EQUAL(true, code("abcdef").substr(2, 3) == "cde");
+
+  // Self-referential operations
+  code s("abc");
+  s.append(s);
+  CHECK_EQUAL("abcabc", s.str());
+  s.insert(1, s, 3, 2);
+  CHECK_EQUAL("aabbcabc", s.str());
+
+  code t("hello");
+  code u("world");
+  swap(t, u);
+  CHECK_EQUAL("world", t.str());
+  CHECK_EQUAL("hello", u.str());
+
+  auto it = u.insert(u.cbegin() + 1, 'X');
+  CHECK_EQUAL('X', *it);
+  u.erase(u.cbegin(), u.cbegin() + 2);
+  CHECK_EQUAL("ello", u.str());
+}
+
+TEST(capacity) {
+  tiny t("abcd");
+  try {
+    t += 'e';
+    CHECK_CATCH(std::length_error, e);
+  }
+  CHECK_EQUAL("abcd", t.str());
+  try {
+    tiny u("abcde");
+    CHECK_CATCH(std::length_error, e);
+  }
+  try {
+    t.insert(9, 1, 'x');
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  try {
+    t.at(4);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  t.pop_back();
+  t.resize(4, 'z');
+  CHECK_EQUAL("abcz", t.str());
+}
+
+TEST(representation) {
+  // Unused characters stay zero, so equal strings are bytewise equal
+  code a("abcdefgh");
+  a.erase(3);
+  code b("abc");
+  CHECK_EQUAL(0, std::memcmp(&a, &b, sizeof(code)));
+
+  // Arrays survive a round trip through raw bytes
+  std::vector<code> v{ code("one"), code("two"), code("three") };
+  std::vector<unsigned char> bytes(v.size() * sizeof(code));
+  std::memcpy(bytes.data(), v.data(), bytes.size());
+  std::vector<code> w(v.size());
+  std::memcpy(w.data(), bytes.data(), bytes.size());
+  CHECK_EQUAL(true, v == w);
+}
+
+TEST(hashing) {
+  std::unordered_set<code> set{ code("a"), code("b"), code("a") };
+  CHECK_EQUAL(2u, set.size());
+  CHECK_EQUAL(true, std::hash<code>{}(code("xyz")) ==
+      std::hash<code>{}(code("xyz")));
+  CHECK_EQUAL(true, std::hash<code>{}(code("xyz")) ==
+      static_cast<std::size_t>(hashing::hash_bytes("xyz", 3)));
+}
+
+TEST(model) {
+  // Random edits and searches, checked against std::string
+  std::mt19937 rng(5);
+  const char alphabet[] = "abc";
+  unsigned errors = 0;
+  for (unsigned round = 0; round < 2000; ++round) {
+    std::string m;
+    fixed_string<24> f;
+    for (unsigned step = 0; step < 12; ++step) {
+      const std::size_t pos = static_cast<std::size_t>(rng() % (m.size() + 1));
+      const std::size_t n = static_cast<std::size_t>(rng() % 5);
+      std::string s(n, alphabet[rng() % 3]);
+      if (n > 1) s[0] = alphabet[rng() % 3];
+      switch (rng() % 4) {
+      case 0:
+        if (m.size() + n > 24) break;
+        m.insert(pos, s); f.insert(pos, s.data(), s.size()); break;
+      case 1:
+        m.erase(pos, n); f.erase(pos, n); break;
+      case 2:
+        if (m.size() - std::min(n, m.size() - pos) + s.size() > 24) break;
+        m.replace(pos, n, s); f.replace(pos, n, s.data(), s.size()); break;
+      default:
+        if (m.size() + n > 24) break;
+        m.append(s); f.append(s.data(), s.size()); break;
+      }
+      if (f.str() != m) ++errors;
+      if (f.find(s.data(), pos, n) != m.find(s, pos)) ++errors;
+      if (f.rfind(s.data(), pos, n) != m.rfind(s, pos)) ++errors;
+      if (f.find_first_of(s.data(), pos, n) != m.find_first_of(s, pos)) {
+        ++errors;
+      }
+      if (f.find_last_of(s.data(), pos, n) != m.find_last_of(s, pos)) {
+        ++errors;
+      }
+      if (f.find_first_not_of(s.data(), pos, n) !=
+          m.find_first_not_of(s, pos)) ++errors;
+      if (f.find_last_not_of(s.data(), pos, n) !=
+          m.find_last_not_of(s, pos)) ++errors;
+      const int c = f.compare(s.data(), s.size());
+      const int d = m.compare(s);
+      if ((c < 0) != (d < 0) or (c > 0) != (d > 0)) ++errors;
+      if (f.c_str()[f.size()] != '\0') ++errors;
+    }
+  }
+  CHECK_EQUAL(0u, errors);
+}
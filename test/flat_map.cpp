@@ -0,0 +1,219 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/flat_map.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/string_typedef.hpp"
+#include "opaque/type_traits.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct user_id : numeric_typedef<std::uint32_t, user_id> {
+  using base = numeric_typedef<std::uint32_t, user_id>;
+  using base::base;
+};
+
+struct order_id : numeric_typedef<std::uint64_t, order_id> {
+  using base = numeric_typedef<std::uint64_t, order_id>;
+  using base::base;
+};
+
+struct symbol : experimental::string_typedef<std::string, symbol> {
+  using base = experimental::string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(user_id)
+OPAQUE_HASHABLE_WITH(order_id, opaque::hashing::mix)
+OPAQUE_HASHABLE_WITH(symbol, opaque::hashing::bytes)
+
+namespace opaque {
+template <> struct allow_underlying_lookup<order_id> : std::true_type { };
+}
+
+// Every key collides, so probing must rely on key comparison
+struct constant_hash {
+  std::size_t operator()(const user_id&) const noexcept { return 42; }
+};
+
+template <typename M, typename = void>
+struct underlying_find : std::false_type { };
+template <typename M>
+struct underlying_find<M, void_t<decltype(
+    std::declval<M&>().find(std::declval<typename M::underlying_type>()))>>
+  : std::true_type { };
+
+TEST(basic) {
+  flat_map<user_id, std::string> m;
+  CHECK_EQUAL(true, m.empty());
+  CHECK_EQUAL(true, m.begin() == m.end());
+  CHECK_EQUAL(true, m.find(user_id(1u)) == m.end());
+
+  CHECK_EQUAL(true, m.try_emplace(user_id(1u), "one").second);
+  CHECK_EQUAL(false, m.try_emplace(user_id(1u), "uno").second);
+  CHECK_EQUAL(true, m.insert(std::make_pair(user_id(2u), "two")).second);
+  m[user_id(3u)] = "three";
+  CHECK_EQUAL(3u, m.size());
+  CHECK_EQUAL("one", m.at(user_id(1u)));
+  CHECK_EQUAL("two", m.find(user_id(2u))->second);
+  CHECK_EQUAL(1u, m.count(user_id(3u)));
+  CHECK_EQUAL(false, m.contains(user_id(4u)));
+
+  try {
+    m.at(user_id(4u));
+    CHECK_CATCH(std::out_of_range, e);
+  }
+
+  CHECK_EQUAL(1u, m.erase(user_id(2u)));
+  CHECK_EQUAL(0u, m.erase(user_id(2u)));
+  CHECK_EQUAL(2u, m.size());
+  CHECK_EQUAL(false, m.contains(user_id(2u)));
+
+  // Key 0 is an ordinary key: occupancy is in the control bytes
+  m[user_id(0u)] = "zero";
+  CHECK_EQUAL("zero", m.at(user_id(0u)));
+
+  m.clear();
+  CHECK_EQUAL(0u, m.size());
+  CHECK_EQUAL(false, m.contains(user_id(1u)));
+}
+
+TEST(model) {
+  // Random operations, checked against std::unordered_map, with a key
+  // range small enough that erased slots are reused often
+  flat_map<user_id, unsigned> m;
+  std::unordered_map<std::uint32_t, unsigned> model;
+  std::mt19937 rng(7);
+  unsigned mismatches = 0;
+  for (unsigned step = 0; step != 200000; ++step) {
+    const std::uint32_t k = static_cast<std::uint32_t>(rng() % 5000);
+    switch (rng() % 4) {
+    case 0:
+    case 1:
+      m[user_id(k)] = step;
+      model[k] = step;
+      break;
+    case 2:
+      if (m.erase(user_id(k)) != model.erase(k)) ++mismatches;
+      break;
+    default: {
+      auto i = m.find(user_id(k));
+      auto j = model.find(k);
+      if ((i == m.end()) != (j == model.end())) ++mismatches;
+      else if (i != m.end() and i->second != j->second) ++mismatches;
+      break;
+    }
+    }
+  }
+  CHECK_EQUAL(0u, mismatches);
+  CHECK_EQUAL(model.size(), m.size());
+  std::size_t visited = 0;
+  for (const auto& v : m) {
+    ++visited;
+    if (model.at(v.first.value) != v.second) ++mismatches;
+  }
+  CHECK_EQUAL(model.size(), visited);
+  CHECK_EQUAL(0u, mismatches);
+}
+
+TEST(growth) {
+  flat_map<order_id, std::uint64_t> m;
+  for (std::uint64_t i = 0; i != 100000; ++i) m[order_id(i << 20)] = i;
+  CHECK_EQUAL(100000u, m.size());
+  CHECK(m.capacity() >= m.size());
+  std::uint64_t missing = 0;
+  for (std::uint64_t i = 0; i != 100000; ++i) {
+    auto f = m.find(order_id(i << 20));
+    if (f == m.end() or f->second != i) ++missing;
+  }
+  CHECK_EQUAL(0u, missing);
+
+  flat_map<order_id, int> r(1000);
+  const std::size_t reserved = r.capacity();
+  for (std::uint64_t i = 0; i != 1000; ++i) r[order_id(i)] = 0;
+  CHECK_EQUAL(reserved, r.capacity());
+}
+
+TEST(collisions) {
+  flat_map<user_id, int, constant_hash> m;
+  for (std::uint32_t i = 0; i != 100; ++i) m[user_id(i)] = static_cast<int>(i);
+  for (std::uint32_t i = 0; i != 100; i += 2) m.erase(user_id(i));
+  CHECK_EQUAL(50u, m.size());
+  int sum = 0;
+  for (std::uint32_t i = 1; i < 100; i += 2) sum += m.at(user_id(i));
+  CHECK_EQUAL(2500, sum);
+}
+
+TEST(copy_move_erase_iterator) {
+  flat_map<symbol, int> m;
+  m[symbol("AAPL")] = 1;
+  m[symbol("MSFT")] = 2;
+  m[symbol("GOOG")] = 3;
+
+  flat_map<symbol, int> copy(m);
+  CHECK_EQUAL(3u, copy.size());
+  CHECK_EQUAL(2, copy.at(symbol("MSFT")));
+
+  flat_map<symbol, int> moved(std::move(copy));
+  CHECK_EQUAL(3u, moved.size());
+  CHECK_EQUAL(0u, copy.size());
+
+  copy = moved;
+  CHECK_EQUAL(3, copy.at(symbol("GOOG")));
+
+  for (auto i = m.begin(); i != m.end(); ) {
+    if (i->second % 2) i = m.erase(i);
+    else ++i;
+  }
+  CHECK_EQUAL(1u, m.size());
+  CHECK_EQUAL(true, m.contains(symbol("MSFT")));
+
+  flat_map<symbol, int>::const_iterator c = m.begin();
+  CHECK_EQUAL(2, c->second);
+}
+
+TEST(underlying_lookup) {
+  flat_map<order_id, int> m;
+  m[order_id(7u)] = 70;
+  CHECK_EQUAL(70, m.find(std::uint64_t(7))->second);
+  CHECK_EQUAL(70, m.at(std::uint64_t(7)));
+  CHECK_EQUAL(true, m.contains(std::uint64_t(7)));
+  CHECK_EQUAL(false, m.contains(std::uint64_t(8)));
+
+  CHECK_EQUAL(true , underlying_find<flat_map<order_id, int>>::value);
+  CHECK_EQUAL(false, underlying_find<flat_map<user_id, int>>::value);
+}
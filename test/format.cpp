@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/format.hpp"
+#include "opaque/inconvertibool.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/fixed_string_typedef.hpp"
+#include "opaque/experimental/interned_string_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+
+UNIT_TEST_MAIN
+
+struct count : opaque::numeric_typedef<std::int64_t, count> {
+  using base = opaque::numeric_typedef<std::int64_t, count>;
+  using base::base;
+};
+
+struct level : opaque::numeric_typedef<std::uint8_t, level> {
+  using base = opaque::numeric_typedef<std::uint8_t, level>;
+  using base::base;
+};
+
+struct meters : opaque::numeric_typedef<double, meters> {
+  using base = opaque::numeric_typedef<double, meters>;
+  using base::base;
+};
+
+struct price : opaque::numeric_typedef<double, price> {
+  using base = opaque::numeric_typedef<double, price>;
+  using base::base;
+};
+
+struct name : opaque::experimental::safer_string_typedef<std::string, name> {
+  using base = opaque::experimental::safer_string_typedef<std::string, name>;
+  using base::base;
+};
+
+struct code : opaque::experimental::fixed_string_typedef<8, code> {
+  using base = opaque::experimental::fixed_string_typedef<8, code>;
+  using base::base;
+};
+
+struct symbol : opaque::experimental::interned_string_typedef<symbol> {
+  using base = opaque::experimental::interned_string_typedef<symbol>;
+  using base::base;
+};
+
+struct payload { };
+
+namespace opaque {
+template <> struct format_traits<meters> : default_format_traits {
+  static constexpr const char * suffix() noexcept { return " m"; }
+};
+template <> struct format_traits<price> : default_format_traits {
+  static constexpr const char * prefix() noexcept { return "$"; }
+  static constexpr int precision() noexcept { return 2; }
+};
+}
+
+template <typename O>
+static std::string chars_of(const O& o) {
+  char buffer[64];
+  const opaque::to_chars_result r =
+    opaque::to_chars(buffer, buffer + sizeof buffer, o);
+  return r.ec == std::errc() ? std::string(buffer, r.ptr) : "error";
+}
+
+template <typename O, typename = void>
+struct can_format : std::false_type { };
+template <typename O>
+struct can_format<O, opaque::void_t<decltype(opaque::to_chars(
+    std::declval<char *>(), std::declval<char *>(), std::declval<O>()))>>
+  : std::true_type { };
+
+SUITE(to_chars) {
+  TEST(integers) {
+    CHECK_EQUAL("0", chars_of(count(0)));
+    CHECK_EQUAL("-7", chars_of(count(-7)));
+    CHECK_EQUAL("9223372036854775807",
+                chars_of(count(std::numeric_limits<std::int64_t>::max())));
+    CHECK_EQUAL("-9223372036854775808",
+                chars_of(count(std::numeric_limits<std::int64_t>::min())));
+    CHECK_EQUAL("255", chars_of(level(std::uint8_t(255))));
+    CHECK_EQUAL("true", chars_of(opaque::inconvertibool(true)));
+    CHECK_EQUAL("false", chars_of(opaque::inconvertibool(false)));
+  }
+
+  TEST(integers_match_ostream) {
+    std::mt19937_64 rng(19);
+    unsigned wrong = 0;
+    for (unsigned i = 0; i != 10000; ++i) {
+      // Every digit count, both signs
+      const std::int64_t v = static_cast<std::int64_t>(rng() >> (rng() % 64));
+      const count c(i % 2 ? v : -v);
+      std::ostringstream s;
+      s << c.value;
+      wrong += s.str() != chars_of(c);
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(floating_point) {
+    CHECK_EQUAL("0.1", chars_of(meters(0.1)));
+    CHECK_EQUAL("-2.5", chars_of(meters(-2.5)));
+    CHECK_EQUAL("1e+100", chars_of(meters(1e100)));
+    std::mt19937_64 rng(3);
+    unsigned wrong = 0;
+    for (unsigned i = 0; i != 1000; ++i) {
+      const double v = std::ldexp(static_cast<double>(rng()), -40);
+      const std::string s = chars_of(meters(v));
+      const double back = std::strtod(s.c_str(), nullptr);
+      wrong += back < v or v < back;
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(decimals) {
+    CHECK_EQUAL("0", chars_of(meters(0.0)));
+    CHECK_EQUAL("-0", chars_of(meters(-0.0)));
+    CHECK_EQUAL("123456.789", chars_of(meters(123456.789)));
+    CHECK_EQUAL("-0.0625", chars_of(meters(-0.0625)));
+    CHECK_EQUAL("0.3", chars_of(meters(0.3)));
+    CHECK_EQUAL("0.30000000000000004", chars_of(meters(0.1 + 0.2)));
+    std::mt19937_64 rng(11);
+    unsigned wrong = 0;
+    for (unsigned i = 0; i != 10000; ++i) {
+      // Values with few decimal places are written with exactly those
+      const std::uint64_t m = (rng() % 900000000 + 100000000) * 10 +
+                              1 + rng() % 9;
+      const unsigned places = static_cast<unsigned>(rng() % 8);
+      std::string expected = std::to_string(m);
+      if (places) {
+        expected.insert(expected.size() - places, ".");
+      }
+      const double v = std::strtod(expected.c_str(), nullptr);
+      wrong += chars_of(meters(v)) != expected;
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(strings) {
+    CHECK_EQUAL("hello", chars_of(name("hello")));
+    CHECK_EQUAL("", chars_of(name()));
+    CHECK_EQUAL("AB-12", chars_of(code("AB-12")));
+    CHECK_EQUAL("ticker", chars_of(symbol("ticker")));
+  }
+
+  TEST(overflow) {
+    char buffer[4];
+    const opaque::to_chars_result r =
+      opaque::to_chars(buffer, buffer + sizeof buffer, count(-1234));
+    CHECK_EQUAL(true, r.ec == std::errc::value_too_large);
+    CHECK_EQUAL(true, r.ptr == buffer + sizeof buffer);
+    const opaque::to_chars_result s =
+      opaque::to_chars(buffer, buffer + sizeof buffer, count(-123));
+    CHECK_EQUAL(true, s.ec == std::errc());
+    CHECK_EQUAL(true, s.ptr == buffer + sizeof buffer);
+    CHECK_EQUAL(true, opaque::to_chars(buffer, buffer + 3, name("four")).ec
+                      == std::errc::value_too_large);
+  }
+
+  TEST(traits) {
+    CHECK_EQUAL(true , can_format<count>::value);
+    CHECK_EQUAL(true , can_format<name>::value);
+    CHECK_EQUAL(false, can_format<int>::value);
+    CHECK_EQUAL(false, can_format<std::string>::value);
+    CHECK_EQUAL(false, can_format<payload>::value);
+  }
+}
+
+SUITE(format_to) {
+  TEST(format_traits) {
+    CHECK_EQUAL("12.5 m", opaque::to_string(meters(12.5)));
+    CHECK_EQUAL("$3.10", opaque::to_string(price(3.1)));
+    CHECK_EQUAL("$-0.50", opaque::to_string(price(-0.5)));
+    CHECK_EQUAL("42", opaque::to_string(count(42)));
+    CHECK_EQUAL("hi", opaque::to_string(name("hi")));
+  }
+
+  TEST(overflow) {
+    char buffer[8];
+    CHECK_EQUAL(true, opaque::format_to(buffer, buffer + 8, meters(125.5)).ec
+                      == std::errc());
+    CHECK_EQUAL(true, opaque::format_to(buffer, buffer + 6, meters(125.5)).ec
+                      == std::errc::value_too_large);
+    CHECK_EQUAL(true, opaque::format_to(buffer, buffer, price(1)).ec
+                      == std::errc::value_too_large);
+  }
+
+  TEST(long_strings) {
+    const std::string text(1000, 'z');
+    CHECK_EQUAL(text, opaque::to_string(name(text)));
+  }
+}
@@ -30,7 +30,11 @@
 #include "opaque/experimental/string_typedef.hpp"
 #include "opaque/hash.hpp"
 #include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <set>
+#include <string>
 #include <unordered_set>
+#include <vector>
 
 UNIT_TEST_MAIN
 
@@ -44,8 +48,23 @@ struct a_string : opaque::experimental::string_typedef<std::string, a_string> {
   using base::base;
 };
 
+struct mixed_id : opaque::numeric_typedef<std::uint64_t, mixed_id> {
+  using base = opaque::numeric_typedef<std::uint64_t, mixed_id>;
+  using base::base;
+};
+
+struct hashed_string
+  : opaque::experimental::string_typedef<std::string, hashed_string> {
+  using base = opaque::experimental::string_typedef<std::string, hashed_string>;
+  using base::base;
+};
+
 OPAQUE_HASHABLE(safe_int)
 OPAQUE_HASHABLE(a_string)
+OPAQUE_HASHABLE_WITH(mixed_id, opaque::hashing::mix)
+OPAQUE_HASHABLE_WITH(hashed_string, opaque::hashing::bytes)
+
+using namespace opaque::hashing;
 
 TEST(numeric) {
   std::unordered_set<safe_int> s;
@@ -56,3 +75,61 @@ TEST(string) {
   std::unordered_set<a_string> s;
   s.emplace("Hello");
 }
+
+TEST(policy_selection) {
+  std::unordered_set<mixed_id> ids;
+  ids.emplace(5u);
+  CHECK_EQUAL(1u, ids.count(mixed_id(5u)));
+  CHECK_EQUAL(mix{}(std::uint64_t(5)), std::hash<mixed_id>{}(mixed_id(5u)));
+
+  std::unordered_set<hashed_string> strings;
+  strings.emplace("Hello");
+  CHECK_EQUAL(1u, strings.count(hashed_string("Hello")));
+  CHECK_EQUAL(bytes{}(std::string("Hello")),
+              std::hash<hashed_string>{}(hashed_string("Hello")));
+}
+
+TEST(standard) {
+  CHECK_EQUAL(std::hash<int>{}(7), standard{}(safe_int(7)));
+  CHECK_EQUAL(std::hash<std::string>{}("x"), standard{}(a_string("x")));
+}
+
+TEST(identity) {
+  CHECK_EQUAL(7u, identity{}(safe_int(7)));
+  CHECK_EQUAL(7u, identity{}(7));
+  CHECK_EQUAL(std::hash<std::string>{}("x"), identity{}(a_string("x")));
+}
+
+TEST(mix) {
+  // Keys sharing their low bits still spread over the low bits of the hash
+  std::set<std::size_t> buckets;
+  for (std::uint64_t i = 0; i != 256; ++i) {
+    buckets.insert(mix{}(mixed_id(i << 16)) & 0xff);
+  }
+  CHECK(buckets.size() > 128);
+  CHECK_EQUAL(mix{}(0.0), mix{}(-0.0));
+  CHECK(mix{}(1.0) != mix{}(2.0));
+  CHECK(mix{}(1.0f) != mix{}(-1.0f));
+  CHECK_EQUAL(0u, mix_bits(0));
+  CHECK(mix_bits(1) != mix_bits(2));
+}
+
+TEST(bytes) {
+  // Every length takes a different path through short, medium and long
+  // inputs; equal content must hash alike wherever it is stored
+  std::string text;
+  std::set<std::uint64_t> seen;
+  for (std::size_t n = 0; n != 200; ++n) {
+    std::vector<char> copy(text.begin(), text.end());
+    CHECK_EQUAL(hash_bytes(text.data(), n), hash_bytes(copy.data(), n));
+    seen.insert(hash_bytes(text.data(), n));
+    text.push_back(static_cast<char>('a' + n % 26));
+  }
+  CHECK_EQUAL(200u, seen.size());
+  CHECK(hash_bytes("abc", 3) != hash_bytes("abc", 3, 1));
+  CHECK(hash_bytes("abc", 3) != hash_bytes("abd", 3));
+  CHECK_EQUAL(bytes{}(hashed_string("Hello")), bytes{}(std::string("Hello")));
+  const std::uint32_t nine = 9;
+  CHECK_EQUAL(static_cast<std::size_t>(hash_bytes(&nine, sizeof(nine))),
+              bytes{}(nine));
+}
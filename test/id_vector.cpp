@@ -0,0 +1,190 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/id_vector.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/type_traits.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct node_id : numeric_typedef<std::uint32_t, node_id> {
+  using base = numeric_typedef<std::uint32_t, node_id>;
+  using base::base;
+};
+
+struct edge_id : numeric_typedef<std::uint32_t, edge_id> {
+  using base = numeric_typedef<std::uint32_t, edge_id>;
+  using base::base;
+};
+
+template <typename C, typename I, typename = void>
+struct indexable : std::false_type { };
+template <typename C, typename I>
+struct indexable<C, I, void_t<decltype(
+    std::declval<C&>()[std::declval<I>()])>>
+  : std::true_type { };
+
+TEST(index_type) {
+  using nodes = id_vector<node_id, std::string>;
+  CHECK_EQUAL(true,  (indexable<nodes, node_id>::value));
+  CHECK_EQUAL(false, (indexable<nodes, edge_id>::value));
+  CHECK_EQUAL(false, (indexable<nodes, std::uint32_t>::value));
+  CHECK_EQUAL(false, (indexable<nodes, std::size_t>::value));
+  CHECK_EQUAL(false, (indexable<nodes, int>::value));
+
+  using view = id_span<node_id, const std::string>;
+  CHECK_EQUAL(true,  (indexable<view, node_id>::value));
+  CHECK_EQUAL(false, (indexable<view, edge_id>::value));
+  CHECK_EQUAL(false, (indexable<view, std::size_t>::value));
+
+  CHECK_EQUAL(true, (std::is_convertible<nodes&, view>::value));
+  CHECK_EQUAL(true, (std::is_convertible<const nodes&, view>::value));
+  CHECK_EQUAL(false, (std::is_convertible<const nodes&,
+        id_span<node_id, std::string>>::value));
+  CHECK_EQUAL(false, (std::is_convertible<nodes&,
+        id_span<edge_id, std::string>>::value));
+}
+
+TEST(append) {
+  id_vector<node_id, std::string> v;
+  CHECK_EQUAL(true, v.empty());
+  CHECK_EQUAL(true, node_id(0u) == v.next_id());
+
+  node_id a = v.push_back("a");
+  std::string b_value("b");
+  node_id b = v.push_back(b_value);
+  node_id c = v.emplace_back(3u, 'c');
+  CHECK_EQUAL(0u, a.value);
+  CHECK_EQUAL(1u, b.value);
+  CHECK_EQUAL(2u, c.value);
+  CHECK_EQUAL(3u, v.size());
+  CHECK_EQUAL(true, node_id(3u) == v.next_id());
+
+  CHECK_EQUAL("a", v[a]);
+  CHECK_EQUAL("b", v[b]);
+  CHECK_EQUAL("ccc", v[c]);
+  v[b] += "b";
+  CHECK_EQUAL("bb", v.at(b));
+  CHECK_EQUAL(true, v.contains(c));
+  CHECK_EQUAL(false, v.contains(node_id(3u)));
+
+  try {
+    v.at(node_id(3u));
+    CHECK_CATCH(std::out_of_range, e);
+  }
+
+  // Contiguous storage
+  CHECK_EQUAL(true, &v[c] == v.data() + 2);
+  CHECK_EQUAL(true, v.values() == std::vector<std::string>({"a","bb","ccc"}));
+
+  v.pop_back();
+  CHECK_EQUAL(false, v.contains(c));
+}
+
+TEST(iteration) {
+  id_vector<node_id, int> v{10, 20, 30, 40};
+
+  int sum = 0;
+  for (int x : v) sum += x;
+  CHECK_EQUAL(100, sum);
+
+  std::uint32_t expected = 0;
+  for (node_id id : v.ids()) {
+    CHECK_EQUAL(expected++, id.value);
+  }
+  CHECK_EQUAL(4u, expected);
+
+  // Items give the index together with a mutable reference
+  for (auto&& item : v.items()) {
+    item.second += static_cast<int>(item.first.value);
+  }
+  const auto& cv = v;
+  expected = 0;
+  for (auto&& item : cv.items()) {
+    CHECK_EQUAL(expected, item.first.value);
+    CHECK_EQUAL(static_cast<int>(10 * (expected + 1) + expected), item.second);
+    ++expected;
+  }
+  CHECK_EQUAL(4u, expected);
+  CHECK_EQUAL(true, (std::is_same<decltype(*cv.items().begin()),
+        std::pair<node_id, const int&>>::value));
+}
+
+static int total(id_span<node_id, const int> s) {
+  int sum = 0;
+  for (auto&& item : s.items()) sum += item.second;
+  return sum;
+}
+
+static void scale(id_span<node_id, int> s, int factor) {
+  for (node_id id : s.ids()) s[id] *= factor;
+}
+
+TEST(span) {
+  id_vector<node_id, int> v{1, 2, 3};
+  scale(v, 2);
+  CHECK_EQUAL(12, total(v));
+
+  id_span<node_id, int> s = v;
+  CHECK_EQUAL(3u, s.size());
+  CHECK_EQUAL(true, s.data() == v.data());
+  CHECK_EQUAL(6, s[node_id(2u)]);
+  CHECK_EQUAL(false, s.contains(node_id(3u)));
+  try {
+    s.at(node_id(3u));
+    CHECK_CATCH(std::out_of_range, e);
+  }
+
+  id_span<node_id, const int> c = s;
+  CHECK_EQUAL(4, c.at(node_id(1u)));
+  CHECK_EQUAL(3u, c.values().size());
+
+  // Views over other contiguous storage
+  int raw[] = { 5, 6 };
+  CHECK_EQUAL(11, total(id_span<node_id, const int>(raw, 2)));
+  CHECK_EQUAL(true, id_span<node_id, int>().empty());
+}
+
+TEST(release) {
+  id_vector<node_id, int> v(std::vector<int>{7, 8});
+  CHECK_EQUAL(8, v[node_id(1u)]);
+  CHECK_EQUAL(true, v == id_vector<node_id, int>({7, 8}));
+  std::vector<int> r = v.release();
+  CHECK_EQUAL(2u, r.size());
+  CHECK_EQUAL(true, v.empty());
+  CHECK_EQUAL(true, v != id_vector<node_id, int>(2u, 7));
+}
@@ -0,0 +1,213 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/interned_string_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "arrtest/arrtest.hpp"
+#include <atomic>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+using namespace opaque;
+using opaque::experimental::intern_table;
+
+UNIT_TEST_MAIN
+
+struct symbol : experimental::interned_string_typedef<symbol> {
+  using base = experimental::interned_string_typedef<symbol>;
+  using base::base;
+};
+
+struct field_name : experimental::interned_string_typedef<field_name> {
+  using base = experimental::interned_string_typedef<field_name>;
+  using base::base;
+};
+
+// Two types sharing one table
+struct shared_tag { };
+struct left_name
+  : experimental::interned_string_typedef<left_name, shared_tag> {
+  using base = experimental::interned_string_typedef<left_name, shared_tag>;
+  using base::base;
+};
+struct right_name
+  : experimental::interned_string_typedef<right_name, shared_tag> {
+  using base = experimental::interned_string_typedef<right_name, shared_tag>;
+  using base::base;
+};
+
+struct text
+  : experimental::safer_string_typedef<std::string, text> {
+  using base = experimental::safer_string_typedef<std::string, text>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(symbol)
+
+TEST(traits) {
+  CHECK_EQUAL(true, sizeof(symbol) == sizeof(std::uint32_t));
+  CHECK_EQUAL(true,  (std::is_constructible<symbol, std::string>::value));
+  CHECK_EQUAL(false, (std::is_convertible<std::string, symbol>::value));
+  CHECK_EQUAL(true,  (std::is_constructible<symbol, text>::value));
+  CHECK_EQUAL(false, (std::is_convertible<text, symbol>::value));
+  CHECK_EQUAL(true,  (std::is_constructible<text, symbol>::value));
+  CHECK_EQUAL(false, (std::is_convertible<symbol, text>::value));
+  CHECK_EQUAL(false, (std::is_constructible<symbol, field_name>::value));
+  CHECK_EQUAL(true,  std::is_nothrow_copy_constructible<symbol>::value);
+}
+
+TEST(interning) {
+  symbol empty;
+  CHECK_EQUAL(0u, empty.value);
+  CHECK_EQUAL(true, empty.empty());
+  CHECK_EQUAL(true, empty == symbol(""));
+
+  symbol a("ESZ6");
+  symbol b(std::string("ESZ6"));
+  symbol c("ESZ6-extra", 4);
+  symbol d("NQZ6");
+  CHECK_EQUAL(true, a == b);
+  CHECK_EQUAL(true, a == c);
+  CHECK_EQUAL(true, a != d);
+  CHECK_EQUAL(a.value, b.value);
+  CHECK_EQUAL("ESZ6", a.str());
+  CHECK_EQUAL(4u, a.size());
+  CHECK_EQUAL('Z', a[2]);
+  CHECK_EQUAL(std::string("NQZ6"), std::string(d.begin(), d.end()));
+  CHECK_EQUAL(0, std::strcmp(d.c_str(), "NQZ6"));
+  CHECK_EQUAL(true, a.data() == b.data());
+
+  // Embedded null characters are part of the string
+  symbol z(std::string("a\0b", 3));
+  CHECK_EQUAL(3u, z.size());
+  CHECK_EQUAL(true, z != symbol("a"));
+
+  symbol found;
+  CHECK_EQUAL(true, symbol::find("NQZ6", found));
+  CHECK_EQUAL(true, found == d);
+  const std::size_t n = symbol::table().size();
+  CHECK_EQUAL(false, symbol::find("never interned", found));
+  CHECK_EQUAL(n, symbol::table().size());
+
+#if __cplusplus >= 201703L
+  CHECK_EQUAL(true, a.view() == "ESZ6");
+#endif
+}
+
+TEST(tables) {
+  symbol s("price");
+  field_name f("qty");
+  field_name g("price");
+  CHECK_EQUAL(true, &symbol::table() != &field_name::table());
+  CHECK_EQUAL("price", g.str());
+  CHECK_EQUAL("qty", f.str());
+
+  left_name l("shared");
+  right_name r("shared");
+  CHECK_EQUAL(true, &left_name::table() == &right_name::table());
+  CHECK_EQUAL(l.value, r.value);
+}
+
+TEST(conversion) {
+  text t("BTC-USD");
+  symbol s(t);
+  CHECK_EQUAL("BTC-USD", s.str());
+  text u = static_cast<text>(s);
+  CHECK_EQUAL(true, t == u);
+}
+
+TEST(ordering) {
+  symbol b("b"), a("a"), c("c");
+  CHECK_EQUAL(true, a < b);
+  CHECK_EQUAL(true, c > b);
+  CHECK_EQUAL(true, a <= a);
+  CHECK_EQUAL(false, c <= a);
+  CHECK_EQUAL(0, b.compare(symbol("b")));
+  CHECK_EQUAL(true, a.compare(c) < 0);
+
+  std::ostringstream os;
+  os << a << c;
+  CHECK_EQUAL("ac", os.str());
+
+  std::unordered_set<symbol> set{ a, b, symbol("a") };
+  CHECK_EQUAL(2u, set.size());
+  CHECK_EQUAL(std::hash<std::uint32_t>{}(a.value), std::hash<symbol>{}(a));
+}
+
+TEST(growth) {
+  // Enough strings to span several segments and index rebuilds
+  intern_table table;
+  std::vector<intern_table::id_type> ids;
+  for (unsigned i = 0; i < 20000; ++i) {
+    ids.push_back(table.intern("name" + std::to_string(i)));
+  }
+  CHECK_EQUAL(20001u, table.size());
+  unsigned errors = 0;
+  for (unsigned i = 0; i < 20000; ++i) {
+    const std::string s = "name" + std::to_string(i);
+    if (table.intern(s) != ids[i]) ++errors;
+    if (table.str(ids[i]) != s) ++errors;
+  }
+  CHECK_EQUAL(0u, errors);
+  CHECK_EQUAL(20001u, table.size());
+}
+
+TEST(concurrency) {
+  // Threads intern the same strings in different orders, and must agree
+  // on every id
+  intern_table table;
+  const unsigned threads = 4;
+  const unsigned names = 5000;
+  std::vector<std::vector<intern_table::id_type>> ids(
+      threads, std::vector<intern_table::id_type>(names));
+  std::atomic<unsigned> errors{0};
+  std::vector<std::thread> pool;
+  for (unsigned t = 0; t < threads; ++t) {
+    pool.emplace_back([&table, &ids, &errors, t]() {
+      for (unsigned j = 0; j < names; ++j) {
+        const unsigned i = (t % 2) ? names - 1 - j : j;
+        const std::string s = "n" + std::to_string(i);
+        const intern_table::id_type id = table.intern(s);
+        if (table.str(id) != s) ++errors;
+        ids[t][i] = id;
+      }
+    });
+  }
+  for (auto& th : pool) th.join();
+  CHECK_EQUAL(0u, errors.load());
+  CHECK_EQUAL(names + 1u, table.size());
+  for (unsigned t = 1; t < threads; ++t) {
+    CHECK_EQUAL(true, ids[t] == ids[0]);
+  }
+}
@@ -0,0 +1,289 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/parse.hpp"
+#include "opaque/inconvertibool.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+UNIT_TEST_MAIN
+
+struct count : opaque::numeric_typedef<std::int64_t, count> {
+  using base = opaque::numeric_typedef<std::int64_t, count>;
+  using base::base;
+};
+
+struct serial : opaque::numeric_typedef<std::uint64_t, serial> {
+  using base = opaque::numeric_typedef<std::uint64_t, serial>;
+  using base::base;
+};
+
+struct level : opaque::numeric_typedef<std::int8_t, level> {
+  using base = opaque::numeric_typedef<std::int8_t, level>;
+  using base::base;
+};
+
+struct meters : opaque::numeric_typedef<double, meters> {
+  using base = opaque::numeric_typedef<double, meters>;
+  using base::base;
+};
+
+struct name : opaque::experimental::safer_string_typedef<std::string, name> {
+  using base = opaque::experimental::safer_string_typedef<std::string, name>;
+  using base::base;
+};
+
+template <typename O>
+static opaque::from_chars_result parse(const std::string& s, O& o) {
+  return opaque::from_chars(s.data(), s.data() + s.size(), o);
+}
+
+template <typename O>
+static std::size_t used(const std::string& s, const O& o) {
+  O copy(o);
+  return static_cast<std::size_t>(parse(s, copy).ptr - s.data());
+}
+
+static bool same(const meters& l, const meters& r) {
+  return not (l.value < r.value) and not (r.value < l.value);
+}
+
+template <typename O, typename = void>
+struct can_parse : std::false_type { };
+template <typename O>
+struct can_parse<O, opaque::void_t<decltype(opaque::from_chars(
+    std::declval<const char *>(), std::declval<const char *>(),
+    std::declval<O&>()))>>
+  : std::true_type { };
+
+SUITE(from_chars) {
+  TEST(integers) {
+    count c(5);
+    CHECK_EQUAL(true, parse("-1234", c).ec == std::errc());
+    CHECK_EQUAL(-1234, c.value);
+    CHECK_EQUAL(true, parse("000000000000000000000000042", c).ec
+                      == std::errc());
+    CHECK_EQUAL(42, c.value);
+    CHECK_EQUAL(true, parse("9223372036854775807", c).ec == std::errc());
+    CHECK_EQUAL(std::numeric_limits<std::int64_t>::max(), c.value);
+    CHECK_EQUAL(true, parse("-9223372036854775808", c).ec == std::errc());
+    CHECK_EQUAL(std::numeric_limits<std::int64_t>::min(), c.value);
+    CHECK_EQUAL(5u, used("12345,678", c));
+    CHECK_EQUAL(true, parse("12345678901234567890123", c).ec
+                      == std::errc::result_out_of_range);
+    CHECK_EQUAL(std::numeric_limits<std::int64_t>::min(), c.value);
+    serial s(0);
+    CHECK_EQUAL(true, parse("18446744073709551615", s).ec == std::errc());
+    CHECK_EQUAL(std::numeric_limits<std::uint64_t>::max(), s.value);
+    level l(std::int8_t(0));
+    CHECK_EQUAL(true, parse("-128", l).ec == std::errc());
+    CHECK_EQUAL(-128, l.value);
+  }
+
+  TEST(integer_errors) {
+    count c(5);
+    CHECK_EQUAL(true, parse("9223372036854775808", c).ec
+                      == std::errc::result_out_of_range);
+    CHECK_EQUAL(19u, used("9223372036854775808", c));
+    CHECK_EQUAL(true, parse("-", c).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("+1", c).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse(" 1", c).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("", c).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(0u, used("x1", c));
+    CHECK_EQUAL(5, c.value);
+    serial s(7);
+    CHECK_EQUAL(true, parse("-1", s).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("18446744073709551616", s).ec
+                      == std::errc::result_out_of_range);
+    CHECK_EQUAL(true, parse("99999999999999999999999", s).ec
+                      == std::errc::result_out_of_range);
+    CHECK_EQUAL(7u, s.value);
+    level l(std::int8_t(1));
+    CHECK_EQUAL(true, parse("128", l).ec == std::errc::result_out_of_range);
+    CHECK_EQUAL(1, l.value);
+  }
+
+  TEST(integers_match_to_string) {
+    // Every digit count, followed by assorted bytes
+    std::mt19937_64 rng(20);
+    unsigned wrong = 0;
+    const char tails[] = { '\0', ',', '/', ':', 'a', '\x80', '\xff', ' ' };
+    for (unsigned i = 0; i != 20000; ++i) {
+      const std::int64_t v = static_cast<std::int64_t>(rng() >> (rng() % 64));
+      const std::int64_t x = i % 2 ? v : -v;
+      const std::string digits = std::to_string(x);
+      const std::string text = digits + tails[rng() % sizeof tails] + "123";
+      count c(0);
+      const opaque::from_chars_result r = parse(text, c);
+      wrong += r.ec != std::errc() or c.value != x or
+               r.ptr != text.data() + digits.size();
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(floating_point) {
+    meters m(0.0);
+    CHECK_EQUAL(true, parse("-2.5e3 m", m).ec == std::errc());
+    CHECK_EQUAL(true, same(m, meters(-2500.0)));
+    CHECK_EQUAL(6u, used("-2.5e3 m", m));
+    CHECK_EQUAL(1u, used("1e", m));
+    CHECK_EQUAL(1u, used("0x10", m));
+    CHECK_EQUAL(true, parse("+1", m).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("e5", m).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("inf", m).ec == std::errc());
+    CHECK_EQUAL(true, m.value > std::numeric_limits<double>::max());
+    CHECK_EQUAL(true, parse("1e999", m).ec
+                      == std::errc::result_out_of_range);
+    CHECK_EQUAL(true, parse("1e-999", m).ec
+                      == std::errc::result_out_of_range);
+    std::mt19937_64 rng(4);
+    unsigned wrong = 0;
+    for (unsigned i = 0; i != 1000; ++i) {
+      const meters v(std::ldexp(static_cast<double>(rng()), -40));
+      char buffer[64];
+      const char * end =
+        opaque::to_chars(buffer, buffer + sizeof buffer, v).ptr;
+      meters back(0.0);
+      wrong += opaque::from_chars(buffer, end, back).ec != std::errc() or
+               not same(back, v);
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(floating_point_extremes) {
+    // Subnormals and the smallest normal round-trip like any other value
+    const double values[] = { std::numeric_limits<double>::denorm_min(),
+                              -1.7107959617702069e-308,
+                              std::numeric_limits<double>::min(),
+                              std::numeric_limits<double>::max() };
+    for (const double x : values) {
+      char buffer[64];
+      const char * end =
+        opaque::to_chars(buffer, buffer + sizeof buffer, meters(x)).ptr;
+      meters back(0.0);
+      const opaque::from_chars_result r = opaque::from_chars(buffer, end, back);
+      CHECK_EQUAL(true, r.ec == std::errc());
+      CHECK_EQUAL(true, r.ptr == end);
+      CHECK_EQUAL(true, same(back, meters(x)));
+    }
+  }
+
+  TEST(decimals) {
+    // Short decimals, where the fast path applies, read as strtod does
+    std::mt19937_64 rng(8);
+    unsigned wrong = 0;
+    for (unsigned i = 0; i != 20000; ++i) {
+      std::string text = std::to_string(rng() >> (rng() % 64));
+      const std::size_t at = rng() % (text.size() + 1);
+      text.insert(at, ".");
+      if (i % 2) text.insert(0, "-");
+      meters m(0.0);
+      const opaque::from_chars_result r = parse(text, m);
+      wrong += r.ec != std::errc() or r.ptr != text.data() + text.size() or
+               not same(m, meters(std::strtod(text.c_str(), nullptr)));
+    }
+    CHECK_EQUAL(0u, wrong);
+    meters m(1.0);
+    CHECK_EQUAL(3u, used("1.2.3", m));
+    CHECK_EQUAL(true, parse(".", m).ec == std::errc::invalid_argument);
+    CHECK_EQUAL(true, parse("-0.0", m).ec == std::errc());
+    CHECK_EQUAL(true, std::signbit(m.value));
+  }
+
+  TEST(booleans) {
+    opaque::inconvertibool b(false);
+    CHECK_EQUAL(true, parse("true", b).ec == std::errc());
+    CHECK_EQUAL(true, b == opaque::inconvertibool(true));
+    CHECK_EQUAL(true, parse("1", b).ec == std::errc::invalid_argument);
+  }
+
+  TEST(traits) {
+    CHECK_EQUAL(true , can_parse<count>::value);
+    CHECK_EQUAL(true , can_parse<meters>::value);
+    CHECK_EQUAL(false, can_parse<const count>::value);
+    CHECK_EQUAL(false, can_parse<int>::value);
+    CHECK_EQUAL(false, can_parse<name>::value);
+  }
+}
+
+SUITE(parse_column) {
+  TEST(values) {
+    const std::string text = "12\n-7\n123456789012\n0\n";
+    std::vector<count> out(8, count(0));
+    const opaque::parse_column_result r = opaque::parse_column(
+        text.data(), text.data() + text.size(), '\n', opaque::span<count>(out));
+    CHECK_EQUAL(true, r.ec == std::errc());
+    CHECK_EQUAL(4u, r.count);
+    CHECK_EQUAL(true, r.ptr == text.data() + text.size());
+    CHECK_EQUAL(-7, out[1].value);
+    CHECK_EQUAL(123456789012, out[2].value);
+  }
+
+  TEST(full_output) {
+    const std::string text = "1.5,2.5,3.5";
+    meters out[2];
+    const char * const last = text.data() + text.size();
+    opaque::parse_column_result r =
+      opaque::parse_column(text.data(), last, ',', opaque::span<meters>(out));
+    CHECK_EQUAL(true, r.ec == std::errc());
+    CHECK_EQUAL(2u, r.count);
+    CHECK_EQUAL(true, r.ptr == text.data() + 8);
+    r = opaque::parse_column(r.ptr, last, ',', opaque::span<meters>(out));
+    CHECK_EQUAL(1u, r.count);
+    CHECK_EQUAL(true, same(out[0], meters(3.5)));
+    CHECK_EQUAL(true, r.ptr == last);
+  }
+
+  TEST(errors) {
+    count out[4];
+    const std::string bad = "1,2x,3";
+    opaque::parse_column_result r = opaque::parse_column(
+        bad.data(), bad.data() + bad.size(), ',', opaque::span<count>(out));
+    CHECK_EQUAL(true, r.ec == std::errc::invalid_argument);
+    CHECK_EQUAL(1u, r.count);
+    CHECK_EQUAL(true, r.ptr == bad.data() + 2);
+    const std::string empty = "1,,3";
+    r = opaque::parse_column(empty.data(), empty.data() + empty.size(), ',',
+                             opaque::span<count>(out));
+    CHECK_EQUAL(true, r.ec == std::errc::invalid_argument);
+    CHECK_EQUAL(1u, r.count);
+    const std::string big = "1,99999999999999999999";
+    r = opaque::parse_column(big.data(), big.data() + big.size(), ',',
+                             opaque::span<count>(out));
+    CHECK_EQUAL(true, r.ec == std::errc::result_out_of_range);
+    CHECK_EQUAL(true, r.ptr == big.data() + 2);
+  }
+}
@@ -28,6 +28,15 @@
 //
 #include "opaque/experimental/safer_string_typedef.hpp"
 #include "arrtest/arrtest.hpp"
+#include <cstddef>
+#include <memory>
+#include <scoped_allocator>
+#include <string>
+#include <utility>
+#include <vector>
+#if __cplusplus >= 201703L
+#include <memory_resource>
+#endif
 
 using namespace std;
 using namespace opaque;
@@ -41,6 +50,63 @@ struct a_string
   using base::base;
 };
 
+// Allocates from a list of blocks, and frees only on destruction
+struct arena {
+  std::vector<std::unique_ptr<char[]>> blocks;
+  std::size_t bytes = 0;
+  void * allocate(std::size_t n) {
+    blocks.emplace_back(new char[n]);
+    bytes += n;
+    return blocks.back().get();
+  }
+};
+
+template <typename T>
+struct arena_allocator {
+  typedef T value_type;
+  arena * pool;
+  explicit arena_allocator(arena& a) noexcept : pool(&a) { }
+  template <typename U>
+  arena_allocator(const arena_allocator<U>& a) noexcept : pool(a.pool) { }
+  T * allocate(std::size_t n) {
+    return static_cast<T *>(pool->allocate(n * sizeof(T)));
+  }
+  void deallocate(T *, std::size_t) noexcept { }
+};
+template <typename T, typename U>
+bool operator==(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+  return l.pool == r.pool;
+}
+template <typename T, typename U>
+bool operator!=(const arena_allocator<T>& l, const arena_allocator<U>& r) {
+  return l.pool != r.pool;
+}
+
+typedef std::basic_string<char, std::char_traits<char>,
+                          arena_allocator<char>> arena_basic_string;
+
+struct arena_string
+  : opaque::experimental::safer_string_typedef<arena_basic_string,
+                                                arena_string>
+{
+  using base = opaque::experimental::safer_string_typedef<arena_basic_string,
+                                                           arena_string>;
+  using base::base;
+};
+
+#if __cplusplus >= 201703L
+struct pmr_string
+  : opaque::experimental::safer_string_typedef<std::pmr::string, pmr_string>
+{
+  using base =
+    opaque::experimental::safer_string_typedef<std::pmr::string, pmr_string>;
+  using base::base;
+};
+#endif
+
+// Longer than the small string buffer, so that it must allocate
+static const char long_text[] = "a string that does not fit in the buffer";
+
 SUITE(construction) {
   TEST(ctor_traits) {
     CHECK_EQUAL(true , std::is_constructible<a_string, std::string>::value);
@@ -59,3 +125,113 @@ SUITE(construction) {
     CHECK_EQUAL(b, c);
   }
 }
+
+SUITE(allocator) {
+  TEST(construction) {
+    arena a;
+    const arena_allocator<char> alloc(a);
+    const arena_basic_string raw(long_text, alloc);
+    const std::size_t before = a.bytes;
+
+    arena_string s1(long_text, alloc);
+    arena_string s2(raw, alloc);
+    arena_string s3(raw, 2, 6, alloc);
+    arena_string s4(arena_basic_string(raw), alloc);
+    arena_string s5(s1, alloc);
+    arena_string s6(std::move(s5), alloc);
+    arena_string s7(s1, 2, 6, alloc);
+    arena_string s8(alloc);
+    CHECK_EQUAL(true, a.bytes > before);
+    CHECK_EQUAL(true, s1 == s2 and s2 == s4 and s4 == s6);
+    CHECK_EQUAL(true, s3 == s7);
+    CHECK_EQUAL(true, s3.value == arena_basic_string("string", alloc));
+    CHECK_EQUAL(true, s8.empty());
+    const arena_string * all[] = { &s1, &s2, &s3, &s4, &s6, &s7, &s8 };
+    unsigned foreign = 0;
+    for (const arena_string * p : all) {
+      if (p->get_allocator() != alloc) ++foreign;
+    }
+    CHECK_EQUAL(0u, foreign);
+  }
+
+  TEST(concatenation) {
+    // Results of operator+ and substr use the allocator of the operand
+    // that supplies the characters on the left
+    arena a, b;
+    const arena_allocator<char> in_a(a), in_b(b);
+    const arena_string l(long_text, in_a);
+    const arena_string r(long_text, in_b);
+    CHECK_EQUAL(true, (l + r).get_allocator() == in_a);
+    CHECK_EQUAL(true, (r + l).get_allocator() == in_b);
+    CHECK_EQUAL(true, (l + '!').get_allocator() == in_a);
+    CHECK_EQUAL(true, ('!' + r).get_allocator() == in_b);
+    CHECK_EQUAL(true, l.substr(1).get_allocator() == in_a);
+    CHECK_EQUAL(true, (arena_string(l, in_b) + l).get_allocator() == in_b);
+    CHECK_EQUAL(true, (l + r).size() == 2 * l.size());
+    CHECK_EQUAL('!', ('!' + r).front());
+    CHECK_EQUAL('!', (l + '!').back());
+  }
+
+  TEST(containers) {
+    // Allocator-extended constructors make the typedef allocator-aware,
+    // so a scoped allocator reaches the elements of a container
+    arena a;
+    typedef std::scoped_allocator_adaptor<arena_allocator<arena_string>>
+      scoped;
+    std::vector<arena_string, scoped> v{
+        scoped(arena_allocator<arena_string>(a))};
+    v.emplace_back(long_text);
+    v.push_back(v.front());
+    v.emplace_back();
+    v.push_back(v[0] + v[1]);
+    unsigned foreign = 0;
+    for (const arena_string& s : v) {
+      if (s.get_allocator() != arena_allocator<char>(a)) ++foreign;
+    }
+    CHECK_EQUAL(0u, foreign);
+    CHECK_EQUAL(true, v[0] == v[1]);
+  }
+
+#if __cplusplus >= 201703L
+  TEST(pmr) {
+    std::pmr::monotonic_buffer_resource pool;
+    std::pmr::vector<pmr_string> v(&pool);
+    v.emplace_back(long_text);
+    v.push_back(v.front());
+    v.push_back(v[0] + v[1]);
+    v.push_back(v[2].substr(3));
+    unsigned foreign = 0;
+    for (const pmr_string& s : v) {
+      if (s.get_allocator().resource() != &pool) ++foreign;
+    }
+    CHECK_EQUAL(0u, foreign);
+  }
+#endif
+}
+
+SUITE(searching) {
+  TEST(members) {
+    // The members that search with vector kernels answer as basic_string
+    std::string raw(3000, 'x');
+    raw[1500] = ';';
+    raw[2999] = '\n';
+    raw.replace(2000, 5, "key=1");
+    const a_string s(raw);
+    CHECK_EQUAL(raw.find("key="), s.find("key="));
+    CHECK_EQUAL(raw.find("key=2"), s.find("key=2"));
+    CHECK_EQUAL(raw.find("x", 2990), s.find("x", 2990));
+    CHECK_EQUAL(raw.find(""), s.find(""));
+    CHECK_EQUAL(raw.find_first_of(";\n="), s.find_first_of(";\n="));
+    CHECK_EQUAL(raw.find_first_of(";\n=", 1501),
+                s.find_first_of(";\n=", 1501));
+    CHECK_EQUAL(raw.find_first_of("\n", 2999),
+                s.find_first_of(a_string("\n"), 2999));
+    CHECK_EQUAL(raw.find_first_not_of("x"), s.find_first_not_of("x"));
+    CHECK_EQUAL(raw.find_first_not_of('x', 2001),
+                s.find_first_not_of('x', 2001));
+    CHECK_EQUAL(raw.find_first_not_of("x;=key1\n"),
+                s.find_first_not_of("x;=key1\n"));
+    CHECK_EQUAL(raw.find_first_not_of("", 7), s.find_first_not_of("", 7));
+    CHECK_EQUAL(raw.find_first_of("", 7), s.find_first_of("", 7));
+  }
+}
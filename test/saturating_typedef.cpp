@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/saturating_typedef.hpp"
+#include "opaque/atomic_typedef.hpp"
+#include "opaque/checked_numeric_typedef.hpp"
+#include "opaque/binop/binop_batch.hpp"
+#include "arrtest/arrtest.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+template <typename T>
+struct sat : saturating_typedef<T, sat<T>> {
+  using base = saturating_typedef<T, sat<T>>;
+  using base::base;
+};
+
+struct bias : numeric_typedef<std::int16_t, bias> {
+  using base = numeric_typedef<std::int16_t, bias>;
+  using base::base;
+};
+
+// A signal sample, which may be offset by a bias
+struct sample : saturating_typedef<std::int16_t, sample>
+              , binop::addable<sample, true, sample, bias> {
+  using base = saturating_typedef<std::int16_t, sample>;
+  using base::base;
+  sample& operator+=(const bias& b) & noexcept {
+    value = detail::saturate_add(value, b.value);
+    return *this;
+  }
+};
+
+// Shifted by counts of its own width, so that the counts could be lanes
+struct gain : saturating_typedef<std::uint16_t, gain, std::uint16_t> {
+  using base = saturating_typedef<std::uint16_t, gain, std::uint16_t>;
+  using base::base;
+};
+
+struct strict : checked_numeric_typedef<int, strict> {
+  using base = checked_numeric_typedef<int, strict>;
+  using base::base;
+};
+
+struct clamped : checked_numeric_typedef<int, clamped,
+                                         saturate_on_overflow> {
+  using base = checked_numeric_typedef<int, clamped, saturate_on_overflow>;
+  using base::base;
+};
+
+template <typename T>
+static T clamp(long long v) {
+  using L = std::numeric_limits<T>;
+  return static_cast<T>(std::min<long long>(std::max<long long>(v, L::min()),
+                                            L::max()));
+}
+
+template <typename T>
+static sat<T> s(long long v) { return sat<T>(static_cast<T>(v)); }
+
+// Every pair of values of an 8 bit type against wide arithmetic
+template <typename T>
+static int mismatches() {
+  using L = std::numeric_limits<T>;
+  int bad = 0;
+  for (int a = L::min(); a <= L::max(); ++a) {
+    for (int b = L::min(); b <= L::max(); ++b) {
+      bad += (s<T>(a) + s<T>(b)).value != clamp<T>(a + b);
+      bad += (s<T>(a) - s<T>(b)).value != clamp<T>(a - b);
+      bad += (s<T>(a) * s<T>(b)).value != clamp<T>(a * b);
+      if (b != 0) {
+        bad += (s<T>(a) / s<T>(b)).value != clamp<T>(a / b);
+        bad += (s<T>(a) % s<T>(b)).value != clamp<T>(a % b);
+      }
+    }
+  }
+  return bad;
+}
+
+// Values around the limits and zero
+template <typename T>
+static std::vector<sat<T>> edges(std::size_t n) {
+  using L = std::numeric_limits<T>;
+  const long long picks[] = { L::min(), L::min() + 1, -300, -2, -1, 0, 1, 2,
+                              181, 182, 255, 300, L::max() - 1, L::max() };
+  std::vector<sat<T>> v;
+  for (std::size_t i = 0; i != n; ++i) {
+    v.push_back(s<T>(clamp<T>(picks[(i * 5 + n) % 14])));
+  }
+  return v;
+}
+
+// The batch operation must agree with the scalar operator, including on
+// the lanes left over after whole registers
+template <typename Mixin, typename T, typename F>
+static bool batch_matches(F f) {
+  for (std::size_t n : { 0, 1, 7, 16, 33, 70 }) {
+    auto l = edges<T>(n);
+    auto r = edges<T>(n + 3);
+    std::vector<sat<T>> out(n), expected;
+    for (std::size_t i = 0; i != n; ++i) expected.push_back(f(l[i], r[i]));
+    binop::apply<Mixin>(out, l, r);
+    binop::transform_assign<Mixin>(l, r);
+    for (std::size_t i = 0; i != n; ++i) {
+      if (out[i].value != expected[i].value) return false;
+      if (l[i].value != expected[i].value) return false;
+    }
+  }
+  return true;
+}
+
+SUITE(saturating) {
+  TEST(scalar) {
+    CHECK_EQUAL(0, mismatches<std::int8_t>());
+    CHECK_EQUAL(0, mismatches<std::uint8_t>());
+    const int imax = std::numeric_limits<int>::max();
+    const int imin = std::numeric_limits<int>::min();
+    CHECK_EQUAL(imax, (s<int>(imax) + s<int>(1)).value);
+    CHECK_EQUAL(imin, (s<int>(imin) - s<int>(1)).value);
+    CHECK_EQUAL(imax, (s<int>(imin) * s<int>(-1)).value);
+    CHECK_EQUAL(imax, (s<int>(imin) / s<int>(-1)).value);
+    CHECK_EQUAL(0, (s<int>(imin) % s<int>(-1)).value);
+    CHECK_EQUAL(imax, (-s<int>(imin)).value);
+    CHECK_EQUAL(0u, (-s<unsigned>(5)).value);
+    CHECK_EQUAL(0xffffffffffffffffu,
+        (s<std::uint64_t>(1ull << 40) * s<std::uint64_t>(1ull << 40)).value);
+    sat<std::uint8_t> u = s<std::uint8_t>(254);
+    CHECK_EQUAL(254, (u++).value);
+    CHECK_EQUAL(255, (++u).value);
+    u = s<std::uint8_t>(0);
+    CHECK_EQUAL(0, (u--).value);
+    CHECK_EQUAL(0, (--u).value);
+    CHECK_EQUAL(0u, (s<unsigned>(0x80000000u) << 1u).value);
+  }
+
+  TEST(mixed) {
+    CHECK_EQUAL(32767, (sample(std::int16_t(32000)) +
+                        bias(std::int16_t(1000))).value);
+    CHECK_EQUAL(-32768, (sample(std::int16_t(-32000)) +
+                         bias(std::int16_t(-1000))).value);
+    std::vector<sample> l(37, sample(std::int16_t(32000)));
+    std::vector<bias> r(37, bias(std::int16_t(1000)));
+    using add_bias = binop::addable<sample, true, sample, bias>;
+    CHECK_EQUAL(true, binop::is_lane_operation<add_bias>::value);
+    binop::transform_assign<add_bias>(l, r);
+    CHECK_EQUAL(32767, l.front().value);
+    CHECK_EQUAL(32767, l.back().value);
+  }
+
+  TEST(batch) {
+    using namespace binop;
+    auto add = [](sat<std::int8_t> a, sat<std::int8_t> b) { return a + b; };
+    CHECK_EQUAL(true, (batch_matches<addable<sat<std::int8_t>>,
+                                     std::int8_t>(add)));
+    auto addu = [](sat<std::uint8_t> a, sat<std::uint8_t> b) { return a + b; };
+    CHECK_EQUAL(true, (batch_matches<addable<sat<std::uint8_t>>,
+                                     std::uint8_t>(addu)));
+    auto sub = [](sat<std::int16_t> a, sat<std::int16_t> b) { return a - b; };
+    CHECK_EQUAL(true, (batch_matches<subtractable<sat<std::int16_t>>,
+                                     std::int16_t>(sub)));
+    auto subu = [](sat<std::uint16_t> a, sat<std::uint16_t> b) {
+      return a - b; };
+    CHECK_EQUAL(true, (batch_matches<subtractable<sat<std::uint16_t>>,
+                                     std::uint16_t>(subu)));
+    auto mul = [](sat<std::int16_t> a, sat<std::int16_t> b) { return a * b; };
+    CHECK_EQUAL(true, (batch_matches<multipliable<sat<std::int16_t>>,
+                                     std::int16_t>(mul)));
+    auto mulu = [](sat<std::uint16_t> a, sat<std::uint16_t> b) {
+      return a * b; };
+    CHECK_EQUAL(true, (batch_matches<multipliable<sat<std::uint16_t>>,
+                                     std::uint16_t>(mulu)));
+    auto add32 = [](sat<std::int32_t> a, sat<std::int32_t> b) {
+      return a + b; };
+    CHECK_EQUAL(true, (batch_matches<addable<sat<std::int32_t>>,
+                                     std::int32_t>(add32)));
+    std::vector<sat<std::int16_t>> l(20, s<std::int16_t>(-32768));
+    std::vector<sat<std::int16_t>> r(20, s<std::int16_t>(-1));
+    transform_assign<dividable<sat<std::int16_t>>>(l, r);
+    CHECK_EQUAL(32767, l.back().value);
+  }
+
+  TEST(batch_shift) {
+    // Shift counts differ per element, so they are not lane operations
+    using shl = binop::left_shiftable<gain, false, gain, std::uint16_t>;
+    const std::size_t n = 19;
+    const std::vector<gain> ones(n, gain(std::uint16_t{1}));
+    std::vector<std::uint16_t> counts(n);
+    for (std::size_t i = 0; i != n; ++i) {
+      counts[i] = static_cast<std::uint16_t>(i % 16);
+    }
+    std::vector<gain> out(n);
+    binop::apply<shl>(out, ones, counts);
+    std::vector<gain> l = ones;
+    binop::transform_assign<shl>(l, counts);
+    for (std::size_t i = 0; i != n; ++i) {
+      CHECK_EQUAL(1u << (i % 16), out[i].value);
+      CHECK_EQUAL(1u << (i % 16), l[i].value);
+    }
+  }
+
+  TEST(traits) {
+    CHECK_EQUAL(true, binop::is_batchable<sat<std::int16_t>>::value);
+    CHECK_EQUAL(true, binop::is_batchable<clamped>::value);
+    CHECK_EQUAL(false, binop::is_batchable<strict>::value);
+    CHECK_EQUAL(false, is_native_arithmetic<sat<std::int32_t>>::value);
+    CHECK_EQUAL(true, (std::is_same<saturate_on_overflow,
+                       sat<std::int8_t>::overflow_policy>::value));
+    CHECK_EQUAL(true, simd::is_vectorized<simd::adds_t, std::uint8_t>::value);
+    CHECK_EQUAL(true, simd::is_vectorized<simd::muls_t, std::int16_t>::value);
+    CHECK_EQUAL(false, simd::is_vectorized<simd::muls_t, std::uint16_t>::value);
+  }
+}
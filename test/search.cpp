@@ -0,0 +1,125 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/search.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+// A small alphabet makes matches common; it includes bytes with the high
+// bit set and a null byte
+static const char alphabet[] = { 'a', 'b', 'c', '\0', '\x7f', '\x80', '\xff' };
+
+static std::string random_string(std::mt19937& rng, std::size_t n) {
+  std::string s;
+  for (std::size_t i = 0; i != n; ++i) s += alphabet[rng() % sizeof alphabet];
+  return s;
+}
+
+static std::vector<search::isa_level> levels() {
+  std::vector<search::isa_level> v{ search::isa_level::scalar };
+  const search::isa_level best = search::supported_level();
+  if (best >= search::isa_level::sse42) v.push_back(search::isa_level::sse42);
+  if (best >= search::isa_level::avx2) v.push_back(search::isa_level::avx2);
+  return v;
+}
+
+SUITE(byte_search) {
+  TEST(byte_set) {
+    std::string all;
+    for (int c = 0; c < 256; c += 3) all += static_cast<char>(c);
+    const search::byte_set bytes(all.data(), all.size());
+    unsigned wrong = 0;
+    for (int c = 0; c != 256; ++c) {
+      wrong += bytes.contains(static_cast<char>(c)) != (c % 3 == 0);
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+
+  TEST(kernels) {
+    // Every kernel this CPU can run agrees with basic_string
+    std::mt19937 rng(18);
+    for (search::isa_level level : levels()) {
+      const search::kernels k = search::kernels_for(level);
+      unsigned wrong = 0;
+      for (unsigned trial = 0; trial != 2000; ++trial) {
+        // Some inputs span several blocks of find_skipping
+        const std::size_t limit = trial % 16 == 0 ? 3000 : 200;
+        const std::string s = random_string(rng, rng() % limit);
+        const std::string chars = random_string(rng, 1 + rng() % 5);
+        const search::byte_set bytes(chars.data(), chars.size());
+        const std::size_t of = s.find_first_of(chars);
+        const std::size_t not_of = s.find_first_not_of(chars);
+        wrong += k.scan(s.data(), s.size(), bytes, true) !=
+                 (of == std::string::npos ? s.size() : of);
+        wrong += k.scan(s.data(), s.size(), bytes, false) !=
+                 (not_of == std::string::npos ? s.size() : not_of);
+        const std::string needle = random_string(rng, 2 + rng() % 4);
+        const std::size_t at = s.find(needle);
+        wrong += k.find(s.data(), s.size(), needle.data(), needle.size()) !=
+                 (at == std::string::npos ? s.size() : at);
+      }
+      for (unsigned trial = 0; trial != 200; ++trial) {
+        // A needle whose first byte is common, found late or not at all
+        std::string s(rng() % 5000, 'a');
+        const std::size_t at = rng() % (s.size() + 2);
+        if (at + 3 <= s.size()) s.replace(at, 3, "aab");
+        const std::size_t expected = s.find("aab");
+        wrong += k.find(s.data(), s.size(), "aab", 3) !=
+                 (expected == std::string::npos ? s.size() : expected);
+      }
+      CHECK_EQUAL(0u, wrong);
+    }
+  }
+
+  TEST(semantics) {
+    // Positions, empty needles and sets, and long sets as basic_string
+    std::mt19937 rng(7);
+    unsigned wrong = 0;
+    for (unsigned trial = 0; trial != 5000; ++trial) {
+      const std::string s = random_string(rng, rng() % 100);
+      const std::string t = random_string(rng, rng() % 24);
+      const std::size_t pos = rng() % (s.size() + 3);
+      const std::size_t n = rng() % (t.size() + 1);
+      wrong += search::find(s.data(), s.size(), t.data(), pos, n) !=
+               s.find(t.data(), pos, n);
+      wrong += search::find_first_of(s.data(), s.size(), t.data(), pos, n) !=
+               s.find_first_of(t.data(), pos, n);
+      wrong += search::find_first_not_of(s.data(), s.size(), t.data(), pos,
+                                         n) !=
+               s.find_first_not_of(t.data(), pos, n);
+    }
+    CHECK_EQUAL(0u, wrong);
+  }
+}
@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/sharded_counter.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct requests : numeric_typedef<std::uint64_t, requests> {
+  using base = numeric_typedef<std::uint64_t, requests>;
+  using base::base;
+};
+
+struct distance : numeric_typedef<std::int64_t, distance> {
+  using base = numeric_typedef<std::int64_t, distance>;
+  using base::base;
+};
+
+struct offset : experimental::position_typedef<distance, offset> {
+  using base = experimental::position_typedef<distance, offset>;
+  using base::base;
+};
+
+struct tick : numeric_typedef<std::uint8_t, tick> {
+  using base = numeric_typedef<std::uint8_t, tick>;
+  using base::base;
+};
+
+template <typename C, typename D, typename = void>
+struct can_add : std::false_type { };
+template <typename C, typename D>
+struct can_add<C, D, void_t<decltype(
+    std::declval<C&>().add(std::declval<const D&>()))>>
+  : std::true_type { };
+
+SUITE(sharding) {
+  TEST(counting) {
+    sharded_counter<requests> c(requests(5u), 4);
+    CHECK_EQUAL(4u, c.shards());
+    CHECK_EQUAL(5u, c.load().value);
+    c.add(requests(3u));
+    c.sub(requests(1u));
+    CHECK_EQUAL(7u, c.load().value);
+    CHECK_EQUAL(8u, sharded_counter<requests>(requests(), 5).shards());
+    CHECK_EQUAL(1u, sharded_counter<requests>(requests(), 0).shards());
+    CHECK_EQUAL(0u, sharded_counter<requests>().load().value);
+  }
+
+  TEST(permissions) {
+    CHECK_EQUAL(true,  (can_add<sharded_counter<requests>, requests>::value));
+    CHECK_EQUAL(false, (can_add<sharded_counter<requests>, distance>::value));
+    CHECK_EQUAL(true,  (can_add<sharded_counter<offset>, distance>::value));
+    CHECK_EQUAL(false, (can_add<sharded_counter<offset>, offset>::value));
+  }
+
+  TEST(wrapping) {
+    sharded_counter<offset> o(offset(10), 2);
+    o.sub(distance(25));
+    CHECK_EQUAL(-15, o.load().value);
+    sharded_counter<tick> t(tick(std::uint8_t(250)), 2);
+    t.add(tick(std::uint8_t(10)));
+    CHECK_EQUAL(4u, t.load().value);
+  }
+
+  TEST(contention) {
+    // More threads than shards, so that some shards are shared
+    sharded_counter<requests> c(requests(), 2);
+    std::vector<std::thread> pool;
+    for (int t = 0; t < 4; ++t) {
+      pool.emplace_back([&]{
+        for (int i = 0; i < 10000; ++i) c.add(requests(1u));
+      });
+    }
+    for (std::thread& t : pool) t.join();
+    CHECK_EQUAL(40000u, c.load().value);
+  }
+}
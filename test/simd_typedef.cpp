@@ -0,0 +1,188 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/simd_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+using namespace opaque;
+using namespace opaque::experimental;
+
+UNIT_TEST_MAIN
+
+template <typename U, std::size_t N>
+struct vec : simd_typedef<U, vec<U,N>, N> {
+  using base = simd_typedef<U, vec<U,N>, N>;
+  using base::base;
+};
+
+// Lane values exercising carries, signs and the scalar remainder
+template <typename U, std::size_t N>
+vec<U,N> make(unsigned seed) {
+  simd::lanes<U,N> l;
+  for (std::size_t i = 0; i < N; ++i) {
+    l[i] = static_cast<U>((i * 37u + seed * 11u) % 101u + 1u);
+    if (std::numeric_limits<U>::is_signed and i % 3 == 1) l[i] = -l[i];
+  }
+  return vec<U,N>(l);
+}
+
+template <typename U, std::size_t N, typename F, typename G>
+bool lanewise(F vector_op, G scalar_op) {
+  vec<U,N> a = make<U,N>(1);
+  vec<U,N> b = make<U,N>(2);
+  vec<U,N> r = vector_op(a, b);
+  for (std::size_t i = 0; i < N; ++i) {
+    U e = a[i];
+    scalar_op(e, b[i]);
+    if (not std::equal_to<U>()(e, r[i])) return false;
+  }
+  return true;
+}
+
+template <typename U, std::size_t N>
+bool arithmetic() {
+  using V = vec<U,N>;
+  return
+    lanewise<U,N>([](V a, V b) { return a + b; }, [](U& a, U b) { a += b; }) and
+    lanewise<U,N>([](V a, V b) { return a - b; }, [](U& a, U b) { a -= b; }) and
+    lanewise<U,N>([](V a, V b) { return a * b; }, [](U& a, U b) { a *= b; }) and
+    lanewise<U,N>([](V a, V b) { return a / b; }, [](U& a, U b) { a /= b; });
+}
+
+template <typename U, std::size_t N>
+bool integral() {
+  using V = vec<U,N>;
+  return arithmetic<U,N>() and
+    lanewise<U,N>([](V a, V b) { return a % b; }, [](U& a, U b) { a %= b; }) and
+    lanewise<U,N>([](V a, V b) { return a & b; }, [](U& a, U b) { a &= b; }) and
+    lanewise<U,N>([](V a, V b) { return a | b; }, [](U& a, U b) { a |= b; }) and
+    lanewise<U,N>([](V a, V b) { return a ^ b; }, [](U& a, U b) { a ^= b; }) and
+    lanewise<U,N>([](V a, V  ) { return a << 3u; }, [](U& a, U) { a <<= 3u; }) and
+    lanewise<U,N>([](V a, V  ) { return a >> 2u; }, [](U& a, U) { a >>= 2u; }) and
+    lanewise<U,N>([](V a, V  ) { return ~a; },
+        [](U& a, U) { a = static_cast<U>(~a); }) and
+    lanewise<U,N>([](V a, V  ) { return -a; },
+        [](U& a, U) { a = static_cast<U>(U() - a); });
+}
+
+SUITE(lanes) {
+
+  TEST(layout) {
+    CHECK_EQUAL(16u, sizeof(vec<std::int32_t,4>));
+    CHECK_EQUAL(16u, alignof(vec<std::int32_t,4>));
+    CHECK_EQUAL(32u, alignof(vec<double,4>));
+    CHECK_EQUAL(24u, sizeof(vec<double,3>));
+    CHECK_EQUAL( 8u, alignof(vec<double,3>));
+    CHECK_EQUAL( 4u, (vec<std::int32_t,4>::size()));
+  }
+
+  TEST(broadcast) {
+    auto v = vec<std::int16_t,9>::broadcast(7);
+    for (std::size_t i = 0; i < v.size(); ++i) {
+      CHECK_EQUAL(7, v[i]);
+    }
+  }
+
+  TEST(equality) {
+    auto a = make<std::int32_t,13>(1);
+    auto b = make<std::int32_t,13>(1);
+    CHECK(a == b);
+    b[12] = 0;
+    CHECK(a != b);
+  }
+
+  TEST(integral) {
+    CHECK((integral<std::int8_t  , 37>()));
+    CHECK((integral<std::uint8_t , 64>()));
+    CHECK((integral<std::int16_t , 19>()));
+    CHECK((integral<std::uint16_t, 16>()));
+    CHECK((integral<std::int32_t ,  4>()));
+    CHECK((integral<std::int32_t , 13>()));
+    CHECK((integral<std::uint32_t, 32>()));
+    CHECK((integral<std::int64_t ,  7>()));
+    CHECK((integral<std::uint64_t,  2>()));
+  }
+
+  TEST(floating) {
+    CHECK((arithmetic<float ,  4>()));
+    CHECK((arithmetic<float , 21>()));
+    CHECK((arithmetic<double,  3>()));
+    CHECK((arithmetic<double, 16>()));
+  }
+
+}
+
+//
+// Mixed-type rules are the same as for numeric_typedef
+//
+
+struct offset4 : simd_typedef<std::int64_t, offset4, 4> {
+  using base = simd_typedef<std::int64_t, offset4, 4>;
+  using base::base;
+};
+
+struct address4 : simd_typedef_base<std::int64_t, address4, 4>
+  , binop::addable<address4, true, address4, offset4> {
+  using base = simd_typedef_base<std::int64_t, address4, 4>;
+  using base::base;
+  address4& operator+=(const address4&) = delete;
+  address4& operator+=(const offset4& o) & noexcept {
+    simd::apply<simd::add_t>(value.lane, o.value.lane, size());
+    return *this;
+  }
+};
+
+template <typename T, typename U, typename = void>
+struct is_addable : std::false_type { };
+template <typename T, typename U>
+struct is_addable<T, U, void_t<decltype(std::declval<T>() + std::declval<U>())>>
+  : std::true_type { };
+
+SUITE(mixed) {
+
+  TEST(permission) {
+    CHECK_EQUAL(true , (is_addable<offset4 , offset4 >::value));
+    CHECK_EQUAL(true , (is_addable<address4, offset4 >::value));
+    CHECK_EQUAL(false, (is_addable<offset4 , address4>::value));
+    CHECK_EQUAL(false, (is_addable<address4, address4>::value));
+    CHECK_EQUAL(false, (is_addable<offset4 , vec<std::int64_t,4>>::value));
+  }
+
+  TEST(add) {
+    auto a = address4::broadcast(1000);
+    auto o = offset4::broadcast(24);
+    address4 r = a + o;
+    for (std::size_t i = 0; i < r.size(); ++i) {
+      CHECK_EQUAL(1024, r[i]);
+    }
+  }
+
+}
@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/slot_map.hpp"
+#include "opaque/experimental/handle_typedef.hpp"
+#include "opaque/type_traits.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct entity : experimental::handle_typedef<entity, 20, 12> {
+  using base = experimental::handle_typedef<entity, 20, 12>;
+  using base::base;
+};
+
+struct wide : experimental::handle_typedef<wide, 32, 32> {
+  using base = experimental::handle_typedef<wide, 32, 32>;
+  using base::base;
+};
+
+// Two index bits and two generation bits: four slots, three generations
+struct tiny : experimental::handle_typedef<tiny, 2, 2> {
+  using base = experimental::handle_typedef<tiny, 2, 2>;
+  using base::base;
+};
+
+template <typename T, typename = void>
+struct incrementable : std::false_type { };
+template <typename T>
+struct incrementable<T, void_t<decltype(++std::declval<T&>())>>
+  : std::true_type { };
+
+template <typename T, typename = void>
+struct addable : std::false_type { };
+template <typename T>
+struct addable<T, void_t<decltype(std::declval<T&>() += std::declval<T>())>>
+  : std::true_type { };
+
+TEST(handle_typedef) {
+  CHECK_EQUAL(true, (std::is_same<entity::underlying_type,
+        std::uint32_t>::value));
+  CHECK_EQUAL(true, (std::is_same<wide::underlying_type,
+        std::uint64_t>::value));
+  CHECK_EQUAL(true, sizeof(entity) == sizeof(std::uint32_t));
+  CHECK_EQUAL(0xFFFFFu, entity::max_index);
+  CHECK_EQUAL(0xFFFu, entity::max_generation);
+  CHECK_EQUAL(0xFFFFFFFFu, wide::max_generation);
+
+  entity h = entity::make(12345u, 67u);
+  CHECK_EQUAL(12345u, h.index());
+  CHECK_EQUAL(67u, h.generation());
+  CHECK_EQUAL((67u << 20) | 12345u, h.value);
+
+  wide w = wide::make(0xFFFFFFFFu, 0x80000001u);
+  CHECK_EQUAL(0xFFFFFFFFu, w.index());
+  CHECK_EQUAL(0x80000001u, w.generation());
+
+  CHECK_EQUAL(true,  entity::make(1u, 2u) == entity::make(1u, 2u));
+  CHECK_EQUAL(false, entity::make(1u, 2u) == entity::make(1u, 3u));
+  CHECK_EQUAL(0u, entity{}.generation());
+
+  CHECK_EQUAL(false, incrementable<entity>::value);
+  CHECK_EQUAL(false, addable<entity>::value);
+}
+
+TEST(basic) {
+  slot_map<entity, std::string> m;
+  CHECK_EQUAL(true, m.empty());
+
+  entity a = m.insert("a");
+  entity b = m.emplace(2u, 'b');
+  std::string c_value("c");
+  entity c = m.insert(c_value);
+  CHECK_EQUAL(3u, m.size());
+  CHECK_EQUAL("a", m[a]);
+  CHECK_EQUAL("bb", m.at(b));
+  CHECK_EQUAL("c", *m.find(c));
+  CHECK_EQUAL(false, m.contains(entity{}));
+  CHECK_EQUAL(true, m.find(entity{}) == nullptr);
+
+  // Erasure moves the last value into the hole, but handles stay valid
+  CHECK_EQUAL(true, m.erase(a));
+  CHECK_EQUAL(false, m.erase(a));
+  CHECK_EQUAL(2u, m.size());
+  CHECK_EQUAL(false, m.contains(a));
+  CHECK_EQUAL("bb", m[b]);
+  CHECK_EQUAL("c", m[c]);
+
+  // The slot is reused with a new generation; the old handle stays stale
+  entity d = m.insert("d");
+  CHECK_EQUAL(a.index(), d.index());
+  CHECK_EQUAL(true, a.generation() != d.generation());
+  CHECK_EQUAL(false, m.contains(a));
+  CHECK_EQUAL(true, m.find(a) == nullptr);
+  CHECK_EQUAL("d", m[d]);
+  try {
+    m.at(a);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+
+  std::size_t n = 0;
+  for (std::size_t i = 0; i < m.size(); ++i) {
+    if (m[m.handle_at(i)] == m.data()[i]) ++n;
+  }
+  CHECK_EQUAL(3u, n);
+
+  m.clear();
+  CHECK_EQUAL(true, m.empty());
+  CHECK_EQUAL(false, m.contains(b));
+  CHECK_EQUAL(false, m.contains(d));
+}
+
+TEST(exhaustion) {
+  slot_map<tiny, int> m;
+  tiny h[4];
+  for (int i = 0; i < 4; ++i) h[i] = m.insert(i);
+  try {
+    m.insert(4);
+    CHECK_CATCH(std::length_error, e);
+  }
+  CHECK_EQUAL(4u, m.size());
+
+  // Slot 0 is reused for generations 2 and 3, then retired
+  tiny old = h[0];
+  CHECK_EQUAL(1u, old.generation());
+  for (unsigned g = 2; g <= 3; ++g) {
+    CHECK_EQUAL(true, m.erase(h[0]));
+    h[0] = m.insert(0);
+    CHECK_EQUAL(0u, h[0].index());
+    CHECK_EQUAL(g, h[0].generation());
+    CHECK_EQUAL(false, m.contains(old));
+  }
+  CHECK_EQUAL(true, m.erase(h[0]));
+  CHECK_EQUAL(false, m.contains(tiny{}));
+  CHECK_EQUAL(false, m.contains(tiny::make(0u, 0u)));
+  try {
+    m.insert(0);
+    CHECK_CATCH(std::length_error, e);
+  }
+
+  // Other slots are still reusable
+  CHECK_EQUAL(true, m.erase(h[1]));
+  tiny r = m.insert(1);
+  CHECK_EQUAL(1u, r.index());
+  CHECK_EQUAL(3u, m.size());
+}
+
+TEST(move_only) {
+  slot_map<entity, std::unique_ptr<int>> m;
+  entity a = m.emplace(new int(1));
+  entity b = m.insert(std::unique_ptr<int>(new int(2)));
+  CHECK_EQUAL(true, m.erase(a));
+  CHECK_EQUAL(2, *m[b]);
+  int sum = 0;
+  for (auto& p : m) sum += *p;
+  CHECK_EQUAL(2, sum);
+}
+
+TEST(model) {
+  // Random operations, checked against std::unordered_map, including
+  // lookups with stale handles
+  slot_map<entity, unsigned> m;
+  std::unordered_map<std::uint32_t, unsigned> model;
+  std::vector<entity> live, dead;
+  std::mt19937 rng(11);
+  unsigned errors = 0;
+  for (unsigned i = 0; i < 20000; ++i) {
+    const unsigned op = static_cast<unsigned>(rng() % 4);
+    if (op < 2 or live.empty()) {
+      entity h = m.insert(i);
+      model[h.value] = i;
+      live.push_back(h);
+    } else {
+      const std::size_t k = static_cast<std::size_t>(rng() % live.size());
+      entity h = live[k];
+      if (op == 2) {
+        if (not m.erase(h)) ++errors;
+        model.erase(h.value);
+        live[k] = live.back();
+        live.pop_back();
+        dead.push_back(h);
+      } else if (m.at(h) != model.at(h.value)) {
+        ++errors;
+      }
+    }
+  }
+  CHECK_EQUAL(0u, errors);
+  CHECK_EQUAL(model.size(), m.size());
+  for (const entity& h : dead) {
+    if (m.contains(h)) ++errors;
+  }
+  for (std::size_t i = 0; i < m.size(); ++i) {
+    if (model.at(m.handle_at(i).value) != m.data()[i]) ++errors;
+  }
+  CHECK_EQUAL(0u, errors);
+}
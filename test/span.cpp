@@ -0,0 +1,153 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/span.hpp"
+#include "opaque/numeric_typedef.hpp"
+#include "opaque/experimental/position_typedef.hpp"
+#include "opaque/experimental/string_typedef.hpp"
+#include "arrtest/arrtest.hpp"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace opaque;
+
+UNIT_TEST_MAIN
+
+struct distance : numeric_typedef<std::int32_t, distance> {
+  using base = numeric_typedef<std::int32_t, distance>;
+  using base::base;
+};
+
+struct offset : experimental::position_typedef<distance, offset> {
+  using base = experimental::position_typedef<distance, offset>;
+  using base::base;
+};
+
+struct a_string
+  : experimental::string_typedef<std::string, a_string> {
+  using base = experimental::string_typedef<std::string, a_string>;
+  using base::base;
+};
+
+struct padded : data<std::int32_t, padded> {
+  using base = data<std::int32_t, padded>;
+  using base::base;
+  char extra;
+};
+
+template <typename T, typename S>
+bool same_memory(T* p, const S& s) {
+  return static_cast<const void*>(p) == static_cast<const void*>(s.data());
+}
+
+TEST(is_layout_compatible) {
+  CHECK_EQUAL(true , is_layout_compatible<distance>::value);
+  CHECK_EQUAL(true , is_layout_compatible<offset>::value);
+  CHECK_EQUAL(false, is_layout_compatible<a_string>::value);
+  CHECK_EQUAL(false, is_layout_compatible<padded>::value);
+  CHECK_EQUAL(false, (is_layout_compatible<distance, std::uint32_t>::value));
+}
+
+TEST(span_construct) {
+  std::int32_t a[] = { 1, 2, 3, 4, 5 };
+  std::vector<std::int32_t> v(a, a + 5);
+
+  span<std::int32_t> s1(a);
+  span<std::int32_t> s2(v);
+  span<std::int32_t> s3(a + 1, a + 4);
+  span<const std::int32_t> s4(s1);
+  const std::vector<std::int32_t>& cv = v;
+  span<const std::int32_t> s5(cv);
+
+  CHECK_EQUAL(5u, s1.size());
+  CHECK_EQUAL(5u, s2.size());
+  CHECK_EQUAL(3u, s3.size());
+  CHECK_EQUAL(2, s3.front());
+  CHECK_EQUAL(4, s3.back());
+  CHECK_EQUAL(5 * sizeof(std::int32_t), s4.size_bytes());
+  CHECK_EQUAL(true, same_memory(v.data(), s5));
+  CHECK_EQUAL(true, span<std::int32_t>().empty());
+
+  CHECK_EQUAL(true, (std::is_convertible<
+        span<std::int32_t>, span<const std::int32_t>>::value));
+  CHECK_EQUAL(false, (std::is_convertible<
+        span<const std::int32_t>, span<std::int32_t>>::value));
+  CHECK_EQUAL(false, (std::is_convertible<
+        std::vector<std::int32_t>&, span<std::int64_t>>::value));
+}
+
+TEST(span_slice) {
+  std::int32_t a[] = { 1, 2, 3, 4, 5 };
+  span<std::int32_t> s(a);
+  CHECK_RANGE_EQUAL(a, s.first(2).data(), 2);
+  CHECK_RANGE_EQUAL(a + 3, s.last(2).data(), 2);
+  CHECK_RANGE_EQUAL(a + 2, s.subspan(2).data(), 3);
+  CHECK_EQUAL(3u, s.subspan(2).size());
+  CHECK_EQUAL(2u, s.subspan(1, 2).size());
+  std::int32_t sum = 0;
+  for (std::int32_t x : s) sum += x;
+  CHECK_EQUAL(15, sum);
+}
+
+TEST(as_opaque) {
+  std::vector<std::int32_t> v = { 10, 20, 30 };
+  span<distance> d = as_opaque<distance>(v);
+  CHECK_EQUAL(true, same_memory(v.data(), d));
+  CHECK_EQUAL(3u, d.size());
+  CHECK_EQUAL(20, d[1].value);
+
+  d[1] += distance(5);
+  CHECK_EQUAL(25, v[1]);
+
+  span<const offset> o = as_opaque<offset>(
+      static_cast<const std::int32_t*>(v.data()), v.size());
+  CHECK_EQUAL(true, same_memory(v.data(), o));
+  CHECK_EQUAL(true, o[2] - o[0] == distance(20));
+
+  span<const std::int32_t> c(v);
+  CHECK_EQUAL(true, (std::is_same<span<const distance>,
+        decltype(as_opaque<distance>(c))>::value));
+}
+
+TEST(as_underlying) {
+  std::vector<distance> v = { distance(1), distance(2), distance(3) };
+  span<std::int32_t> u = as_underlying(v);
+  CHECK_EQUAL(true, same_memory(v.data(), u));
+  u[0] = 7;
+  CHECK_EQUAL(true, v[0] == distance(7));
+
+  const std::vector<distance>& cv = v;
+  span<const std::int32_t> cu = as_underlying(cv);
+  CHECK_EQUAL(3u, cu.size());
+  CHECK_EQUAL(true, (std::is_same<span<const std::int32_t>,
+        decltype(as_underlying(span<const distance>(v)))>::value));
+
+  span<distance> round_trip = as_opaque<distance>(as_underlying(v));
+  CHECK_EQUAL(true, same_memory(v.data(), round_trip));
+}
@@ -57,3 +57,13 @@ SUITE(construction) {
     CHECK_EQUAL(b, c);
   }
 }
+
+SUITE(concatenation) {
+  TEST(character_arrays) {
+    a_string s("mid");
+    CHECK_EQUAL(a_string("<mid"), "<" + s);
+    CHECK_EQUAL(a_string("mid>"), s + ">");
+    CHECK_EQUAL(a_string("<mid>"), "<" + a_string("mid") + ">");
+    CHECK_EQUAL(a_string("!mid"), '!' + s);
+  }
+}
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2026
+// Kyle Markley.  All rights reserved.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice,
+//    this list of conditions and the following disclaimer.
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+// 3. Neither the name of the author nor the names of any contributors may be
+//    used to endorse or promote products derived from this software without
+//    specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+#include "opaque/experimental/string_view_typedef.hpp"
+#include "opaque/experimental/fixed_string_typedef.hpp"
+#include "opaque/experimental/safer_string_typedef.hpp"
+#include "opaque/hash.hpp"
+#include "opaque/ostream.hpp"
+#include "arrtest/arrtest.hpp"
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_set>
+#include <vector>
+
+using namespace opaque;
+using opaque::experimental::string_view;
+
+UNIT_TEST_MAIN
+
+struct symbol_view : experimental::string_view_typedef<symbol_view> {
+  using base = experimental::string_view_typedef<symbol_view>;
+  using base::base;
+};
+
+struct venue_view : experimental::string_view_typedef<venue_view> {
+  using base = experimental::string_view_typedef<venue_view>;
+  using base::base;
+};
+
+struct symbol
+  : experimental::safer_string_typedef<std::string, symbol> {
+  using base = experimental::safer_string_typedef<std::string, symbol>;
+  using base::base;
+};
+
+struct venue : experimental::fixed_string_typedef<8, venue> {
+  using base = experimental::fixed_string_typedef<8, venue>;
+  using base::base;
+};
+
+OPAQUE_HASHABLE(symbol_view)
+
+TEST(traits) {
+  CHECK_EQUAL(true, std::is_trivially_copyable<symbol_view>::value);
+  CHECK_EQUAL(true, sizeof(symbol_view) == sizeof(string_view));
+
+  CHECK_EQUAL(true , (std::is_constructible<symbol_view,
+        const std::string&>::value));
+  CHECK_EQUAL(false, (std::is_constructible<symbol_view,
+        std::string&&>::value));
+  CHECK_EQUAL(false, (std::is_convertible<const char *, symbol_view>::value));
+  CHECK_EQUAL(true , (std::is_constructible<symbol_view,
+        const symbol&>::value));
+  CHECK_EQUAL(false, (std::is_constructible<symbol_view, symbol&&>::value));
+  CHECK_EQUAL(false, (std::is_convertible<const symbol&,
+        symbol_view>::value));
+
+  CHECK_EQUAL(true , (std::is_constructible<symbol, symbol_view>::value));
+  CHECK_EQUAL(false, (std::is_convertible<symbol_view, symbol>::value));
+  CHECK_EQUAL(true , (std::is_constructible<venue, venue_view>::value));
+}
+
+TEST(tokenize) {
+  // Split a record into typed fields without copying any characters
+  const std::string line = "ESZ6,XCME,4500.25";
+  std::vector<symbol_view> fields;
+  symbol_view rest(line);
+  for (;;) {
+    const std::size_t comma = rest.find(',');
+    fields.push_back(rest.substr(0, comma));
+    if (comma == symbol_view::npos) break;
+    rest.remove_prefix(comma + 1);
+  }
+  CHECK_EQUAL(3u, fields.size());
+  CHECK_EQUAL(true, fields[0] == "ESZ6");
+  CHECK_EQUAL(true, fields[1] == "XCME");
+  CHECK_EQUAL(true, fields[2] == "4500.25");
+  CHECK_EQUAL(true, fields[1].data() == line.data() + 5);
+
+  // Owning copies only on request
+  symbol s = static_cast<symbol>(fields[0]);
+  CHECK_EQUAL("ESZ6", s.value);
+  venue v = static_cast<venue>(venue_view(fields[1].data(), 4));
+  CHECK_EQUAL(true, v == "XCME");
+  CHECK_EQUAL(true, symbol_view(s) == fields[0]);
+  CHECK_EQUAL(true, venue_view(v) == "XCME");
+  CHECK_EQUAL("4500.25", fields[2].str());
+}
+
+TEST(interface) {
+  const std::string text = "abcabcXYZ";
+  symbol_view v(text);
+  CHECK_EQUAL(9u, v.size());
+  CHECK_EQUAL('a', v.front());
+  CHECK_EQUAL('Z', v.back());
+  CHECK_EQUAL('X', v[6]);
+  CHECK_EQUAL(3u, v.find(symbol_view("abc"), 1));
+  CHECK_EQUAL(3u, v.rfind("abc"));
+  CHECK_EQUAL(symbol_view::npos, v.find("abd"));
+  CHECK_EQUAL(2u, v.find_first_of("cX"));
+  CHECK_EQUAL(6u, v.find_last_of("cX"));
+  CHECK_EQUAL(6u, v.find_first_not_of("abc"));
+  CHECK_EQUAL(5u, v.find_last_not_of('X', 6));
+
+  CHECK_EQUAL(true, v.starts_with("abca"));
+  CHECK_EQUAL(false, v.starts_with("abd"));
+  CHECK_EQUAL(true, v.starts_with('a'));
+  CHECK_EQUAL(true, v.ends_with(symbol_view("XYZ")));
+  CHECK_EQUAL(false, v.ends_with("0abcabcXYZ"));
+  CHECK_EQUAL(false, symbol_view().starts_with('a'));
+
+  CHECK_EQUAL(0, v.compare(0, 3, "abc"));
+  CHECK_EQUAL(true, v.compare("abd") < 0);
+  CHECK_EQUAL(true, symbol_view("b") > symbol_view("abc"));
+  CHECK_EQUAL(true, "abc" < symbol_view("abd"));
+
+  try {
+    v.at(9);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+  try {
+    v.substr(10);
+    CHECK_CATCH(std::out_of_range, e);
+  }
+
+  char buffer[4] = { };
+  CHECK_EQUAL(3u, v.copy(buffer, 3, 6));
+  CHECK_EQUAL(std::string("XYZ"), std::string(buffer));
+
+  std::ostringstream os;
+  os << v.substr(6);
+  CHECK_EQUAL("XYZ", os.str());
+}
+
+TEST(hashing) {
+  const std::string a = "key", b = "key";
+  std::unordered_set<symbol_view> set{ symbol_view(a), symbol_view(b) };
+  CHECK_EQUAL(1u, set.size());
+  CHECK_EQUAL(true, set.count(symbol_view("key")) == 1);
+}